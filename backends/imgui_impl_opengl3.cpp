@@ -23,6 +23,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: OpenGL: Support ImTextureFormat_Alpha8 textures, stored as single-channel GL_R8 textures with swizzle on GL 3.3+/ES 3.0+ (set 'io.Fonts->TexDesiredFormat = ImTextureFormat_Alpha8' to use 1 byte per pixel for the font atlas). Expanded to RGBA on upload on older GL and WebGL.
 //  2025-09-18: Call platform_io.ClearRendererHandlers() on shutdown.
 //  2025-07-22: OpenGL: Add and call embedded loader shutdown during ImGui_ImplOpenGL3_Shutdown() to facilitate multiple init/shutdown cycles in same process. (#8792)
 //  2025-07-15: OpenGL: Set GL_UNPACK_ALIGNMENT to 1 before updating textures (#8802) + restore non-WebGL/ES update path that doesn't require a CPU-side copy.
@@ -218,6 +219,24 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Desktop GL 3.3+ and GL ES 3.0+ have texture swizzle, which WebGL doesn't have.
+// Our embedded imgui_impl_opengl3_loader.h is generated and does not include those enums, so we define them here.
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(__EMSCRIPTEN__) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+#ifndef GL_RED
+#define GL_RED                  0x1903
+#endif
+#ifndef GL_R8
+#define GL_R8                   0x8229
+#endif
+#ifndef GL_TEXTURE_SWIZZLE_R
+#define GL_TEXTURE_SWIZZLE_R    0x8E42
+#define GL_TEXTURE_SWIZZLE_G    0x8E43
+#define GL_TEXTURE_SWIZZLE_B    0x8E44
+#define GL_TEXTURE_SWIZZLE_A    0x8E45
+#endif
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -249,6 +268,7 @@ struct ImGui_ImplOpenGL3_Data
     bool            HasPolygonMode;
     bool            HasBindSampler;
     bool            HasClipOrigin;
+    bool            HasTextureSwizzle;
     bool            UseBufferSubData;
     ImVector<char>  TempBuffer;
 
@@ -403,6 +423,9 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     bd->HasBindSampler = (bd->GlVersion >= 330 || bd->GlProfileIsES3);
 #endif
     bd->HasClipOrigin = (bd->GlVersion >= 450);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+    bd->HasTextureSwizzle = (bd->GlVersion >= 330 || bd->GlProfileIsES3);
+#endif
 #ifdef IMGUI_IMPL_OPENGL_HAS_EXTENSIONS
     GLint num_extensions = 0;
     glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
@@ -721,8 +744,44 @@ static void ImGui_ImplOpenGL3_DestroyTexture(ImTextureData* tex)
     tex->SetStatus(ImTextureStatus_Destroyed);
 }
 
+// Copy a block of pixels into a contiguous buffer, expanding ImTextureFormat_Alpha8 to RGBA (white + alpha) if needed.
+static const void* ImGui_ImplOpenGL3_CopyTextureBlock(ImTextureData* tex, int x, int y, int w, int h, bool expand_alpha8)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const int dst_pitch = w * (expand_alpha8 ? 4 : tex->BytesPerPixel);
+    bd->TempBuffer.resize(h * dst_pitch);
+    char* out_p = bd->TempBuffer.Data;
+    for (int yy = 0; yy < h; yy++, out_p += dst_pitch)
+    {
+        const unsigned char* in_p = (const unsigned char*)tex->GetPixelsAt(x, y + yy);
+        if (expand_alpha8)
+            for (int xx = 0; xx < w; xx++)
+                ((ImU32*)(void*)out_p)[xx] = IM_COL32(255, 255, 255, in_p[xx]);
+        else
+            memcpy(out_p, in_p, dst_pitch);
+    }
+    IM_ASSERT(out_p == bd->TempBuffer.end());
+    return bd->TempBuffer.Data;
+}
+
 void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
 {
+    // Alpha8 textures are stored as single-channel textures sampled with a (1,1,1,R) swizzle when supported, otherwise expanded to RGBA on upload.
+    IM_ASSERT(tex->Format == ImTextureFormat_RGBA32 || tex->Format == ImTextureFormat_Alpha8);
+    bool expand_alpha8 = (tex->Format == ImTextureFormat_Alpha8);
+    GLint gl_internal_format = GL_RGBA;
+    GLenum gl_format = GL_RGBA;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const bool use_swizzle = (tex->Format == ImTextureFormat_Alpha8 && bd->HasTextureSwizzle);
+    if (use_swizzle)
+    {
+        gl_internal_format = GL_R8;
+        gl_format = GL_RED;
+        expand_alpha8 = false;
+    }
+#endif
+
     // FIXME: Consider backing up and restoring
     if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates)
     {
@@ -739,8 +798,7 @@ void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
         // Create and upload new texture to graphics system
         //IMGUI_DEBUG_LOG("UpdateTexture #%03d: WantCreate %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
         IM_ASSERT(tex->TexID == 0 && tex->BackendUserData == nullptr);
-        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32);
-        const void* pixels = tex->GetPixels();
+        const void* pixels = expand_alpha8 ? ImGui_ImplOpenGL3_CopyTextureBlock(tex, 0, 0, tex->Width, tex->Height, true) : tex->GetPixels();
         GLuint gl_texture_id = 0;
 
         // Upload texture to graphics system
@@ -753,7 +811,16 @@ void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
         GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
         GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
         GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
-        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex->Width, tex->Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+        if (use_swizzle)
+        {
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED));
+        }
+#endif
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, gl_internal_format, tex->Width, tex->Height, 0, gl_format, GL_UNSIGNED_BYTE, pixels));
 
         // Store identifiers
         tex->SetTexID((ImTextureID)(intptr_t)gl_texture_id);
@@ -772,24 +839,23 @@ void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
         GLuint gl_tex_id = (GLuint)(intptr_t)tex->TexID;
         GL_CALL(glBindTexture(GL_TEXTURE_2D, gl_tex_id));
 #if GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
-        GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, tex->Width));
-        for (ImTextureRect& r : tex->Updates)
-            GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.w, r.h, GL_RGBA, GL_UNSIGNED_BYTE, tex->GetPixelsAt(r.x, r.y)));
-        GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
-#else
-        // GL ES doesn't have GL_UNPACK_ROW_LENGTH, so we need to (A) copy to a contiguous buffer or (B) upload line by line.
-        ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
-        for (ImTextureRect& r : tex->Updates)
+        if (!expand_alpha8)
         {
-            const int src_pitch = r.w * tex->BytesPerPixel;
-            bd->TempBuffer.resize(r.h * src_pitch);
-            char* out_p = bd->TempBuffer.Data;
-            for (int y = 0; y < r.h; y++, out_p += src_pitch)
-                memcpy(out_p, tex->GetPixelsAt(r.x, r.y + y), src_pitch);
-            IM_ASSERT(out_p == bd->TempBuffer.end());
-            GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.w, r.h, GL_RGBA, GL_UNSIGNED_BYTE, bd->TempBuffer.Data));
+            GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, tex->Width));
+            for (ImTextureRect& r : tex->Updates)
+                GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.w, r.h, gl_format, GL_UNSIGNED_BYTE, tex->GetPixelsAt(r.x, r.y)));
+            GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
         }
+        else
 #endif
+        {
+            // GL ES doesn't have GL_UNPACK_ROW_LENGTH, so we need to (A) copy to a contiguous buffer or (B) upload line by line.
+            for (ImTextureRect& r : tex->Updates)
+            {
+                const void* pixels = ImGui_ImplOpenGL3_CopyTextureBlock(tex, r.x, r.y, r.w, r.h, expand_alpha8);
+                GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.w, r.h, gl_format, GL_UNSIGNED_BYTE, pixels));
+            }
+        }
         tex->SetStatus(ImTextureStatus_OK);
         GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture)); // Restore state
     }
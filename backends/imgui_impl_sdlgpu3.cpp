@@ -5,6 +5,8 @@
 //  [X] Renderer: User texture binding. Use 'SDL_GPUTexture*' as texture identifier. Read the FAQ about ImTextureID/ImTextureRef! **IMPORTANT** Before 2025/08/08, ImTextureID was a reference to a SDL_GPUTextureSamplerBinding struct.
 //  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+// Missing features or Issues:
+//  [ ] Renderer: ImTextureFormat_Alpha8 textures are expanded to RGBA32 on upload: no GPU memory or bandwidth saving. See imgui_impl_sdlgpu3.h.
 
 // The aim of imgui_impl_sdlgpu3.h/.cpp is to be usable in your engine without any modification.
 // IF YOU FEEL YOU NEED TO MAKE ANY CHANGE TO THIS CODE, please share them and your feedback at https://github.com/ocornut/imgui/
@@ -22,6 +24,7 @@
 //   Calling the function is MANDATORY, otherwise the ImGui will not upload neither the vertex nor the index buffer for the GPU. See imgui_impl_sdlgpu3.cpp for more info.
 
 // CHANGELOG
+//  2026-10-19: Support ImTextureFormat_Alpha8 textures. SDL_GPU has no texture swizzle so they are expanded to RGBA while copying to the transfer buffer (CPU-side atlas still uses 1 byte per pixel).
 //  2025-09-18: Call platform_io.ClearRendererHandlers() on shutdown.
 //  2025-08-20: Added ImGui_ImplSDLGPU3_InitInfo::SwapchainComposition and ImGui_ImplSDLGPU3_InitInfo::PresentMode to configure how secondary viewports are created.
 //  2025-08-08: *BREAKING* Changed ImTextureID type from SDL_GPUTextureSamplerBinding* to SDL_GPUTexture*, which is more natural and easier for user to manage. If you need to change the current sampler, you can access the ImGui_ImplSDLGPU3_RenderState struct. (#8866, #8163, #7998, #7988)
@@ -325,7 +328,7 @@ void ImGui_ImplSDLGPU3_UpdateTexture(ImTextureData* tex)
         // Create and upload new texture to graphics system
         //IMGUI_DEBUG_LOG("UpdateTexture #%03d: WantCreate %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
         IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
-        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32);
+        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32 || tex->Format == ImTextureFormat_Alpha8);
 
         // Create texture
         SDL_GPUTextureCreateInfo texture_info = {};
@@ -348,7 +351,7 @@ void ImGui_ImplSDLGPU3_UpdateTexture(ImTextureData* tex)
     if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates)
     {
         SDL_GPUTexture* raw_tex = (SDL_GPUTexture*)(intptr_t)tex->GetTexID();
-        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32);
+        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32 || tex->Format == ImTextureFormat_Alpha8);
 
         // Update full texture or selected blocks. We only ever write to textures regions which have never been used before!
         // This backend choose to use tex->UpdateRect but you can use tex->Updates[] to upload individual regions.
@@ -357,8 +360,9 @@ void ImGui_ImplSDLGPU3_UpdateTexture(ImTextureData* tex)
         const int upload_y = (tex->Status == ImTextureStatus_WantCreate) ? 0 : tex->UpdateRect.y;
         const int upload_w = (tex->Status == ImTextureStatus_WantCreate) ? tex->Width : tex->UpdateRect.w;
         const int upload_h = (tex->Status == ImTextureStatus_WantCreate) ? tex->Height : tex->UpdateRect.h;
-        uint32_t upload_pitch = upload_w * tex->BytesPerPixel;
-        uint32_t upload_size = upload_w * upload_h * tex->BytesPerPixel;
+        // Alpha8 textures are expanded to RGBA (white + alpha) as our shaders sample RGBA: the GPU texture always uses 4 bytes per pixel.
+        uint32_t upload_pitch = upload_w * 4;
+        uint32_t upload_size = upload_w * upload_h * 4;
 
         // Create transfer buffer
         if (bd->TexTransferBufferSize < upload_size)
@@ -376,7 +380,19 @@ void ImGui_ImplSDLGPU3_UpdateTexture(ImTextureData* tex)
         {
             void* texture_ptr = SDL_MapGPUTransferBuffer(v->Device, bd->TexTransferBuffer, true);
             for (int y = 0; y < upload_h; y++)
-                memcpy((void*)((uintptr_t)texture_ptr + y * upload_pitch), tex->GetPixelsAt(upload_x, upload_y + y), upload_pitch);
+            {
+                void* dst_p = (void*)((uintptr_t)texture_ptr + y * upload_pitch);
+                if (tex->Format == ImTextureFormat_Alpha8)
+                {
+                    const unsigned char* src_p = (const unsigned char*)tex->GetPixelsAt(upload_x, upload_y + y);
+                    for (int x = 0; x < upload_w; x++)
+                        ((ImU32*)dst_p)[x] = IM_COL32(255, 255, 255, src_p[x]);
+                }
+                else
+                {
+                    memcpy(dst_p, tex->GetPixelsAt(upload_x, upload_y + y), upload_pitch);
+                }
+            }
             SDL_UnmapGPUTransferBuffer(v->Device, bd->TexTransferBuffer);
         }
 
@@ -27,6 +27,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: Vulkan: Support ImTextureFormat_Alpha8 textures, stored as VK_FORMAT_R8_UNORM images with a (1,1,1,R) component mapping (set 'io.Fonts->TexDesiredFormat = ImTextureFormat_Alpha8' to use 1 byte per pixel for the font atlas).
 //  2025-10-15: Vulkan: Added IMGUI_IMPL_VULKAN_VOLK_FILENAME to configure path to volk.h header. (#9008)
 //  2025-09-26: *BREAKING CHANGE*: moved some fields in ImGui_ImplVulkan_InitInfo: init_info.RenderPass --> init_info.PipelineInfoMain.RenderPass, init_info.Subpass --> init_info.PipelineInfoMain.Subpass, init_info.MSAASamples --> init_info.PipelineInfoMain.MSAASamples, init_info.PipelineRenderingCreateInfo --> init_info.PipelineInfoMain.PipelineRenderingCreateInfo.
 //  2025-09-26: *BREAKING CHANGE*: renamed ImGui_ImplVulkan_MainPipelineCreateInfo to ImGui_ImplVulkan_PipelineInfo. Introduced very recently so shouldn't affect many users.
@@ -695,15 +696,16 @@ void ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex)
         // Create and upload new texture to graphics system
         //IMGUI_DEBUG_LOG("UpdateTexture #%03d: WantCreate %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
         IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
-        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32);
+        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32 || tex->Format == ImTextureFormat_Alpha8);
         ImGui_ImplVulkan_Texture* backend_tex = IM_NEW(ImGui_ImplVulkan_Texture)();
+        const VkFormat vk_format = (tex->Format == ImTextureFormat_Alpha8) ? VK_FORMAT_R8_UNORM : VK_FORMAT_R8G8B8A8_UNORM;
 
         // Create the Image:
         {
             VkImageCreateInfo info = {};
             info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
             info.imageType = VK_IMAGE_TYPE_2D;
-            info.format = VK_FORMAT_R8G8B8A8_UNORM;
+            info.format = vk_format;
             info.extent.width = tex->Width;
             info.extent.height = tex->Height;
             info.extent.depth = 1;
@@ -734,7 +736,15 @@ void ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex)
             info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
             info.image = backend_tex->Image;
             info.viewType = VK_IMAGE_VIEW_TYPE_2D;
-            info.format = VK_FORMAT_R8G8B8A8_UNORM;
+            info.format = vk_format;
+            if (tex->Format == ImTextureFormat_Alpha8)
+            {
+                // Sample single-channel coverage as white + alpha
+                info.components.r = VK_COMPONENT_SWIZZLE_ONE;
+                info.components.g = VK_COMPONENT_SWIZZLE_ONE;
+                info.components.b = VK_COMPONENT_SWIZZLE_ONE;
+                info.components.a = VK_COMPONENT_SWIZZLE_R;
+            }
             info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
             info.subresourceRange.levelCount = 1;
             info.subresourceRange.layerCount = 1;
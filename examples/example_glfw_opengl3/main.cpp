@@ -138,6 +138,13 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        // When io.WantRender is false the next frame would be identical to the last one: we block until new events arrive or io.WantRenderTimeout elapses.
+#ifndef __EMSCRIPTEN__
+        if (!io.WantRender && io.WantRenderTimeout == FLT_MAX)
+            glfwWaitEvents();
+        else if (!io.WantRender)
+            glfwWaitEventsTimeout(io.WantRenderTimeout);
+#endif
         glfwPollEvents();
         if (glfwGetWindowAttrib(window, GLFW_ICONIFIED) != 0)
         {
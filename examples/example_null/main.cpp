@@ -3,10 +3,189 @@
 // This is useful to test building, but you cannot interact with anything here!
 #include "imgui.h"
 #include <stdio.h>
+#ifdef IMGUI_EXAMPLE_NULL_WITH_SHM
+#include "misc/shm/imgui_shm.h"
+#include <chrono>
+#include <thread>
+#endif
+#ifdef IMGUI_EXAMPLE_NULL_WITH_TRACE
+#include "misc/trace/imgui_trace.h"
+#endif
+#ifdef IMGUI_EXAMPLE_NULL_WITH_FONT_BENCHMARK
+#include "imgui_internal.h"             // ImFontAtlasGetFontLoaderForStbTruetype()
+#include "misc/freetype/imgui_freetype.h"
+#include <chrono>
+#endif
+#if defined(IMGUI_EXAMPLE_NULL_WITH_THREADS) || defined(IMGUI_EXAMPLE_NULL_WITH_RENDER_THREAD)
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+// Font atlas lock, for using the atlas from multiple threads (see ImFontAtlas::ThreadLockFunc in imgui.h)
+static std::recursive_mutex g_AtlasMutex;
+static void             LockAtlas(ImFontAtlas*)     { g_AtlasMutex.lock(); }
+static void             UnlockAtlas(ImFontAtlas*)   { g_AtlasMutex.unlock(); }
+#endif
+
+#ifdef IMGUI_EXAMPLE_NULL_WITH_THREADS
+#ifndef IMGUI_USE_THREAD_LOCAL_CONTEXT
+#error "IMGUI_EXAMPLE_NULL_WITH_THREADS requires IMGUI_USE_THREAD_LOCAL_CONTEXT to be defined when compiling all files."
+#endif
+
+// Run more contexts on other threads, all sharing the font atlas of the main context.
+// Each thread uses different font sizes, so glyphs are baked and the atlas texture grows while other threads are rendering.
+static const int        THREADS_COUNT = 4;
+
+static void ThreadMain(ImFontAtlas* shared_atlas, int thread_n)
+{
+    ImGuiContext* ctx = ImGui::CreateContext(shared_atlas); // Also sets current context for this thread
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+    io.IniFilename = nullptr;
+    float f = 0.0f;
+    char password[32] = "password";
+    for (int n = 0; n < 200; n++)
+    {
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+        ImGui::NewFrame();
+
+        ImGui::Begin("Thread");
+        ImGui::PushFont(nullptr, 10.0f + (float)((n * 7 + thread_n * 13) % 50));
+        ImGui::Text("Thread %d, frame %d", thread_n, n);
+        ImGui::Text("The quick brown fox jumps over the lazy dog %c%c%c", 0x20 + (n + thread_n) % 0x5F, 0x40 + n % 0x3F, 0x60 + thread_n);
+        ImGui::SliderFloat("float", &f, 0.0f, 1.0f);
+        ImGui::InputText("password", password, IM_ARRAYSIZE(password), ImGuiInputTextFlags_Password);
+        ImGui::PopFont();
+        ImGui::End();
+
+        ImGui::Render();
+    }
+    ImGui::DestroyContext(ctx);
+}
+
+// Bake glyphs queued with AddPreloadRequest() on a worker thread with no context, while contexts are running.
+// Large sizes make the atlas texture grow from this thread. Requests are processed in small steps so other threads may use the atlas in between.
+// Once done, record glyph counts under the same lock: those sizes may be garbage collected afterwards as they are unused.
+static const float      PRELOAD_FONT_SIZES[] = { 96.0f, 128.0f };
+static int              g_PreloadGlyphsCount[IM_ARRAYSIZE(PRELOAD_FONT_SIZES)];
+
+static void PreloadThreadMain(ImFontAtlas* shared_atlas)
+{
+    IM_ASSERT(ImGui::GetCurrentContext() == nullptr);
+    while (true)
+    {
+        {
+            std::lock_guard<std::recursive_mutex> lock(g_AtlasMutex);
+            if (shared_atlas->ProcessPreloadRequests(32))
+            {
+                for (int n = 0; n < IM_ARRAYSIZE(PRELOAD_FONT_SIZES); n++)
+                    g_PreloadGlyphsCount[n] = shared_atlas->Fonts[0]->GetFontBaked(PRELOAD_FONT_SIZES[n])->Glyphs.Size;
+                break;
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+#endif
+
+#ifdef IMGUI_EXAMPLE_NULL_WITH_FONT_BENCHMARK
+#if !defined(IMGUI_ENABLE_FREETYPE) || !defined(IMGUI_ENABLE_STB_TRUETYPE)
+#error "IMGUI_EXAMPLE_NULL_WITH_FONT_BENCHMARK requires both IMGUI_ENABLE_FREETYPE and IMGUI_ENABLE_STB_TRUETYPE to be defined when compiling all files."
+#endif
+
+// Measure glyphs loaded per second by a font loader, baking ASCII + Latin-1 glyphs of all misc/fonts TTF at various sizes.
+// Returns best of a few rounds. Each round uses a new context and atlas so nothing is cached between rounds.
+static double BenchmarkFontLoader(const ImFontLoader* font_loader, int* out_glyphs_count)
+{
+    static const char* font_files[] = { "Cousine-Regular.ttf", "DroidSans.ttf", "Karla-Regular.ttf", "ProggyClean.ttf", "ProggyTiny.ttf", "Roboto-Medium.ttf" };
+    static const float font_sizes[] = { 13.0f, 16.0f, 20.0f, 24.0f, 32.0f, 48.0f };
+    double best_glyphs_per_sec = 0.0;
+    for (int round = 0; round < 5; round++)
+    {
+        ImGuiContext* ctx = ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+        io.IniFilename = nullptr;
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.Fonts->SetFontLoader(font_loader);
+        ImVector<ImFont*> fonts;
+        for (const char* font_file : font_files)
+        {
+            char path[256];
+            snprintf(path, sizeof(path), "../../misc/fonts/%s", font_file);
+            ImFont* font = io.Fonts->AddFontFromFileTTF(path);
+            IM_ASSERT(font != nullptr && "Run from examples/example_null/ folder!");
+            fonts.push_back(font);
+        }
+        ImGui::NewFrame();
+
+        int glyphs_count = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (ImFont* font : fonts)
+            for (float font_size : font_sizes)
+            {
+                ImFontBaked* baked = font->GetFontBaked(font_size);
+                for (ImWchar c = 0x20; c <= 0xFF; c++)
+                    if (c < 0x7F || c >= 0xA0)
+                        if (baked->FindGlyphNoFallback(c) != nullptr)
+                            glyphs_count++;
+            }
+        auto t1 = std::chrono::steady_clock::now();
+        double glyphs_per_sec = glyphs_count / std::chrono::duration<double>(t1 - t0).count();
+        if (glyphs_per_sec > best_glyphs_per_sec)
+            best_glyphs_per_sec = glyphs_per_sec;
+        *out_glyphs_count = glyphs_count;
+
+        ImGui::EndFrame();
+        ImGui::DestroyContext(ctx);
+    }
+    return best_glyphs_per_sec;
+}
+#endif
+
+#ifdef IMGUI_EXAMPLE_NULL_WITH_RENDER_THREAD
+// Render draw data published with io.ConfigDrawDataBuffers from another thread (see AcquireDrawData() in imgui.h).
+// There is no graphics output: we only handle texture requests, and check that textures used by draw commands are alive.
+static void RenderDrawDataNull(ImDrawData* draw_data)
+{
+    std::lock_guard<std::recursive_mutex> lock(g_AtlasMutex); // Main thread may add glyphs to textures while we read them
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+        {
+            if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates)
+            {
+                tex->SetTexID((ImTextureID)(intptr_t)tex->UniqueID);
+                tex->SetStatus(ImTextureStatus_OK);
+            }
+            else if (tex->Status == ImTextureStatus_WantDestroy)
+            {
+                tex->SetTexID(ImTextureID_Invalid);
+                tex->SetStatus(ImTextureStatus_Destroyed);
+            }
+        }
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+        for (const ImDrawCmd& draw_cmd : draw_list->CmdBuffer)
+            if (draw_cmd.UserCallback == nullptr)
+                IM_ASSERT(draw_cmd.GetTexID() != ImTextureID_Invalid);
+}
+#endif
 
 int main(int, char**)
 {
     IMGUI_CHECKVERSION();
+
+#ifdef IMGUI_EXAMPLE_NULL_WITH_FONT_BENCHMARK
+    {
+        int stb_glyphs_count = 0, ft_glyphs_count = 0;
+        double stb_glyphs_per_sec = BenchmarkFontLoader(ImFontAtlasGetFontLoaderForStbTruetype(), &stb_glyphs_count);
+        double ft_glyphs_per_sec = BenchmarkFontLoader(ImGuiFreeType::GetFontLoader(), &ft_glyphs_count);
+        printf("Font benchmark: stb_truetype: %d glyphs, %.0f glyphs/s\n", stb_glyphs_count, stb_glyphs_per_sec);
+        printf("Font benchmark: FreeType:     %d glyphs, %.0f glyphs/s (x%.2f)\n", ft_glyphs_count, ft_glyphs_per_sec, ft_glyphs_per_sec / stb_glyphs_per_sec);
+    }
+#endif
+
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
 
@@ -16,6 +195,74 @@ int main(int, char**)
     //io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
     io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
 
+#ifdef IMGUI_EXAMPLE_NULL_WITH_SHM
+    // Publish frames into shared memory, for an out-of-process renderer to consume (see misc/shm/imgui_shm.h)
+    ImGuiShmWriter* shm_writer = ImGuiShm::CreateWriter("imgui_example_null");
+    IM_ASSERT(shm_writer != nullptr);
+#endif
+
+#if defined(IMGUI_EXAMPLE_NULL_WITH_THREADS) || defined(IMGUI_EXAMPLE_NULL_WITH_RENDER_THREAD)
+    io.Fonts->ThreadLockFunc = LockAtlas;
+    io.Fonts->ThreadUnlockFunc = UnlockAtlas;
+#endif
+#ifdef IMGUI_EXAMPLE_NULL_WITH_THREADS
+    std::thread threads[THREADS_COUNT - 1];
+    std::thread preload_thread;
+    io.Fonts->PreloadGlyphsPerFrame = 0; // Leave preloading to the worker thread
+#endif
+
+#ifdef IMGUI_EXAMPLE_NULL_WITH_RENDER_THREAD
+    io.ConfigDrawDataBuffers = 2;
+    ImGuiContext* ctx = ImGui::GetCurrentContext();
+    {
+        // Hold a frame while the atlas texture grows, then render it: textures it references must not have been destroyed.
+        ImDrawData* held_draw_data = nullptr;
+        ImTextureData* held_tex = nullptr;
+        int grow_frame = -1;
+        for (int n = 0; n < 100 && (grow_frame == -1 || n < grow_frame + 4); n++) // Keep going for a few frames as destroying old texture is deferred
+        {
+            io.DisplaySize = ImVec2(1920, 1080);
+            io.DeltaTime = 1.0f / 60.0f;
+            ImGui::NewFrame();
+            ImGui::PushFont(nullptr, 10.0f + n * 4.0f);
+            ImGui::Text("The quick brown fox jumps over the lazy dog");
+            ImGui::PopFont();
+            ImGui::Render();
+            if (n == 0)
+            {
+                held_draw_data = ImGui::AcquireDrawData(ctx);
+                held_tex = io.Fonts->TexData;
+            }
+            else if (grow_frame == -1 && held_tex != io.Fonts->TexData)
+            {
+                grow_frame = n;
+            }
+        }
+        IM_ASSERT(held_draw_data != nullptr && grow_frame != -1 && "Atlas texture didn't grow!");
+        RenderDrawDataNull(held_draw_data);
+        ImGui::ReleaseDrawData(ctx);
+    }
+
+    // Render latest published frame on another thread, while main thread builds the next ones
+    std::atomic<bool> render_thread_exit(false);
+    std::thread render_thread([ctx, &render_thread_exit]()
+    {
+        while (!render_thread_exit)
+        {
+            if (ImDrawData* draw_data = ImGui::AcquireDrawData(ctx))
+                RenderDrawDataNull(draw_data);
+            std::this_thread::yield();
+        }
+        ImGui::ReleaseDrawData(ctx);
+    });
+#endif
+
+#ifdef IMGUI_EXAMPLE_NULL_WITH_TRACE
+    // Write per-frame timing and counters to a file which can be loaded in https://ui.perfetto.dev (see misc/trace/imgui_trace.h)
+    ImGuiTraceWriter* trace_writer = ImGuiTrace::CreateWriter("example_null_trace.json");
+    IM_ASSERT(trace_writer != nullptr);
+#endif
+
     for (int n = 0; n < 20; n++)
     {
         printf("NewFrame() %d\n", n);
@@ -30,7 +277,49 @@ int main(int, char**)
         ImGui::ShowDemoWindow(nullptr);
 
         ImGui::Render();
+#ifdef IMGUI_EXAMPLE_NULL_WITH_SHM
+        ImGuiShm::WriteDrawData(shm_writer, ImGui::GetDrawData());
+#endif
+#ifdef IMGUI_EXAMPLE_NULL_WITH_THREADS
+        if (n == 0) // Other contexts may use the shared atlas once it has been updated by the NewFrame() of its owner context
+        {
+            for (int thread_n = 1; thread_n < THREADS_COUNT; thread_n++)
+                threads[thread_n - 1] = std::thread(ThreadMain, io.Fonts, thread_n);
+            for (float font_size : PRELOAD_FONT_SIZES)
+                io.Fonts->AddPreloadRequest(io.Fonts->Fonts[0], font_size, io.Fonts->GetGlyphRangesDefault());
+            preload_thread = std::thread(PreloadThreadMain, io.Fonts);
+        }
+#endif
+    }
+
+#ifdef IMGUI_EXAMPLE_NULL_WITH_THREADS
+    for (std::thread& thread : threads)
+        thread.join();
+    preload_thread.join();
+    for (int n = 0; n < IM_ARRAYSIZE(PRELOAD_FONT_SIZES); n++)
+    {
+        printf("Preload: %d glyphs baked at %.0fpx by worker thread\n", g_PreloadGlyphsCount[n], PRELOAD_FONT_SIZES[n]);
+        IM_ASSERT(g_PreloadGlyphsCount[n] > 0x7F - 0x20);
     }
+#endif
+#ifdef IMGUI_EXAMPLE_NULL_WITH_RENDER_THREAD
+    render_thread_exit = true;
+    render_thread.join();
+#endif
+
+#ifdef IMGUI_EXAMPLE_NULL_WITH_SHM
+    // Give a consumer (e.g. misc/shm/imgui_shm_null_consumer.cpp) up to 2 seconds to attach and acquire our last frame.
+    // Our frames are produced faster than a consumer process may start, so we can't only wait for an already attached one.
+    for (int n = 0; n < 2000 && ImGuiShm::GetReaderAcquiredFrameSeq(shm_writer) != ImGuiShm::GetPublishedFrameSeq(shm_writer); n++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    printf("Shm: published %u frames, consumer acquired up to %u\n", ImGuiShm::GetPublishedFrameSeq(shm_writer), ImGuiShm::GetReaderAcquiredFrameSeq(shm_writer));
+    ImGuiShm::DestroyWriter(shm_writer);
+#endif
+#ifdef IMGUI_EXAMPLE_NULL_WITH_TRACE
+    printf("Trace: %d dropped frames, %d write errors\n", ImGuiTrace::GetDroppedFrameCount(trace_writer), ImGuiTrace::GetWriteErrorCount(trace_writer));
+    if (!ImGuiTrace::DestroyWriter(trace_writer))
+        printf("Trace: failed to write example_null_trace.json\n");
+#endif
 
     printf("DestroyContext()\n");
     ImGui::DestroyContext();
@@ -156,6 +156,11 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        // When io.WantRender is false the next frame would be identical to the last one: we block until new events arrive or io.WantRenderTimeout elapses.
+#ifndef __EMSCRIPTEN__
+        if (!io.WantRender)
+            SDL_WaitEventTimeout(nullptr, (io.WantRenderTimeout == FLT_MAX) ? -1 : (int)(io.WantRenderTimeout * 1000.0f) + 1);
+#endif
         SDL_Event event;
         while (SDL_PollEvent(&event))
         {
@@ -66,6 +66,17 @@
 //---- Use legacy CRC32-adler tables (used before 1.91.6), in order to preserve old .ini data that you cannot afford to invalidate.
 //#define IMGUI_USE_LEGACY_CRC32_ADLER
 
+//---- Use a faster word-at-a-time hash instead of CRC32 for IDs (ImHashStr/ImHashData). All ID values change: invalidates .ini data referring to hashed IDs (e.g. tables settings).
+//#define IMGUI_USE_FAST_HASH
+
+//---- Make ImGuiStorage instances hashed by default (O(1) lookup and insertion) instead of sorted (O(log N) lookup, O(N) insertion). Uses more memory. See ImGuiStorage::SetHashed() to select per instance.
+//#define IMGUI_USE_HASHED_STORAGE
+
+//---- Declare the current context pointer (GImGui) as thread_local, so N threads can each use their own context in parallel.
+// Contexts used from different threads either each have their own font atlas, or share one with ImFontAtlas::ThreadLockFunc/ThreadUnlockFunc set.
+// Read "Context and Memory Allocators" section of imgui.cpp for details.
+//#define IMGUI_USE_THREAD_LOCAL_CONTEXT
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support Unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
@@ -138,6 +149,10 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Enable built-in CPU profiler: record timing zones for internal phases (NewFrame steps, Begin/End, tables, text, atlas...) and display them in 'Metrics->Profiler'.
+// (adds a small cost to every Begin() and text rendering call. Disabled by default: when not defined, the profiler code and ImGuiContext fields are entirely compiled out)
+//#define IMGUI_ENABLE_PROFILER
+
 //---- Tip: You can add extra functions within the ImGui:: namespace from anywhere (e.g. your own sources/header files)
 /*
 namespace ImGui
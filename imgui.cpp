@@ -95,6 +95,7 @@ CODE
 // [SECTION] LOCALIZATION
 // [SECTION] VIEWPORTS, PLATFORM WINDOWS
 // [SECTION] PLATFORM DEPENDENT HELPERS
+// [SECTION] PROFILER
 // [SECTION] METRICS/DEBUGGER WINDOW
 // [SECTION] DEBUG LOG WINDOW
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, ID STACK TOOL)
@@ -392,6 +393,9 @@ IMPLEMENTING SUPPORT for ImGuiBackendFlags_RendererHasTextures:
  When you are not sure about an old symbol or function name, try using the Search/Find function of your IDE to look for comments or references in all imgui files.
  You can read releases logs https://github.com/ocornut/imgui/releases for more details.
 
+ - 2025/10/21 (1.92.5) - Storage: ImGuiStorage gained HashIndex/HashMode members and a default constructor (see SetHashed()). The structure size changed: code relying on its layout
+                         (e.g. binary compatibility across a DLL boundary, or 'ImGuiStorage storage = { data }' aggregate initialization) needs to be recompiled/updated.
+                         After modifying ImGuiStorage::Data[] directly, BuildSortByKey() must be called before using the storage, as it also rebuilds the hash index.
  - 2025/10/14 (1.92.4) - TreeNode, Selectable, Clipper: commented out legacy names which were obsoleted in 1.89.7 (July 2023) and 1.89.9 (Sept 2023);
                          - ImGuiTreeNodeFlags_AllowItemOverlap       --> ImGuiTreeNodeFlags_AllowOverlap
                          - ImGuiSelectableFlags_AllowItemOverlap     --> ImGuiSelectableFlags_AllowOverlap
@@ -1177,9 +1181,28 @@ IMPLEMENTING SUPPORT for ImGuiBackendFlags_RendererHasTextures:
 #define IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS
 #define IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS
 #define IMGUI_DISABLE_DEFAULT_SHELL_FUNCTIONS
+#define IMGUI_DISABLE_DEFAULT_FILE_MAPPING
 #endif
 #endif
 
+// [Unix] OS specific includes (used by ImFileMapToMemory())
+#if !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && !defined(IMGUI_DISABLE_DEFAULT_FILE_MAPPING) && !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+#include <fcntl.h>          // open
+#include <sys/mman.h>       // mmap, munmap
+#include <sys/stat.h>       // fstat
+#include <unistd.h>         // close
+#endif
+
+// [Threads] std::this_thread::yield() (used when waiting on other threads)
+#ifdef IMGUI_ENABLE_ATOMICS
+#include <thread>
+#endif
+
+// [Profiler] Timer functions
+#ifdef IMGUI_ENABLE_PROFILER
+#include <time.h>           // clock_gettime, clock
+#endif
+
 // [Apple] OS specific includes
 #if defined(__APPLE__)
 #include <TargetConditionals.h>
@@ -1246,6 +1269,9 @@ static const float NAV_WINDOWING_LIST_APPEAR_DELAY          = 0.15f;    // Time
 static const float NAV_ACTIVATE_HIGHLIGHT_TIMER             = 0.10f;    // Time to highlight an item activated by a shortcut.
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 0.70f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
+static const float WINDOWS_HIT_GRID_CELL_SIZE               = 128.0f;   // Size of g.WindowsHitGrid cells, used to accelerate FindHoveredWindowEx() with many windows.
+static const float WANT_RENDER_TIMEOUT_MARGIN               = 0.001f;   // Added to io.WantRenderTimeout so timers accumulating io.DeltaTime are past their threshold when the application wakes up.
+static const int   DRAW_DATA_DAMAGE_RECTS_MAX               = 16;       // Above this amount, ImDrawData::DamageRects[] are merged into a single bounding rectangle.
 
 // Tooltip offset
 static const ImVec2 TOOLTIP_DEFAULT_OFFSET_MOUSE = ImVec2(16, 10);      // Multiplied by g.Style.MouseCursorScale
@@ -1259,8 +1285,12 @@ static const ImVec2 TOOLTIP_DEFAULT_PIVOT_TOUCH = ImVec2(0.5f, 1.0f);   // Multi
 static void             SetCurrentWindow(ImGuiWindow* window);
 static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
+static void             CalcWindowContentSizes(ImGuiWindow* window, ImVec2* content_size_current, ImVec2* content_size_ideal);
 
 static void             AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window);
+static bool             WindowsHitGridSetup(ImGuiWindowHitGrid* grid, const ImVec2& pos, const ImVec2& size, const ImVec2& padding);
+static void             WindowsHitGridUpdateWindow(ImGuiWindowHitGrid* grid, ImGuiWindow* window);
+static void             WindowsHitGridRemoveWindow(ImGuiWindowHitGrid* grid, ImGuiWindow* window);
 
 // Settings
 static void             WindowSettingsHandler_ClearAll(ImGuiContext*, ImGuiSettingsHandler*);
@@ -1268,6 +1298,9 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSetti
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext*, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+static void             WindowSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, const void* data, size_t data_size);
+static void             WindowSettingsHandler_WriteBinary(ImGuiContext*, ImGuiSettingsHandler*, ImVector<char>* buf);
+static bool             SettingsBinaryWriteFinish(ImGuiContext* ctx, bool wait);
 
 // Platform Dependents default implementation for ImGuiPlatformIO functions
 static const char*      Platform_GetClipboardTextFn_DefaultImpl(ImGuiContext* ctx);
@@ -1297,6 +1330,7 @@ static inline void      NavUpdateAnyRequestFlag();
 static void             NavUpdateCreateWrappingRequest();
 static void             NavEndFrame();
 static bool             NavScoreItem(ImGuiNavItemData* result, const ImRect& nav_bb);
+static void             NavUpdateScoringCullRect();
 static void             NavApplyItemToResult(ImGuiNavItemData* result);
 static void             NavProcessItem();
 static void             NavProcessItemForTabbingRequest(ImGuiID id, ImGuiItemFlags item_flags, ImGuiNavMoveFlags move_flags);
@@ -1327,6 +1361,7 @@ static void             UpdateFontsEndFrame();
 static void             UpdateTexturesNewFrame();
 static void             UpdateTexturesEndFrame();
 static void             UpdateSettings();
+static void             UpdateWantRenderEndFrame();
 static int              UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, bool handle_borders_and_resize_grips, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1339,6 +1374,9 @@ static void             SetLastItemDataForChildWindowItem(ImGuiWindow* window, c
 // Viewports
 const ImGuiID           IMGUI_VIEWPORT_DEFAULT_ID = 0x11111111; // Using an arbitrary constant instead of e.g. ImHashStr("ViewportDefault", 0); so it's easier to spot in the debugger. The exact value doesn't matter.
 static void             UpdateViewportsNewFrame();
+static void             UpdateViewportDrawDataDamageRects(ImGuiViewportP* viewport);
+static void             PublishDrawDataBuffer(ImGuiViewportP* viewport);
+static void             ReleaseDrawDataBufferTextures(ImGuiDrawDataBuffer* buf);
 
 }
 
@@ -1358,16 +1396,19 @@ static void             UpdateViewportsNewFrame();
 //   Change to a different context by calling ImGui::SetCurrentContext().
 // - Important: Dear ImGui functions are not thread-safe because of this pointer.
 //   If you want thread-safety to allow N threads to access N different contexts:
-//   - Change this variable to use thread local storage so each thread can refer to a different context, in your imconfig.h:
-//         struct ImGuiContext;
-//         extern thread_local ImGuiContext* MyImGuiTLS;
-//         #define GImGui MyImGuiTLS
-//     And then define MyImGuiTLS in one of your cpp files. Note that thread_local is a C++11 keyword, earlier C++ uses compiler-specific keyword.
+//   - '#define IMGUI_USE_THREAD_LOCAL_CONTEXT' in your imconfig.h to declare this variable as thread_local, so each thread refers to its own context.
+//     Call SetCurrentContext() from each thread. The few other static variables which are written to (stb_decompress state) become thread_local as well.
+//     (Before this option existed, the suggested way was to '#define GImGui MyImGuiTLS' to your own thread_local variable. This is still supported but doesn't cover stb_decompress state.)
+//   - Glyphs are baked on demand, so a font atlas shared by contexts used from different threads needs ImFontAtlas::ThreadLockFunc/ThreadUnlockFunc (see imgui.h).
+//     Otherwise, give each context its own font atlas (the default when not passing one to CreateContext()).
+//     See IMGUI_EXAMPLE_NULL_WITH_THREADS in examples/example_null/main.cpp.
+//   - Allocator functions below and ImGuiFreeType::SetAllocatorFunctions() are shared by all contexts: set them once before creating contexts.
+//   - MSVC doesn't allow thread_local variables to be exported from a DLL (C2492).
 //   - Future development aims to make this context pointer explicit to all calls. Also read https://github.com/ocornut/imgui/issues/586
 //   - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from a different namespace.
 // - DLL users: read comments above.
 #ifndef GImGui
-ImGuiContext*   GImGui = NULL;
+IM_THREAD_LOCAL ImGuiContext*   GImGui = NULL;
 #endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
@@ -1519,6 +1560,7 @@ ImGuiIO::ImGuiIO()
     DeltaTime = 1.0f / 60.0f;
     IniSavingRate = 5.0f;
     IniFilename = "imgui.ini"; // Important: "imgui.ini" is relative to current working dir, most apps will want to lock this to an absolute path (e.g. same path as executables).
+    IniUseBinaryFormat = false;
     LogFilename = "imgui_log.txt";
     UserData = NULL;
 
@@ -1547,6 +1589,7 @@ ImGuiIO::ImGuiIO()
     ConfigMacOSXBehaviors = false;
 #endif
     ConfigInputTrickleEventQueue = true;
+    ConfigInputCoalesceMouseEvents = false;
     ConfigInputTextCursorBlink = true;
     ConfigInputTextEnterKeepActive = false;
     ConfigDragClickToInputText = false;
@@ -1554,6 +1597,8 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
+    ConfigDrawDataDamageRects = false;
+    ConfigDrawDataBuffers = 0;
     ConfigMemoryCompactTimer = 60.0f;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
@@ -1585,19 +1630,112 @@ ImGuiIO::ImGuiIO()
     for (int i = 0; i < IM_ARRAYSIZE(MouseDownDuration); i++) MouseDownDuration[i] = MouseDownDurationPrev[i] = -1.0f;
     for (int i = 0; i < IM_ARRAYSIZE(KeysData); i++) { KeysData[i].DownDuration = KeysData[i].DownDurationPrev = -1.0f; }
     AppAcceptingEvents = true;
+
+    // Output
+    WantRender = true;
+    WantRenderTimeout = 0.0f;
+}
+
+// Threaded input events (see io.SetInputEventsThreaded())
+// - While enabled, all io.AddXXX() functions push into a lock-free queue, including calls made from the main thread, so ordering between threads is preserved.
+// - Events are forwarded by NewFrame() to the same QueueXXXEvent() functions used when not threaded, which apply filtering/aliasing and write into g.InputEventsQueue.
+static void QueueKeyEvent(ImGuiContext* ctx, ImGuiKey key, bool down, float analog_value);
+static void QueueMousePosEvent(ImGuiContext* ctx, float x, float y);
+static void QueueMouseButtonEvent(ImGuiContext* ctx, int mouse_button, bool down);
+static void QueueMouseWheelEvent(ImGuiContext* ctx, float wheel_x, float wheel_y);
+static void QueueFocusEvent(ImGuiContext* ctx, bool focused);
+
+static inline bool IsInputEventThreaded(ImGuiContext* ctx)
+{
+    return ctx->InputEventsThreaded.Slots.Size > 0;
+}
+
+// io.AppAcceptingEvents and io.InputQueueSurrogate are read and written by io.AddXXX() functions, which may run on any thread when threaded.
+static inline bool IsAppAcceptingEvents(ImGuiContext* ctx)
+{
+#ifdef IMGUI_ENABLE_ATOMICS
+    if (IsInputEventThreaded(ctx))
+        return ImAtomicLoad(&ctx->InputEventsThreaded.AppAcceptingEvents) != 0;
+#endif
+    return ctx->IO.AppAcceptingEvents;
+}
+
+// Store new value and return previous one.
+static ImWchar16 ExchangeInputQueueSurrogate(ImGuiContext* ctx, ImWchar16 c)
+{
+#ifdef IMGUI_ENABLE_ATOMICS
+    if (IsInputEventThreaded(ctx))
+        return (ImWchar16)ImAtomicExchange(&ctx->InputEventsThreaded.InputQueueSurrogate, c);
+#endif
+    ImWchar16 prev_c = ctx->IO.InputQueueSurrogate;
+    ctx->IO.InputQueueSurrogate = c;
+    return prev_c;
+}
+
+static void PushInputEventThreaded(ImGuiContext* ctx, ImGuiInputEvent* e)
+{
+#ifdef IMGUI_ENABLE_ATOMICS
+    ImGuiInputEventsThreadedQueue* q = &ctx->InputEventsThreaded;
+    const ImGuiMouseSource mouse_source = (ImGuiMouseSource)ImAtomicLoad(&q->NextMouseSource);
+    if (e->Type == ImGuiInputEventType_MousePos)
+        e->MousePos.MouseSource = mouse_source;
+    else if (e->Type == ImGuiInputEventType_MouseWheel)
+        e->MouseWheel.MouseSource = mouse_source;
+    else if (e->Type == ImGuiInputEventType_MouseButton)
+        e->MouseButton.MouseSource = mouse_source;
+
+    // Claim a slot
+    const ImU32 mask = (ImU32)q->Slots.Size - 1;
+    ImU32 idx = ImAtomicLoad(&q->WriteIdx);
+    ImGuiInputEventThreadedSlot* slot;
+    while (true)
+    {
+        slot = &q->Slots.Data[idx & mask];
+        const int diff = (int)(ImAtomicLoad(&slot->Sequence) - idx);
+        if (diff == 0 && ImAtomicCompareExchange(&q->WriteIdx, idx, idx + 1))
+            break;
+        if (diff < 0)
+        {
+            ImAtomicFetchAdd(&q->DroppedCount, 1); // Queue is full
+            return;
+        }
+        idx = ImAtomicLoad(&q->WriteIdx);
+    }
+
+    // Publish
+    slot->Event = *e;
+    ImAtomicStore(&slot->Sequence, idx + 1);
+#else
+    IM_UNUSED(ctx);
+    IM_UNUSED(e);
+#endif
+}
+
+static bool PopInputEventThreaded(ImGuiContext* ctx, ImGuiInputEvent* out_e)
+{
+#ifdef IMGUI_ENABLE_ATOMICS
+    ImGuiInputEventsThreadedQueue* q = &ctx->InputEventsThreaded;
+    ImGuiInputEventThreadedSlot* slot = &q->Slots.Data[q->ReadIdx & ((ImU32)q->Slots.Size - 1)];
+    if (ImAtomicLoad(&slot->Sequence) != q->ReadIdx + 1)
+        return false;
+    *out_e = slot->Event;
+    ImAtomicStore(&slot->Sequence, q->ReadIdx + (ImU32)q->Slots.Size);
+    q->ReadIdx++;
+    return true;
+#else
+    IM_UNUSED(ctx);
+    IM_UNUSED(out_e);
+    return false;
+#endif
 }
 
 // Pass in translated ASCII characters for text input.
 // - with glfw you can get those from the callback set in glfwSetCharCallback()
 // - on Windows you can get those using ToAscii+keyboard state, or via the WM_CHAR message
 // FIXME: Should in theory be called "AddCharacterEvent()" to be consistent with new API
-void ImGuiIO::AddInputCharacter(unsigned int c)
+static void QueueTextEvent(ImGuiContext* ctx, unsigned int c)
 {
-    IM_ASSERT(Ctx != NULL);
-    ImGuiContext& g = *Ctx;
-    if (c == 0 || !AppAcceptingEvents)
-        return;
-
+    ImGuiContext& g = *ctx;
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_Text;
     e.Source = ImGuiInputSource_Keyboard;
@@ -1606,23 +1744,44 @@ void ImGuiIO::AddInputCharacter(unsigned int c)
     g.InputEventsQueue.push_back(e);
 }
 
+void ImGuiIO::AddInputCharacter(unsigned int c)
+{
+    IM_ASSERT(Ctx != NULL);
+    ImGuiContext& g = *Ctx;
+    if (c == 0 || !IsAppAcceptingEvents(&g))
+        return;
+    if (IsInputEventThreaded(&g))
+    {
+        ImGuiInputEvent e;
+        e.Type = ImGuiInputEventType_Text;
+        e.Text.Char = c;
+        PushInputEventThreaded(&g, &e);
+        return;
+    }
+    QueueTextEvent(&g, c);
+}
+
 // UTF16 strings use surrogate pairs to encode codepoints >= 0x10000, so
 // we should save the high surrogate.
 void ImGuiIO::AddInputCharacterUTF16(ImWchar16 c)
 {
-    if ((c == 0 && InputQueueSurrogate == 0) || !AppAcceptingEvents)
+    IM_ASSERT(Ctx != NULL);
+    if (!IsAppAcceptingEvents(Ctx))
         return;
 
-    if ((c & 0xFC00) == 0xD800) // High surrogate, must save
+    const bool is_high_surrogate = ((c & 0xFC00) == 0xD800);
+    const ImWchar16 prev_surrogate = ExchangeInputQueueSurrogate(Ctx, is_high_surrogate ? c : 0);
+    if (is_high_surrogate) // High surrogate, must save
     {
-        if (InputQueueSurrogate != 0)
+        if (prev_surrogate != 0)
             AddInputCharacter(IM_UNICODE_CODEPOINT_INVALID);
-        InputQueueSurrogate = c;
         return;
     }
+    if (c == 0 && prev_surrogate == 0)
+        return;
 
     ImWchar cp = c;
-    if (InputQueueSurrogate != 0)
+    if (prev_surrogate != 0)
     {
         if ((c & 0xFC00) != 0xDC00) // Invalid low surrogate
         {
@@ -1633,18 +1792,17 @@ void ImGuiIO::AddInputCharacterUTF16(ImWchar16 c)
 #if IM_UNICODE_CODEPOINT_MAX == 0xFFFF
             cp = IM_UNICODE_CODEPOINT_INVALID; // Codepoint will not fit in ImWchar
 #else
-            cp = (ImWchar)(((InputQueueSurrogate - 0xD800) << 10) + (c - 0xDC00) + 0x10000);
+            cp = (ImWchar)(((prev_surrogate - 0xD800) << 10) + (c - 0xDC00) + 0x10000);
 #endif
         }
-
-        InputQueueSurrogate = 0;
     }
     AddInputCharacter((unsigned)cp);
 }
 
 void ImGuiIO::AddInputCharactersUTF8(const char* str)
 {
-    if (!AppAcceptingEvents)
+    IM_ASSERT(Ctx != NULL);
+    if (!IsAppAcceptingEvents(Ctx))
         return;
     const char* str_end = str + strlen(str);
     while (*str != 0)
@@ -1661,6 +1819,11 @@ void ImGuiIO::ClearEventsQueue()
     IM_ASSERT(Ctx != NULL);
     ImGuiContext& g = *Ctx;
     g.InputEventsQueue.clear();
+    if (IsInputEventThreaded(&g))
+    {
+        ImGuiInputEvent e;
+        while (PopInputEventThreaded(&g, &e)) {}
+    }
 }
 
 // Clear current keyboard/gamepad state + current frame text input buffer. Equivalent to releasing all keys/buttons.
@@ -1735,11 +1898,27 @@ void ImGuiIO::AddKeyAnalogEvent(ImGuiKey key, bool down, float analog_value)
 {
     //if (e->Down) { IMGUI_DEBUG_LOG_IO("AddKeyEvent() Key='%s' %d, NativeKeycode = %d, NativeScancode = %d\n", ImGui::GetKeyName(e->Key), e->Down, e->NativeKeycode, e->NativeScancode); }
     IM_ASSERT(Ctx != NULL);
-    if (key == ImGuiKey_None || !AppAcceptingEvents)
-        return;
     ImGuiContext& g = *Ctx;
+    if (key == ImGuiKey_None || !IsAppAcceptingEvents(&g))
+        return;
     IM_ASSERT(ImGui::IsNamedKeyOrMod(key)); // Backend needs to pass a valid ImGuiKey_ constant. 0..511 values are legacy native key codes which are not accepted by this API.
     IM_ASSERT(ImGui::IsAliasKey(key) == false); // Backend cannot submit ImGuiKey_MouseXXX values they are automatically inferred from AddMouseXXX() events.
+    if (IsInputEventThreaded(&g))
+    {
+        ImGuiInputEvent e;
+        e.Type = ImGuiInputEventType_Key;
+        e.Key.Key = key;
+        e.Key.Down = down;
+        e.Key.AnalogValue = analog_value;
+        PushInputEventThreaded(&g, &e);
+        return;
+    }
+    QueueKeyEvent(&g, key, down, analog_value);
+}
+
+static void QueueKeyEvent(ImGuiContext* ctx, ImGuiKey key, bool down, float analog_value)
+{
+    ImGuiContext& g = *ctx;
 
     // MacOS: swap Cmd(Super) and Ctrl
     if (g.IO.ConfigMacOSXBehaviors)
@@ -1773,7 +1952,8 @@ void ImGuiIO::AddKeyAnalogEvent(ImGuiKey key, bool down, float analog_value)
 
 void ImGuiIO::AddKeyEvent(ImGuiKey key, bool down)
 {
-    if (!AppAcceptingEvents)
+    IM_ASSERT(Ctx != NULL);
+    if (!IsAppAcceptingEvents(Ctx))
         return;
     AddKeyAnalogEvent(key, down, down ? 1.0f : 0.0f);
 }
@@ -1797,6 +1977,10 @@ void ImGuiIO::SetKeyEventNativeData(ImGuiKey key, int native_keycode, int native
 void ImGuiIO::SetAppAcceptingEvents(bool accepting_events)
 {
     AppAcceptingEvents = accepting_events;
+#ifdef IMGUI_ENABLE_ATOMICS
+    if (Ctx != NULL)
+        ImAtomicStore(&Ctx->InputEventsThreaded.AppAcceptingEvents, accepting_events ? 1 : 0);
+#endif
 }
 
 // Queue a mouse move event
@@ -1804,8 +1988,23 @@ void ImGuiIO::AddMousePosEvent(float x, float y)
 {
     IM_ASSERT(Ctx != NULL);
     ImGuiContext& g = *Ctx;
-    if (!AppAcceptingEvents)
+    if (!IsAppAcceptingEvents(&g))
+        return;
+    if (IsInputEventThreaded(&g))
+    {
+        ImGuiInputEvent e;
+        e.Type = ImGuiInputEventType_MousePos;
+        e.MousePos.PosX = x;
+        e.MousePos.PosY = y;
+        PushInputEventThreaded(&g, &e);
         return;
+    }
+    QueueMousePosEvent(&g, x, y);
+}
+
+static void QueueMousePosEvent(ImGuiContext* ctx, float x, float y)
+{
+    ImGuiContext& g = *ctx;
 
     // Apply same flooring as UpdateMouseInputs()
     ImVec2 pos((x > -FLT_MAX) ? ImFloor(x) : x, (y > -FLT_MAX) ? ImFloor(y) : y);
@@ -1816,6 +2015,16 @@ void ImGuiIO::AddMousePosEvent(float x, float y)
     if (latest_pos.x == pos.x && latest_pos.y == pos.y)
         return;
 
+    // Coalesce with latest queued event if it is also a mouse move (see io.ConfigInputCoalesceMouseEvents)
+    ImGuiInputEvent* last_event = g.InputEventsQueue.Size > 0 ? &g.InputEventsQueue.back() : NULL;
+    if (g.IO.ConfigInputCoalesceMouseEvents && last_event != NULL && last_event->Type == ImGuiInputEventType_MousePos && last_event->MousePos.MouseSource == g.InputEventsNextMouseSource)
+    {
+        last_event->EventId = g.InputEventsNextEventId++;
+        last_event->MousePos.PosX = pos.x;
+        last_event->MousePos.PosY = pos.y;
+        return;
+    }
+
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_MousePos;
     e.Source = ImGuiInputSource_Mouse;
@@ -1831,16 +2040,32 @@ void ImGuiIO::AddMouseButtonEvent(int mouse_button, bool down)
     IM_ASSERT(Ctx != NULL);
     ImGuiContext& g = *Ctx;
     IM_ASSERT(mouse_button >= 0 && mouse_button < ImGuiMouseButton_COUNT);
-    if (!AppAcceptingEvents)
+    if (!IsAppAcceptingEvents(&g))
+        return;
+    if (IsInputEventThreaded(&g))
+    {
+        ImGuiInputEvent e;
+        e.Type = ImGuiInputEventType_MouseButton;
+        e.MouseButton.Button = mouse_button;
+        e.MouseButton.Down = down;
+        PushInputEventThreaded(&g, &e);
         return;
+    }
+    QueueMouseButtonEvent(&g, mouse_button, down);
+}
+
+static void QueueMouseButtonEvent(ImGuiContext* ctx, int mouse_button, bool down)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiIO& io = g.IO;
 
     // On MacOS X: Convert Ctrl(Super)+Left click into Right-click: handle held button.
-    if (ConfigMacOSXBehaviors && mouse_button == 0 && MouseCtrlLeftAsRightClick)
+    if (io.ConfigMacOSXBehaviors && mouse_button == 0 && io.MouseCtrlLeftAsRightClick)
     {
         // Order of both statements matters: this event will still release mouse button 1
         mouse_button = 1;
         if (!down)
-            MouseCtrlLeftAsRightClick = false;
+            io.MouseCtrlLeftAsRightClick = false;
     }
 
     // Filter duplicate
@@ -1852,14 +2077,14 @@ void ImGuiIO::AddMouseButtonEvent(int mouse_button, bool down)
     // On MacOS X: Convert Ctrl(Super)+Left click into Right-click.
     // - Note that this is actual physical Ctrl which is ImGuiMod_Super for us.
     // - At this point we want from !down to down, so this is handling the initial press.
-    if (ConfigMacOSXBehaviors && mouse_button == 0 && down)
+    if (io.ConfigMacOSXBehaviors && mouse_button == 0 && down)
     {
         const ImGuiInputEvent* latest_super_event = FindLatestInputEvent(&g, ImGuiInputEventType_Key, (int)ImGuiMod_Super);
         if (latest_super_event ? latest_super_event->Key.Down : g.IO.KeySuper)
         {
             IMGUI_DEBUG_LOG_IO("[io] Super+Left Click aliased into Right Click\n");
-            MouseCtrlLeftAsRightClick = true;
-            AddMouseButtonEvent(1, true); // This is just quicker to write that passing through, as we need to filter duplicate again.
+            io.MouseCtrlLeftAsRightClick = true;
+            QueueMouseButtonEvent(&g, 1, true); // This is just quicker to write that passing through, as we need to filter duplicate again.
             return;
         }
     }
@@ -1881,8 +2106,33 @@ void ImGuiIO::AddMouseWheelEvent(float wheel_x, float wheel_y)
     ImGuiContext& g = *Ctx;
 
     // Filter duplicate (unlike most events, wheel values are relative and easy to filter)
-    if (!AppAcceptingEvents || (wheel_x == 0.0f && wheel_y == 0.0f))
+    if (!IsAppAcceptingEvents(&g) || (wheel_x == 0.0f && wheel_y == 0.0f))
+        return;
+    if (IsInputEventThreaded(&g))
+    {
+        ImGuiInputEvent e;
+        e.Type = ImGuiInputEventType_MouseWheel;
+        e.MouseWheel.WheelX = wheel_x;
+        e.MouseWheel.WheelY = wheel_y;
+        PushInputEventThreaded(&g, &e);
+        return;
+    }
+    QueueMouseWheelEvent(&g, wheel_x, wheel_y);
+}
+
+static void QueueMouseWheelEvent(ImGuiContext* ctx, float wheel_x, float wheel_y)
+{
+    ImGuiContext& g = *ctx;
+
+    // Coalesce with latest queued event if it is also a mouse wheel (see io.ConfigInputCoalesceMouseEvents)
+    ImGuiInputEvent* last_event = g.InputEventsQueue.Size > 0 ? &g.InputEventsQueue.back() : NULL;
+    if (g.IO.ConfigInputCoalesceMouseEvents && last_event != NULL && last_event->Type == ImGuiInputEventType_MouseWheel && last_event->MouseWheel.MouseSource == g.InputEventsNextMouseSource)
+    {
+        last_event->EventId = g.InputEventsNextEventId++;
+        last_event->MouseWheel.WheelX += wheel_x;
+        last_event->MouseWheel.WheelY += wheel_y;
         return;
+    }
 
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_MouseWheel;
@@ -1900,6 +2150,13 @@ void ImGuiIO::AddMouseSourceEvent(ImGuiMouseSource source)
 {
     IM_ASSERT(Ctx != NULL);
     ImGuiContext& g = *Ctx;
+#ifdef IMGUI_ENABLE_ATOMICS
+    if (IsInputEventThreaded(&g))
+    {
+        ImAtomicStore(&g.InputEventsThreaded.NextMouseSource, (ImU32)source);
+        return;
+    }
+#endif
     g.InputEventsNextMouseSource = source;
 }
 
@@ -1907,11 +2164,25 @@ void ImGuiIO::AddFocusEvent(bool focused)
 {
     IM_ASSERT(Ctx != NULL);
     ImGuiContext& g = *Ctx;
+    if (IsInputEventThreaded(&g))
+    {
+        ImGuiInputEvent e;
+        e.Type = ImGuiInputEventType_Focus;
+        e.AppFocused.Focused = focused;
+        PushInputEventThreaded(&g, &e);
+        return;
+    }
+    QueueFocusEvent(&g, focused);
+}
+
+static void QueueFocusEvent(ImGuiContext* ctx, bool focused)
+{
+    ImGuiContext& g = *ctx;
 
     // Filter duplicate
     const ImGuiInputEvent* latest_event = FindLatestInputEvent(&g, ImGuiInputEventType_Focus);
     const bool latest_focused = latest_event ? latest_event->AppFocused.Focused : !g.IO.AppFocusLost;
-    if (latest_focused == focused || (ConfigDebugIgnoreFocusLoss && !focused))
+    if (latest_focused == focused || (g.IO.ConfigDebugIgnoreFocusLoss && !focused))
         return;
 
     ImGuiInputEvent e;
@@ -1921,6 +2192,69 @@ void ImGuiIO::AddFocusEvent(bool focused)
     g.InputEventsQueue.push_back(e);
 }
 
+// Forward events submitted from any thread into g.InputEventsQueue. Called by NewFrame().
+static void ForwardInputEventsThreaded(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiInputEventsThreadedQueue* q = &g.InputEventsThreaded;
+    if (q->Slots.Size == 0)
+        return;
+    ImGuiInputEvent e;
+    while (PopInputEventThreaded(&g, &e))
+    {
+        switch (e.Type)
+        {
+        case ImGuiInputEventType_MousePos:      g.InputEventsNextMouseSource = e.MousePos.MouseSource; QueueMousePosEvent(&g, e.MousePos.PosX, e.MousePos.PosY); break;
+        case ImGuiInputEventType_MouseWheel:    g.InputEventsNextMouseSource = e.MouseWheel.MouseSource; QueueMouseWheelEvent(&g, e.MouseWheel.WheelX, e.MouseWheel.WheelY); break;
+        case ImGuiInputEventType_MouseButton:   g.InputEventsNextMouseSource = e.MouseButton.MouseSource; QueueMouseButtonEvent(&g, e.MouseButton.Button, e.MouseButton.Down); break;
+        case ImGuiInputEventType_Key:           QueueKeyEvent(&g, e.Key.Key, e.Key.Down, e.Key.AnalogValue); break;
+        case ImGuiInputEventType_Text:          QueueTextEvent(&g, e.Text.Char); break;
+        case ImGuiInputEventType_Focus:         QueueFocusEvent(&g, e.AppFocused.Focused); break;
+        default: IM_ASSERT(0); break;
+        }
+    }
+#ifdef IMGUI_ENABLE_ATOMICS
+    const ImU32 dropped_count = ImAtomicLoad(&q->DroppedCount);
+    if (dropped_count != q->DroppedCountReported)
+    {
+        IMGUI_DEBUG_LOG_IO("[io] %u input events dropped: threaded input queue is full. Increase capacity passed to io.SetInputEventsThreaded().\n", dropped_count - q->DroppedCountReported);
+        q->DroppedCountReported = dropped_count;
+    }
+#endif
+}
+
+// Switch io.AddXXX() functions to a lock-free queue so they can be called from any thread.
+// - Call from main thread while no other thread is submitting events (e.g. before starting and after stopping your input thread).
+// - Capacity is rounded up to a power of two. It should hold all events submitted during your longest frame, otherwise they are dropped.
+// - Without atomic intrinsics this asserts and stays disabled: events keep going to the regular queue, which is NOT thread-safe.
+void ImGuiIO::SetInputEventsThreaded(bool threaded, int capacity)
+{
+    IM_ASSERT(Ctx != NULL);
+    ImGuiContext& g = *Ctx;
+#ifndef IMGUI_ENABLE_ATOMICS
+    IM_ASSERT(!threaded && "Atomic intrinsics are not available with this compiler: threaded input events are not supported!");
+    IM_UNUSED(g);
+    IM_UNUSED(capacity);
+#else
+    ImGuiInputEventsThreadedQueue* q = &g.InputEventsThreaded;
+    ForwardInputEventsThreaded(&g);
+    if (q->Slots.Size > 0)
+        InputQueueSurrogate = (ImWchar16)q->InputQueueSurrogate;
+    q->Slots.clear();
+    if (!threaded)
+        return;
+    IM_ASSERT(capacity > 0);
+    q->Slots.resize(ImUpperPowerOfTwo(ImMax(capacity, 2)));
+    for (int n = 0; n < q->Slots.Size; n++)
+        q->Slots[n].Sequence = (ImU32)n;
+    q->WriteIdx = q->ReadIdx = 0;
+    q->NextMouseSource = (ImU32)g.InputEventsNextMouseSource;
+    q->AppAcceptingEvents = AppAcceptingEvents ? 1 : 0;
+    q->InputQueueSurrogate = InputQueueSurrogate;
+    InputQueueSurrogate = 0;
+#endif
+}
+
 ImGuiPlatformIO::ImGuiPlatformIO()
 {
     // Most fields are initialized with zero
@@ -2278,7 +2612,39 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
 }
 
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#if defined(IMGUI_USE_FAST_HASH) && defined(IMGUI_USE_LEGACY_CRC32_ADLER)
+#error "Cannot use both IMGUI_USE_FAST_HASH and IMGUI_USE_LEGACY_CRC32_ADLER."
+#endif
+
+#ifdef IMGUI_USE_FAST_HASH
+// Word-at-a-time hash: processes 8 bytes per step with a 64-bit multiply + xorshift, finalized with MurmurHash3's fmix64.
+// CRC32 processes 1 byte per step and has a long dependency chain (table lookup or crc32 instruction latency).
+// - Values are different from CRC32 ones: toggling IMGUI_USE_FAST_HASH invalidates .ini data referring to hashed IDs (e.g. tables settings).
+// - Words are read in native byte order: values differ between little-endian and big-endian CPUs.
+static inline ImU64 ImHashFastRead64(const unsigned char* p) { ImU64 v; memcpy(&v, p, 8); return v; }
+static inline ImU64 ImHashFastRead32(const unsigned char* p) { ImU32 v; memcpy(&v, p, 4); return v; }
+static ImGuiID ImHashFast(const unsigned char* data, size_t data_size, ImGuiID seed)
+{
+    const ImU64 k = 0x9E3779B97F4A7C15ull;
+    ImU64 h = ((ImU64)seed << 32 | seed) ^ ((ImU64)data_size * k);
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        h = (h ^ ImHashFastRead64(data)) * k;
+        h ^= h >> 32;
+    }
+    // Tail of 1-7 bytes, using fixed-size reads only (overlapping when 4-7 bytes: fine since the size was mixed in)
+    if (data_size >= 4)
+        h = (h ^ (ImHashFastRead32(data) | (ImHashFastRead32(data + data_size - 4) << 32))) * k;
+    else if (data_size > 0)
+        h = (h ^ ((ImU64)data[0] | ((ImU64)data[data_size >> 1] << 8) | ((ImU64)data[data_size - 1] << 16))) * k;
+    h ^= h >> 33; h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33; h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return (ImGuiID)h;
+}
+#endif
+
+#if !defined(IMGUI_ENABLE_SSE4_2_CRC) && !defined(IMGUI_USE_FAST_HASH)
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -2326,9 +2692,12 @@ static const ImU32 GCrc32LookupTable[256] =
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// Define IMGUI_USE_FAST_HASH to use a faster word-at-a-time hash instead of CRC32 (see above).
 ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 {
+#ifdef IMGUI_USE_FAST_HASH
+    return ImHashFast((const unsigned char*)data_p, data_size, seed);
+#else
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
     const unsigned char *data_end = (const unsigned char*)data_p + data_size;
@@ -2347,6 +2716,7 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
         crc = _mm_crc32_u8(crc, *data++);
     return ~crc;
 #endif
+#endif // #ifdef IMGUI_USE_FAST_HASH
 }
 
 // Zero-terminated string hash, with support for ### to reset back to seed value
@@ -2354,9 +2724,20 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
 {
+#ifdef IMGUI_USE_FAST_HASH
+    // Equivalent to resetting at each ### like the CRC32 loop below: only hash from the last ### onward.
+    // strlen() and memchr() are vectorized in all C libraries, and labels rarely contain '#'.
+    if (data_size == 0)
+        data_size = ImStrlen(data_p);
+    const char* data = data_p;
+    const char* data_end = data_p + data_size;
+    for (const char* p = data; (p = (const char*)ImMemchr(p, '#', (size_t)(data_end - p))) != NULL; p++)
+        if (data_end - p >= 3 && p[1] == '#' && p[2] == '#')
+            data = p;
+    return ImHashFast((const unsigned char*)data, (size_t)(data_end - data), seed);
+#else
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
@@ -2391,6 +2772,7 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
         }
     }
     return ~crc;
+#endif // #ifdef IMGUI_USE_FAST_HASH
 }
 
 // Skip to the "###" marker if any. We don't skip past to match the behavior of GetID()
@@ -2484,6 +2866,74 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+// Helper: Map file content in memory (read-only), release with ImFileUnmapFromMemory()
+// Falls back to ImFileLoadToMemory() when mapping is not available (e.g. empty file, IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS): '*out_mapped' is then false.
+const void* ImFileMapToMemory(const char* filename, size_t* out_file_size, bool* out_mapped)
+{
+    IM_ASSERT(filename && out_file_size && out_mapped);
+    *out_file_size = 0;
+    *out_mapped = false;
+#if !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && !defined(IMGUI_DISABLE_DEFAULT_FILE_MAPPING) && defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    const int filename_wsize = ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
+    ImVector<wchar_t> filename_wbuf;
+    filename_wbuf.resize(filename_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, filename_wbuf.Data, filename_wsize);
+    HANDLE file = ::CreateFileW(filename_wbuf.Data, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+    LARGE_INTEGER file_size = {};
+    HANDLE mapping = NULL;
+    void* data = NULL;
+    if (::GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 && (ImU64)file_size.QuadPart <= (ImU64)(size_t)-1)
+        mapping = ::CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping != NULL)
+    {
+        data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        ::CloseHandle(mapping); // View keeps the mapping alive
+    }
+    ::CloseHandle(file);
+    if (data != NULL)
+    {
+        *out_file_size = (size_t)file_size.QuadPart;
+        *out_mapped = true;
+        return data;
+    }
+#elif !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && !defined(IMGUI_DISABLE_DEFAULT_FILE_MAPPING) && (defined(__unix__) || defined(__APPLE__))
+    const int fd = ::open(filename, O_RDONLY);
+    if (fd == -1)
+        return NULL;
+    struct stat st;
+    void* data = MAP_FAILED;
+    if (::fstat(fd, &st) == 0 && st.st_size > 0)
+        data = ::mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // Mapping stays valid
+    if (data != MAP_FAILED)
+    {
+        *out_file_size = (size_t)st.st_size;
+        *out_mapped = true;
+        return data;
+    }
+#endif
+    return ImFileLoadToMemory(filename, "rb", out_file_size);
+}
+
+void ImFileUnmapFromMemory(const void* data, size_t data_size, bool mapped)
+{
+    IM_UNUSED(data_size);
+    if (data == NULL)
+        return;
+    if (!mapped)
+    {
+        IM_FREE((void*)data);
+        return;
+    }
+#if !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && !defined(IMGUI_DISABLE_DEFAULT_FILE_MAPPING) && defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    ::UnmapViewOfFile(data);
+#elif !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && !defined(IMGUI_DISABLE_DEFAULT_FILE_MAPPING) && (defined(__unix__) || defined(__APPLE__))
+    ::munmap((void*)data, data_size);
+#endif
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -2822,18 +3272,120 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+// Hashed storage: Data[] is in insertion order and HashIndex[] maps keys to Data[] indices using linear probing, kept at most half full.
+// Keys are often hashes already but not always (e.g. codepoints in ImFont::RemapPairs, user indices), so we scramble them first.
+static inline int ImGuiStorage_HashSlot(ImGuiID key, int mask)
+{
+    ImU32 h = key * 0x9E3779B1u;
+    return (int)((h ^ (h >> 16)) & (ImU32)mask);
+}
+
+// Return slot holding 'key', or the empty slot where it would be inserted.
+static int ImGuiStorage_HashProbe(const ImGuiStorage* storage, ImGuiID key)
+{
+    const int mask = storage->HashIndex.Size - 1;
+    int slot = ImGuiStorage_HashSlot(key, mask);
+    for (int idx; (idx = storage->HashIndex.Data[slot]) != -1; slot = (slot + 1) & mask)
+    {
+        IM_ASSERT(idx < storage->Data.Size && "Modified Data[] of a hashed ImGuiStorage without calling BuildSortByKey()?");
+        if (storage->Data.Data[idx].key == key)
+            break;
+    }
+    return slot;
+}
+
+static void ImGuiStorage_BuildHashIndex(ImGuiStorage* storage, int min_entries)
+{
+    const int capacity = ImMax(16, ImUpperPowerOfTwo(min_entries * 2));
+    storage->HashIndex.resize(capacity);
+    memset(storage->HashIndex.Data, 0xFF, (size_t)storage->HashIndex.size_in_bytes()); // -1
+    const int mask = capacity - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        int slot = ImGuiStorage_HashSlot(storage->Data[n].key, mask);
+        while (storage->HashIndex.Data[slot] != -1)
+            slot = (slot + 1) & mask;
+        storage->HashIndex.Data[slot] = n;
+    }
+}
+
+static inline ImGuiStoragePair* ImGuiStorage_Find(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImGuiStoragePair* data = const_cast<ImGuiStoragePair*>(storage->Data.Data);
+    if (storage->HashIndex.Size > 0)
+    {
+        const int idx = storage->HashIndex.Data[ImGuiStorage_HashProbe(storage, key)];
+        return (idx != -1) ? &data[idx] : NULL;
+    }
+    ImGuiStoragePair* it = ImLowerBound(data, data + storage->Data.Size, key);
+    if (it == data + storage->Data.Size || it->key != key)
+        return NULL;
+    return it;
+}
+
+// Find pair, insert 'new_pair' if missing.
+static ImGuiStoragePair* ImGuiStorage_FindOrInsert(ImGuiStorage* storage, const ImGuiStoragePair& new_pair)
+{
+    const ImGuiID key = new_pair.key;
+    if (!storage->IsHashed())
+    {
+        ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + storage->Data.Size, key);
+        if (it == storage->Data.Data + storage->Data.Size || it->key != key)
+            it = storage->Data.insert(it, new_pair);
+        return it;
+    }
+
+    int slot = (storage->HashIndex.Size > 0) ? ImGuiStorage_HashProbe(storage, key) : -1;
+    if (slot != -1 && storage->HashIndex.Data[slot] != -1)
+        return &storage->Data.Data[storage->HashIndex.Data[slot]];
+    if ((storage->Data.Size + 1) * 2 > storage->HashIndex.Size)
+    {
+        ImGuiStorage_BuildHashIndex(storage, storage->Data.Size + 1);
+        slot = ImGuiStorage_HashProbe(storage, key);
+    }
+    storage->HashIndex.Data[slot] = storage->Data.Size;
+    storage->Data.push_back(new_pair);
+    return &storage->Data.back();
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    if (IsHashed() && Data.Size > 0)
+        ImGuiStorage_BuildHashIndex(this, Data.Size);
+    else
+        HashIndex.resize(0); // Data[] may have been emptied by user: don't keep a stale index pointing into it.
+}
+
+void ImGuiStorage::SetHashed(bool hashed)
+{
+    HashMode = hashed ? +1 : -1;
+    HashIndex.clear();
+    if (hashed)
+    {
+        if (Data.Size > 0)
+            ImGuiStorage_BuildHashIndex(this, Data.Size);
+    }
+    else
+    {
+        BuildSortByKey();
+    }
+}
+
+bool ImGuiStorage::IsHashed() const
+{
+#ifdef IMGUI_USE_HASHED_STORAGE
+    return HashMode >= 0;
+#else
+    return HashMode > 0;
+#endif
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return default_val;
-    return it->val_i;
+    const ImGuiStoragePair* it = ImGuiStorage_Find(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2843,27 +3395,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return default_val;
-    return it->val_f;
+    const ImGuiStoragePair* it = ImGuiStorage_Find(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return NULL;
-    return it->val_p;
+    const ImGuiStoragePair* it = ImGuiStorage_Find(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2873,28 +3418,19 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
+// (hashed storages don't have this issue: both lookup and insertion are O(1))
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_i = val;
+    ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2904,20 +3440,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_f = val;
+    ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_p = val;
+    ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -3857,8 +4385,11 @@ void ImGui::RenderTextEllipsis(ImDrawList* draw_list, const ImVec2& pos_min, con
         const float font_size = draw_list->_Data->FontSize;
         const float font_scale = draw_list->_Data->FontScale;
         const char* text_end_ellipsis = NULL;
-        ImFontBaked* baked = font->GetFontBaked(font_size);
-        const float ellipsis_width = baked->GetCharAdvance(font->EllipsisChar) * font_scale;
+        float ellipsis_width;
+        {
+            ImFontAtlasThreadLockScope lock(font->ContainerAtlas);
+            ellipsis_width = font->GetFontBaked(font_size)->GetCharAdvance(font->EllipsisChar) * font_scale;
+        }
 
         // We can now claim the space between pos_max.x and ellipsis_max.x
         const float text_avail_width = ImMax((ImMax(pos_max.x, ellipsis_max_x) - ellipsis_width) - pos_min.x, 1.0f);
@@ -3951,6 +4482,7 @@ void ImGui::RenderMouseCursor(ImVec2 base_pos, float base_scale, ImGuiMouseCurso
     if (mouse_cursor <= ImGuiMouseCursor_None || mouse_cursor >= ImGuiMouseCursor_COUNT) // We intentionally accept out of bound values.
         mouse_cursor = ImGuiMouseCursor_Arrow;
     ImFontAtlas* font_atlas = g.DrawListSharedData.FontAtlas;
+    ImFontAtlasThreadLockScope lock(font_atlas, &g.DrawListSharedData);
     for (ImGuiViewportP* viewport : g.Viewports)
     {
         // We scale cursor with current viewport/monitor, however Windows 10 for its own hardware cursor seems to be using a different scale factor.
@@ -4174,6 +4706,8 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     NavWindowingToggleKey = ImGuiKey_None;
 
     DimBgRatio = 0.0f;
+    DrawDataBuffersCount = 0;
+    DrawDataBufferPublished = DrawDataBufferHeld = NULL;
 
     DragDropActive = DragDropWithinSource = DragDropWithinTarget = false;
     DragDropSourceFlags = ImGuiDragDropFlags_None;
@@ -4202,7 +4736,9 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     MouseCursor = ImGuiMouseCursor_Arrow;
     MouseStationaryTimer = 0.0f;
 
-    InputTextPasswordFontBackupFlags = ImFontFlags_None;
+    InputTextPasswordFontBackupFont = NULL;
+    InputTextPasswordFontBackupBaked = NULL;
+    InputTextPasswordFontBackupBakedScale = 0.0f;
     TempInputId = 0;
     memset(&DataTypeZeroValue, 0, sizeof(DataTypeZeroValue));
     BeginMenuDepth = BeginComboDepth = 0;
@@ -4229,6 +4765,9 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
 
     SettingsLoaded = false;
     SettingsDirtyTimer = 0.0f;
+    SettingsWindowsMap.SetHashed(true);
+    SettingsTablesMap.SetHashed(true);
+    SettingsBinaryDiskFilenameHash = 0;
     HookIdNext = 0;
 
     memset(LocalizationTable, 0, sizeof(LocalizationTable));
@@ -4274,6 +4813,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     FramerateSecPerFrameIdx = FramerateSecPerFrameCount = 0;
     FramerateSecPerFrameAccum = 0.0f;
     WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
+    WantRenderNextFrameDelay = FLT_MAX;
     memset(TempKeychordName, 0, sizeof(TempKeychordName));
 }
 
@@ -4292,6 +4832,8 @@ void ImGui::Initialize()
         ini_handler.ReadLineFn = WindowSettingsHandler_ReadLine;
         ini_handler.ApplyAllFn = WindowSettingsHandler_ApplyAll;
         ini_handler.WriteAllFn = WindowSettingsHandler_WriteAll;
+        ini_handler.ReadBinaryFn = WindowSettingsHandler_ReadBinary;
+        ini_handler.WriteBinaryFn = WindowSettingsHandler_WriteBinary;
         AddSettingsHandler(&ini_handler);
     }
     TableSettingsAddSettingsHandler();
@@ -4345,10 +4887,15 @@ void ImGui::Shutdown()
     IM_ASSERT_USER_ERROR(g.IO.BackendRendererUserData == NULL, "Forgot to shutdown Renderer backend?");
 
     // The fonts atlas can be used prior to calling NewFrame(), so we clear it even if g.Initialized is FALSE (which would happen if we never called NewFrame)
+    for (ImGuiDrawDataBuffer* buf : g.DrawDataBuffers)
+        ReleaseDrawDataBufferTextures(buf);
     for (ImFontAtlas* atlas : g.FontAtlases)
     {
+        ImFontAtlasThreadLock(atlas); // RefCount is shared with contexts running on other threads
         UnregisterFontAtlas(atlas);
-        if (atlas->RefCount == 0)
+        const bool atlas_unused = (atlas->RefCount == 0);
+        ImFontAtlasThreadUnlock(atlas);
+        if (atlas_unused)
         {
             atlas->Locked = false;
             IM_DELETE(atlas);
@@ -4363,6 +4910,7 @@ void ImGui::Shutdown()
     // Save settings (unless we haven't attempted to load them: CreateContext/DestroyContext without a call to NewFrame shouldn't save an empty file)
     if (g.SettingsLoaded && g.IO.IniFilename != NULL)
         SaveIniSettingsToDisk(g.IO.IniFilename);
+    SettingsBinaryWriteFinish(&g, true); // Write task may be running on another thread
 
     CallContextHooks(&g, ImGuiContextHookType_Shutdown);
 
@@ -4373,6 +4921,7 @@ void ImGui::Shutdown()
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
+    g.WindowsHitGrid.Clear();
     g.NavWindow = NULL;
     g.HoveredWindow = g.HoveredWindowUnderMovingWindow = NULL;
     g.ActiveIdWindow = NULL;
@@ -4388,6 +4937,9 @@ void ImGui::Shutdown()
     g.TreeNodeStack.clear();
 
     g.Viewports.clear_delete();
+    g.DrawDataBuffers.clear_delete();
+    g.DrawDataBuffersCount = 0;
+    g.DrawDataBufferPublished = g.DrawDataBufferHeld = NULL;
 
     g.TabBars.Clear();
     g.CurrentTabBarStack.clear();
@@ -4409,7 +4961,14 @@ void ImGui::Shutdown()
     g.InputTextDeactivatedState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsMap.Clear();
     g.SettingsHandlers.clear();
+    g.SettingsBinaryData.clear();
+    g.SettingsBinaryRecords.clear();
+    g.SettingsBinaryDiskData.clear();
+    g.SettingsBinaryWriteTask.Data.clear();
+    g.SettingsBinaryWriteTask.Filename.clear();
+    g.SettingsBinaryWriteTask.Ranges.clear();
 
     if (g.LogFile)
     {
@@ -4448,12 +5007,20 @@ void ImGui::RemoveContextHook(ImGuiContext* ctx, ImGuiID hook_id)
 
 // Call context hooks (used by e.g. test engine)
 // We assume a small number of hooks so all stored in same array
+// When IMGUI_ENABLE_PROFILER is defined, each callback is recorded as a zone: zones submitted by the callback are nested into it.
 void ImGui::CallContextHooks(ImGuiContext* ctx, ImGuiContextHookType hook_type)
 {
     ImGuiContext& g = *ctx;
+#ifdef IMGUI_ENABLE_PROFILER
+    static const char* const hook_zone_names[] = { "Hook: NewFramePre", "Hook: NewFramePost", "Hook: EndFramePre", "Hook: EndFramePost", "Hook: RenderPre", "Hook: RenderPost", "Hook: Shutdown", "Hook: PendingRemoval" };
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(hook_zone_names) == ImGuiContextHookType_PendingRemoval_ + 1);
+#endif
     for (ImGuiContextHook& hook : g.Hooks)
         if (hook.Type == hook_type)
+        {
+            IMGUI_PROFILER_ZONE_ID(hook_zone_names[hook_type], hook.HookId);
             hook.Callback(&g, &hook);
+        }
 }
 
 //-----------------------------------------------------------------------------
@@ -4799,10 +5366,16 @@ bool ImGui::IsItemHovered(ImGuiHoveredFlags flags)
         // but once unlocked on a given item we also moving.
         //if (g.HoverDelayTimer >= delay && (g.HoverDelayTimer - g.IO.DeltaTime < delay || g.MouseStationaryTimer - g.IO.DeltaTime < g.Style.HoverStationaryDelay)) { IMGUI_DEBUG_LOG("HoverDelayTimer = %f/%f, MouseStationaryTimer = %f\n", g.HoverDelayTimer, delay, g.MouseStationaryTimer); }
         if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverItemUnlockedStationaryId != hover_delay_id)
+        {
+            SetNextFrameWantRender(g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
             return false;
+        }
 
         if (g.HoverItemDelayTimer < delay)
+        {
+            SetNextFrameWantRender(delay - g.HoverItemDelayTimer);
             return false;
+        }
     }
 
     return true;
@@ -5061,6 +5634,8 @@ ImGuiPlatformIO& ImGui::GetPlatformIO(ImGuiContext* ctx)
 ImDrawData* ImGui::GetDrawData()
 {
     ImGuiContext& g = *GImGui;
+    if (g.DrawDataBufferPublished != NULL) // io.ConfigDrawDataBuffers >= 2: live draw lists have been swapped into this buffer
+        return &g.DrawDataBufferPublished->DrawData;
     ImGuiViewportP* viewport = g.Viewports[0];
     return viewport->DrawDataP.Valid ? &viewport->DrawDataP : NULL;
 }
@@ -5075,6 +5650,12 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+void ImGui::SetNextFrameWantRender(float delay)
+{
+    ImGuiContext& g = *GImGui;
+    g.WantRenderNextFrameDelay = ImMin(g.WantRenderNextFrameDelay, ImMax(delay, 0.0f));
+}
+
 static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
     // Create the draw list on demand, because they are not frequently used for all viewports
@@ -5092,6 +5673,7 @@ static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t draw
     if (viewport->BgFgDrawListsLastFrame[drawlist_no] != g.FrameCount)
     {
         draw_list->_ResetForNewFrame();
+        ImFontAtlasThreadLockScope lock(g.IO.Fonts, &g.DrawListSharedData);
         draw_list->PushTexture(g.IO.Fonts->TexRef);
         draw_list->PushClipRect(viewport->Pos, viewport->Pos + viewport->Size, false);
         viewport->BgFgDrawListsLastFrame[drawlist_no] = g.FrameCount;
@@ -5168,6 +5750,7 @@ void ImGui::StopMouseMovingWindow()
 void ImGui::UpdateMouseMovingWindowNewFrame()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateMouseMovingWindowNewFrame");
     if (g.MovingWindow != NULL)
     {
         // We actually want to move the root window. g.MovingWindow == window we clicked on (could be a child window).
@@ -5273,6 +5856,7 @@ static bool IsWindowActiveAndVisible(ImGuiWindow* window)
 void ImGui::UpdateHoveredWindowAndCaptureFlags(const ImVec2& mouse_pos)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateHoveredWindowAndCaptureFlags");
     ImGuiIO& io = g.IO;
 
     // FIXME-DPI: This storage was added on 2021/03/31 for test engine, but if we want to multiply WINDOWS_HOVER_PADDING
@@ -5388,6 +5972,11 @@ void ImGui::NewFrame()
         if (g.Hooks[n].Type == ImGuiContextHookType_PendingRemoval_)
             g.Hooks.erase(&g.Hooks[n]);
 
+#ifdef IMGUI_ENABLE_PROFILER
+    ProfilerNewFrame();
+#endif
+    IMGUI_PROFILER_ZONE("NewFrame");
+
     CallContextHooks(&g, ImGuiContextHookType_NewFramePre);
 
     // Check and assert for various common IO and Configuration mistakes
@@ -5401,6 +5990,7 @@ void ImGui::NewFrame()
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
+    g.WantRenderNextFrameDelay = FLT_MAX;
 
     // Calculate frame-rate for the user, as a purely luxurious feature
     g.FramerateSecPerFrameAccum += g.IO.DeltaTime - g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx];
@@ -5411,6 +6001,7 @@ void ImGui::NewFrame()
 
     // Process input queue (trickle as many events as possible), turn events into writes to IO structure
     g.InputEventsTrail.resize(0);
+    ForwardInputEventsThreaded(&g);
     UpdateInputEvents(g.IO.ConfigInputTrickleEventQueue);
 
     // Update viewports (after processing input queue, so io.MouseHoveredViewport is set)
@@ -5538,9 +6129,13 @@ void ImGui::NewFrame()
     // Update mouse input state
     UpdateMouseInputs();
 
-    // Mark all windows as not visible and compact unused memory.
+    // Mark all windows as not visible, update hit-test grid and compact unused memory.
     IM_ASSERT(g.WindowsFocusOrder.Size <= g.Windows.Size);
+    IMGUI_PROFILER_ZONE_BEGIN("UpdateWindows", 0);
     const float memory_compact_start_time = (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer < 0.0f) ? FLT_MAX : (float)g.Time - g.IO.ConfigMemoryCompactTimer;
+    // (active windows are registered in the hit-test grid by Begin(), or here if the grid has just been reset)
+    ImGuiWindowHitGrid* hit_grid = &g.WindowsHitGrid;
+    const bool hit_grid_reset = WindowsHitGridSetup(hit_grid, GetMainViewport()->Pos, GetMainViewport()->Size, ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding)));
     for (ImGuiWindow* window : g.Windows)
     {
         window->WasActive = window->Active;
@@ -5548,11 +6143,16 @@ void ImGui::NewFrame()
         window->WriteAccessed = false;
         window->BeginCountPreviousFrame = window->BeginCount;
         window->BeginCount = 0;
+        if (window->WasActive && hit_grid_reset)
+            WindowsHitGridUpdateWindow(hit_grid, window);
+        else if (!window->WasActive && window->HitGridGeneration == hit_grid->Generation)
+            WindowsHitGridRemoveWindow(hit_grid, window);
 
         // Garbage collect transient buffers of recently unused windows
         if (!window->WasActive && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
             GcCompactTransientWindowBuffers(window);
     }
+    IMGUI_PROFILER_ZONE_END();
 
     // Find hovered window
     // (needs to be before UpdateMouseMovingWindowNewFrame so we fill g.HoveredWindowUnderMovingWindow on the mouse release frame)
@@ -5658,6 +6258,7 @@ static int IMGUI_CDECL ChildWindowComparer(const void* lhs, const void* rhs)
 
 static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
 {
+    window->DisplayIndexCached = out_sorted_windows->Size;
     out_sorted_windows->push_back(window);
     if (window->Active)
     {
@@ -5732,37 +6333,333 @@ static void InitViewportDrawData(ImGuiViewportP* viewport)
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
     draw_data->OwnerViewport = viewport;
     draw_data->Textures = &ImGui::GetPlatformIO().Textures;
+    draw_data->DamageRects.resize(0);
+    draw_data->DamageRectsValid = false;
 }
 
-// Push a clipping rectangle for both ImGui logic (hit-testing etc.) and low-level ImDrawList rendering.
-// - When using this function it is sane to ensure that float are perfectly rounded to integer values,
-//   so that e.g. (int)(max.x-min.x) in user's render produce correct result.
-// - If the code here changes, may need to update code of functions like NextColumn() and PushColumnClipRect():
-//   some frequently called functions which to modify both channels and clipping simultaneously tend to use the
-//   more specialized SetWindowClipRectBeforeSetChannel() to avoid extraneous updates of underlying ImDrawCmds.
-// - This is analogous to PushFont()/PopFont() in the sense that are a mixing a global stack and a window stack,
-//   which in the case of ClipRect is not so problematic but tends to be more restrictive for fonts.
-void ImGui::PushClipRect(const ImVec2& clip_rect_min, const ImVec2& clip_rect_max, bool intersect_with_current_clip_rect)
+// Compute ImDrawData::DamageRects[] by comparing draw lists with the ones rendered by the previous Render() call (see io.ConfigDrawDataDamageRects)
+// - A draw list is damaged when it is new, when its contents or bounds changed, or when it moved above a draw list it was previously below.
+// - A draw list which isn't rendered anymore damages its previous bounds.
+// - Bounds are the union of vertices extents clipped by their command clip rectangle.
+//   Draw lists using user callbacks are always damaged (with their clip rectangle) as we cannot know what they render.
+// - The whole display is damaged on first use, when display rectangle or framebuffer scale changed, or when a texture is (re)created.
+//   Contents changes of your own textures (ImTextureID) are not tracked.
+static void ImGui::UpdateViewportDrawDataDamageRects(ImGuiViewportP* viewport)
 {
-    ImGuiWindow* window = GetCurrentWindow();
-    window->DrawList->PushClipRect(clip_rect_min, clip_rect_max, intersect_with_current_clip_rect);
-    window->ClipRect = window->DrawList->_ClipRectStack.back();
-}
+    ImGuiContext& g = *GImGui;
+    ImDrawData* draw_data = &viewport->DrawDataP;
+    ImDrawDataBuilder* builder = &viewport->DrawDataBuilder;
+    const ImRect display_rect = viewport->GetMainRect();
 
-void ImGui::PopClipRect()
-{
-    ImGuiWindow* window = GetCurrentWindow();
-    window->DrawList->PopClipRect();
-    window->ClipRect = window->DrawList->_ClipRectStack.back();
-}
+    bool full_damage = !builder->DamageEntriesValid || builder->DamageDisplayRect.ToVec4() != display_rect.ToVec4() || builder->DamageFramebufferScale != draw_data->FramebufferScale;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures)
+        for (ImTextureData* tex : g.PlatformIO.Textures)
+            if (tex->Status == ImTextureStatus_WantCreate)
+                full_damage = true;
+
+    ImVector<ImDrawDataDamageEntry>& prev_entries = builder->DamageEntries;
+    ImVector<ImDrawDataDamageEntry>& curr_entries = builder->DamageEntriesTemp;
+    ImVector<ImRect>& damage_rects = builder->DamageRectsTemp;
+    curr_entries.resize(draw_data->CmdLists.Size);
+    damage_rects.resize(0);
+    int prev_idx_max = -1;
+    for (int draw_list_n = 0; draw_list_n < draw_data->CmdLists.Size; draw_list_n++)
+    {
+        ImDrawList* draw_list = draw_data->CmdLists[draw_list_n];
+        bool has_callbacks = false;
+        ImGuiID hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+        hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+        ImRect bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            if (cmd.UserCallback != NULL)
+                has_callbacks |= (cmd.UserCallback != ImDrawCallback_ResetRenderState);
+            else if (cmd.ElemCount == 0)
+                continue;
+            const ImU32 cmd_offsets[3] = { cmd.VtxOffset, cmd.IdxOffset, cmd.ElemCount };
+            hash = ImHashData(&cmd.ClipRect, sizeof(cmd.ClipRect), hash);
+            hash = ImHashData(&cmd.TexRef, sizeof(cmd.TexRef), hash);
+            hash = ImHashData(cmd_offsets, sizeof(cmd_offsets), hash);
+            if (cmd.UserCallback != NULL)
+            {
+                bounds.Add(ImRect(cmd.ClipRect));
+                continue;
+            }
+            ImRect cmd_bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+            const ImDrawVert* vtx = draw_list->VtxBuffer.Data + cmd.VtxOffset;
+            const ImDrawIdx* idx = draw_list->IdxBuffer.Data + cmd.IdxOffset;
+            for (unsigned int idx_n = 0; idx_n < cmd.ElemCount; idx_n++)
+                cmd_bounds.Add(vtx[idx[idx_n]].pos);
+            cmd_bounds.ClipWithFull(ImRect(cmd.ClipRect));
+            bounds.Add(cmd_bounds);
+        }
+        bounds.ClipWithFull(display_rect);
 
-static void ImGui::RenderDimmedBackgroundBehindWindow(ImGuiWindow* window, ImU32 col)
-{
-    if ((col & IM_COL32_A_MASK) == 0)
-        return;
+        ImDrawDataDamageEntry* entry = &curr_entries[draw_list_n];
+        entry->DrawList = draw_list;
+        entry->Hash = hash;
+        entry->Bounds = bounds;
+        if (full_damage)
+            continue;
 
-    ImGuiViewportP* viewport = (ImGuiViewportP*)GetMainViewport();
-    ImRect viewport_rect = viewport->GetMainRect();
+        // Find same draw list in previous frame (most often at the same index)
+        int prev_idx = (draw_list_n < prev_entries.Size && prev_entries[draw_list_n].DrawList == draw_list) ? draw_list_n : builder->DamageEntriesMap.GetInt(ImHashData(&draw_list, sizeof(draw_list)), -1);
+        ImDrawDataDamageEntry* prev_entry = (prev_idx != -1 && prev_entries[prev_idx].DrawList == draw_list) ? &prev_entries[prev_idx] : NULL;
+        if (prev_entry == NULL || has_callbacks || prev_entry->Hash != hash || prev_entry->Bounds.ToVec4() != bounds.ToVec4() || prev_idx < prev_idx_max)
+        {
+            if (!bounds.IsInverted() && bounds.GetArea() > 0.0f)
+                damage_rects.push_back(bounds);
+            if (prev_entry != NULL && prev_entry->Bounds.ToVec4() != bounds.ToVec4() && prev_entry->Bounds.GetArea() > 0.0f)
+                damage_rects.push_back(prev_entry->Bounds);
+        }
+        if (prev_entry != NULL)
+        {
+            prev_idx_max = ImMax(prev_idx_max, prev_idx);
+            prev_entry->DrawList = NULL; // Mark as matched
+        }
+    }
+
+    // Draw lists not rendered anymore
+    if (!full_damage)
+        for (const ImDrawDataDamageEntry& prev_entry : prev_entries)
+            if (prev_entry.DrawList != NULL && !prev_entry.Bounds.IsInverted() && prev_entry.Bounds.GetArea() > 0.0f)
+                damage_rects.push_back(prev_entry.Bounds);
+
+    // Merge overlapping rectangles in-place, fallback to a single bounding rectangle when there are too many.
+    // - Merged rectangles are stored in damage_rects[0..merged_count), which never exceeds DRAW_DATA_DAMAGE_RECTS_MAX + 1,
+    //   so each source rectangle is tested against a bounded amount of rectangles: this is O(N) regardless of input size.
+    // - Entries in damage_rects[merged_count..src_n) are stale but always contained in a merged rectangle.
+    int merged_count = 0;
+    for (int src_n = 0; src_n < damage_rects.Size && merged_count <= DRAW_DATA_DAMAGE_RECTS_MAX; src_n++)
+    {
+        ImRect r = damage_rects[src_n];
+        for (int dst_n = merged_count - 1; dst_n >= 0; dst_n--)
+            if (damage_rects[dst_n].Overlaps(r))
+            {
+                r.Add(damage_rects[dst_n]);
+                damage_rects[dst_n] = damage_rects[--merged_count];
+                dst_n = merged_count; // Grown rectangle may now overlap ones we already tested
+            }
+        damage_rects[merged_count++] = r;
+    }
+    if (merged_count > DRAW_DATA_DAMAGE_RECTS_MAX)
+    {
+        for (int n = 1; n < damage_rects.Size; n++)
+            damage_rects[0].Add(damage_rects[n]);
+        merged_count = 1;
+    }
+    damage_rects.resize(merged_count);
+    if (full_damage)
+        damage_rects.push_back(display_rect);
+    draw_data->DamageRects.resize(damage_rects.Size);
+    for (int n = 0; n < damage_rects.Size; n++)
+        draw_data->DamageRects[n] = damage_rects[n].ToVec4();
+    draw_data->DamageRectsValid = true;
+
+    // Store for next frame
+    prev_entries.swap(curr_entries);
+    builder->DamageEntriesMap.Data.resize(0);
+    for (int n = 0; n < prev_entries.Size; n++)
+        builder->DamageEntriesMap.Data.push_back(ImGuiStoragePair(ImHashData(&prev_entries[n].DrawList, sizeof(ImDrawList*)), n));
+    builder->DamageEntriesMap.BuildSortByKey();
+    builder->DamageDisplayRect = display_rect;
+    builder->DamageFramebufferScale = draw_data->FramebufferScale;
+    builder->DamageEntriesValid = true;
+}
+
+// Release font atlas textures held by a buffer which is not used by render thread anymore (Free or Writing state), so they may be destroyed.
+static void ImGui::ReleaseDrawDataBufferTextures(ImGuiDrawDataBuffer* buf)
+{
+    for (ImGuiDrawDataBufferTexture& held : buf->TexturesInUse)
+    {
+        ImFontAtlasThreadLockScope lock(held.Atlas);
+        IM_ASSERT(held.Tex->UseCount > 0);
+        held.Tex->UseCount--;
+    }
+    buf->TexturesInUse.resize(0);
+}
+
+// Publish draw data into a buffer for a render thread (see io.ConfigDrawDataBuffers, AcquireDrawData())
+// - Buffer states: Free -> Writing (Render) -> Published (Render) -> Held (AcquireDrawData) -> Free (ReleaseDrawData or next AcquireDrawData).
+// - A published buffer not acquired by the time next one is published is outdated and goes back to Free.
+// - With 2 buffers, when render thread holds one, the outdated published one is reused directly.
+// - Font atlas textures referenced by the context (including ones replaced during the frame, e.g. after the atlas texture grew) are held by
+//   the buffer until it is Free again, so render thread may use a buffer while main thread requested destruction of textures it references.
+static void ImGui::PublishDrawDataBuffer(ImGuiViewportP* viewport)
+{
+    ImGuiContext& g = *GImGui;
+#ifdef IMGUI_ENABLE_ATOMICS
+    if (g.DrawDataBuffers.Size == 0)
+    {
+        IM_ASSERT(g.IO.ConfigDrawDataBuffers >= 2 && g.IO.ConfigDrawDataBuffers <= 8 && "io.ConfigDrawDataBuffers should be 0 (disabled), 2 (double buffering) or 3 (triple buffering).");
+        if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures)
+            for (ImFontAtlas* atlas : g.FontAtlases)
+                IM_ASSERT(atlas->ThreadLockFunc != NULL && "io.ConfigDrawDataBuffers requires ImFontAtlas::ThreadLockFunc/ThreadUnlockFunc, held by render thread while updating textures.");
+        for (int n = 0; n < g.IO.ConfigDrawDataBuffers; n++)
+            g.DrawDataBuffers.push_back(IM_NEW(ImGuiDrawDataBuffer)());
+        ImAtomicStore(&g.DrawDataBuffersCount, (ImU32)g.DrawDataBuffers.Size);
+    }
+    IM_ASSERT(g.DrawDataBuffers.Size == g.IO.ConfigDrawDataBuffers && "io.ConfigDrawDataBuffers cannot be changed after first Render()!");
+
+    // Release textures held by buffers which render thread doesn't use anymore (render thread never changes state of a Free buffer)
+    for (ImGuiDrawDataBuffer* candidate : g.DrawDataBuffers)
+        if (candidate->TexturesInUse.Size > 0 && ImAtomicLoad(&candidate->State) == ImGuiDrawDataBufferState_Free)
+            ReleaseDrawDataBufferTextures(candidate);
+
+    // Find a buffer to write into. Fails only while render thread is swapping buffers in AcquireDrawData().
+    ImGuiDrawDataBuffer* buf = NULL;
+    while (buf == NULL)
+    {
+        for (ImGuiDrawDataBuffer* candidate : g.DrawDataBuffers)
+            if (ImAtomicCompareExchange(&candidate->State, ImGuiDrawDataBufferState_Free, ImGuiDrawDataBufferState_Writing))
+            {
+                buf = candidate;
+                break;
+            }
+        if (buf == NULL && g.DrawDataBufferPublished != NULL && ImAtomicCompareExchange(&g.DrawDataBufferPublished->State, ImGuiDrawDataBufferState_Published, ImGuiDrawDataBufferState_Writing))
+            buf = g.DrawDataBufferPublished;
+        if (buf == NULL)
+            std::this_thread::yield(); // Let render thread finish AcquireDrawData()
+    }
+
+    // Swap buffers of live draw lists with buffers owned by 'buf' (matched by live draw list pointer, so capacities match)
+    ImDrawData* src = &viewport->DrawDataP;
+    ImDrawData* dst = &buf->DrawData;
+    dst->Valid = src->Valid;
+    dst->CmdListsCount = src->CmdListsCount;
+    dst->TotalIdxCount = src->TotalIdxCount;
+    dst->TotalVtxCount = src->TotalVtxCount;
+    dst->DisplayPos = src->DisplayPos;
+    dst->DisplaySize = src->DisplaySize;
+    dst->FramebufferScale = src->FramebufferScale;
+    dst->OwnerViewport = src->OwnerViewport;
+    if (src->Textures != NULL)
+    {
+        buf->Textures = *src->Textures;
+        dst->Textures = &buf->Textures;
+    }
+    else
+    {
+        dst->Textures = NULL;
+    }
+    dst->DamageRects.swap(src->DamageRects);
+    dst->DamageRectsValid = src->DamageRectsValid;
+    dst->CmdLists.resize(src->CmdLists.Size);
+    for (int n = 0; n < src->CmdLists.Size; n++)
+    {
+        ImDrawList* src_list = src->CmdLists[n];
+        const ImGuiID key = ImHashData(&src_list, sizeof(src_list));
+        int dst_list_idx = buf->DrawListsMap.GetInt(key, -1);
+        if (dst_list_idx == -1)
+        {
+            dst_list_idx = buf->DrawLists.Size;
+            buf->DrawLists.push_back(IM_NEW(ImDrawList)(NULL)); // Not registered into shared data, which is iterated by font atlas updates on main thread
+            buf->DrawListsLastFrame.push_back(g.FrameCount);
+            buf->DrawListsMap.SetInt(key, dst_list_idx);
+        }
+        ImDrawList* dst_list = buf->DrawLists[dst_list_idx];
+        dst_list->CmdBuffer.swap(src_list->CmdBuffer);
+        dst_list->IdxBuffer.swap(src_list->IdxBuffer);
+        dst_list->VtxBuffer.swap(src_list->VtxBuffer);
+        dst_list->_CallbacksDataBuf.swap(src_list->_CallbacksDataBuf); // ImDrawCmd::UserCallbackData may point inside
+        dst_list->Flags = src_list->Flags;
+        buf->DrawListsLastFrame[dst_list_idx] = g.FrameCount;
+        dst->CmdLists[n] = dst_list;
+    }
+
+    // Free buffers of draw lists which haven't been published for a while (e.g. closed windows)
+    for (int n = 0; n < buf->DrawLists.Size; n++)
+        if (buf->DrawListsLastFrame[n] < g.FrameCount - 60 && buf->DrawLists[n]->VtxBuffer.Capacity > 0)
+            buf->DrawLists[n]->_ClearFreeMemory();
+
+    // Hold font atlas textures which may be referenced by draw commands (see ImFontAtlasAcquireTexturesInUse())
+    ReleaseDrawDataBufferTextures(buf);
+    for (ImFontAtlas* atlas : g.FontAtlases)
+    {
+        ImFontAtlasThreadLockScope lock(atlas);
+        for (ImTextureData* tex : g.DrawListSharedData.TexturesInUse)
+            if (atlas->TexList.contains(tex))
+            {
+                ImGuiDrawDataBufferTexture held = { atlas, tex };
+                buf->TexturesInUse.push_back(held);
+                tex->UseCount++;
+            }
+    }
+
+    // Publish, then release previous published buffer if it wasn't acquired
+    buf->FrameCount = g.FrameCount;
+    ImAtomicStore(&buf->State, ImGuiDrawDataBufferState_Published);
+    if (g.DrawDataBufferPublished != NULL && g.DrawDataBufferPublished != buf)
+        ImAtomicCompareExchange(&g.DrawDataBufferPublished->State, ImGuiDrawDataBufferState_Published, ImGuiDrawDataBufferState_Free);
+    g.DrawDataBufferPublished = buf;
+#else
+    IM_UNUSED(viewport);
+    IM_ASSERT(g.IO.ConfigDrawDataBuffers == 0 && "Atomic intrinsics are not available with this compiler!");
+#endif
+}
+
+// Call from your render thread (see io.ConfigDrawDataBuffers). Thread-safe with Render() running on main thread.
+// - Returns latest draw data published by Render(), or the one already held if nothing new was published. NULL if nothing was ever published.
+// - The returned draw data is held (not written to by Render()) until next call to AcquireDrawData() or ReleaseDrawData().
+ImDrawData* ImGui::AcquireDrawData(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+#ifdef IMGUI_ENABLE_ATOMICS
+    const int buffers_count = (int)ImAtomicLoad(&g.DrawDataBuffersCount);
+    for (int n = 0; n < buffers_count; n++)
+    {
+        ImGuiDrawDataBuffer* buf = g.DrawDataBuffers.Data[n];
+        if (ImAtomicCompareExchange(&buf->State, ImGuiDrawDataBufferState_Published, ImGuiDrawDataBufferState_Held))
+        {
+            if (g.DrawDataBufferHeld != NULL)
+                ImAtomicStore(&g.DrawDataBufferHeld->State, ImGuiDrawDataBufferState_Free);
+            g.DrawDataBufferHeld = buf;
+            break;
+        }
+    }
+#endif
+    return g.DrawDataBufferHeld ? &g.DrawDataBufferHeld->DrawData : NULL;
+}
+
+void ImGui::ReleaseDrawData(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+#ifdef IMGUI_ENABLE_ATOMICS
+    if (g.DrawDataBufferHeld != NULL)
+        ImAtomicStore(&g.DrawDataBufferHeld->State, ImGuiDrawDataBufferState_Free);
+#endif
+    g.DrawDataBufferHeld = NULL;
+}
+
+// Push a clipping rectangle for both ImGui logic (hit-testing etc.) and low-level ImDrawList rendering.
+// - When using this function it is sane to ensure that float are perfectly rounded to integer values,
+//   so that e.g. (int)(max.x-min.x) in user's render produce correct result.
+// - If the code here changes, may need to update code of functions like NextColumn() and PushColumnClipRect():
+//   some frequently called functions which to modify both channels and clipping simultaneously tend to use the
+//   more specialized SetWindowClipRectBeforeSetChannel() to avoid extraneous updates of underlying ImDrawCmds.
+// - This is analogous to PushFont()/PopFont() in the sense that are a mixing a global stack and a window stack,
+//   which in the case of ClipRect is not so problematic but tends to be more restrictive for fonts.
+void ImGui::PushClipRect(const ImVec2& clip_rect_min, const ImVec2& clip_rect_max, bool intersect_with_current_clip_rect)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    window->DrawList->PushClipRect(clip_rect_min, clip_rect_max, intersect_with_current_clip_rect);
+    window->ClipRect = window->DrawList->_ClipRectStack.back();
+}
+
+void ImGui::PopClipRect()
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    window->DrawList->PopClipRect();
+    window->ClipRect = window->DrawList->_ClipRectStack.back();
+}
+
+static void ImGui::RenderDimmedBackgroundBehindWindow(ImGuiWindow* window, ImU32 col)
+{
+    if ((col & IM_COL32_A_MASK) == 0)
+        return;
+
+    ImGuiViewportP* viewport = (ImGuiViewportP*)GetMainViewport();
+    ImRect viewport_rect = viewport->GetMainRect();
 
     // Draw behind window by moving the draw command at the FRONT of the draw list
     {
@@ -5838,10 +6735,79 @@ static void ImGui::RenderDimmedBackgrounds()
     }
 }
 
+// Update io.WantRender and io.WantRenderTimeout, so the application can skip frames and block on inputs while idle.
+// - We need a new frame if inputs are pending or have just been processed (a frame is needed to settle most of their side effects).
+// - We need a new frame if an interaction, animation or layout is in progress (held inputs, active item, fades, windows auto-fitting or appearing).
+// - Timers (e.g. hover delays, text cursor blinking) call SetNextFrameWantRender() with the remaining time when they are polled.
+// - Windows skipping their refresh (see SetNextWindowRefreshPolicy()) haven't submitted contents this frame and are not checked for layout changes.
+static void ImGui::UpdateWantRenderEndFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    float delay = g.WantRenderNextFrameDelay;
+
+    // Inputs
+    if (g.InputEventsQueue.Size > 0 || g.InputEventsTrail.Size > 0 || IsAnyMouseDown())
+        delay = 0.0f;
+    for (int key_n = 0; key_n < ImGuiKey_NamedKey_COUNT && delay > 0.0f; key_n++)
+    {
+        const ImGuiKey key = (ImGuiKey)(key_n + ImGuiKey_NamedKey_BEGIN);
+        if (io.KeysData[key_n].Down && !IsLRModKey(key) && key < ImGuiKey_ReservedForModCtrl) // Held keys may repeat
+            delay = 0.0f;
+    }
+
+    // Interactions
+    if (g.ActiveId != 0 && g.ActiveId != g.InputTextState.ID) // Active InputText() requests its own cursor blinking
+        delay = 0.0f;
+    if (g.MovingWindow != NULL || g.DragDropActive || g.NavWindowingTarget != NULL || g.NavInitRequest || g.NavMoveSubmitted || g.NavMoveForwardToNextFrame || g.NavNextActivateId != 0 || g.NavCursorHideFrames > 0)
+        delay = 0.0f;
+
+    // Animations and timers
+    const bool want_dim_bg = (GetTopMostPopupModal() != NULL || (g.NavWindowingTarget != NULL && g.NavWindowingHighlightAlpha > 0.0f));
+    if ((want_dim_bg ? g.DimBgRatio < 1.0f : g.DimBgRatio > 0.0f) || g.NavWindowingHighlightAlpha > 0.0f)
+        delay = 0.0f;
+    if (g.NavHighlightActivatedTimer > 0.0f)
+        delay = ImMin(delay, g.NavHighlightActivatedTimer);
+    if (g.WheelingWindowReleaseTimer > 0.0f)
+        delay = ImMin(delay, g.WheelingWindowReleaseTimer);
+    if (g.SettingsDirtyTimer > 0.0f)
+        delay = ImMin(delay, g.SettingsDirtyTimer);
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (g.DebugFlashStyleColorTime > 0.0f || g.DebugItemPickerActive)
+        delay = 0.0f;
+#endif
+    if (io.MouseDrawCursor && (g.MouseCursor == ImGuiMouseCursor_Wait || g.MouseCursor == ImGuiMouseCursor_Progress)) // Animated by RenderMouseCursor()
+        delay = 0.0f;
+
+    // Windows settling over multiple frames
+    for (int window_n = 0; window_n < g.Windows.Size && delay > 0.0f; window_n++)
+    {
+        ImGuiWindow* window = g.Windows[window_n];
+        if (!window->Active || window->SkipRefresh)
+            continue;
+        if (window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesForRenderOnly > 0)
+            delay = 0.0f;
+        else if (window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX)
+            delay = 0.0f;
+        else
+        {
+            // Contents size changed: next frame will update auto-fit size, scrollbars etc.
+            ImVec2 content_size, content_size_ideal;
+            CalcWindowContentSizes(window, &content_size, &content_size_ideal);
+            if (content_size.x != window->ContentSize.x || content_size.y != window->ContentSize.y || content_size_ideal.x != window->ContentSizeIdeal.x || content_size_ideal.y != window->ContentSizeIdeal.y)
+                delay = 0.0f;
+        }
+    }
+
+    io.WantRender = (delay <= 0.0f);
+    io.WantRenderTimeout = io.WantRender ? 0.0f : (delay == FLT_MAX) ? FLT_MAX : delay + WANT_RENDER_TIMEOUT_MARGIN;
+}
+
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("EndFrame");
     IM_ASSERT(g.Initialized);
 
     // Don't process EndFrame() multiple times.
@@ -5927,10 +6893,12 @@ void ImGui::EndFrame()
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     UpdateTexturesEndFrame();
+    UpdateWantRenderEndFrame();
 
     // Unlock font atlas
     for (ImFontAtlas* atlas : g.FontAtlases)
-        atlas->Locked = false;
+        if (atlas->Locked)
+            atlas->Locked = false;
 
     // Clear Input data for next frame
     g.IO.MousePosPrev = g.IO.MousePos;
@@ -5947,6 +6915,7 @@ void ImGui::EndFrame()
 void ImGui::Render()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("Render");
     IM_ASSERT(g.Initialized);
 
     if (g.FrameCountEnded != g.FrameCount)
@@ -6005,14 +6974,25 @@ void ImGui::Render()
 
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
+
+        if (g.IO.ConfigDrawDataDamageRects)
+            UpdateViewportDrawDataDamageRects(viewport);
+        else
+            viewport->DrawDataBuilder.DamageEntriesValid = false;
     }
 
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures)
         for (ImFontAtlas* atlas : g.FontAtlases)
+        {
+            ImFontAtlasThreadLockScope lock(atlas);
             ImFontAtlasDebugLogTextureRequests(atlas);
+        }
 #endif
 
+    if (g.IO.ConfigDrawDataBuffers > 0 || g.DrawDataBuffers.Size > 0)
+        PublishDrawDataBuffer(g.Viewports[0]);
+
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
 
@@ -6044,12 +7024,122 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     return text_size;
 }
 
+// Windows hit-test grid (see ImGuiWindowHitGrid)
+// - Reset when the covered area or padding changes, or when there are more stale entries than live ones.
+//   Return true on reset: NewFrame() then re-registers every active window, so the grid is complete by the time FindHoveredWindowEx() is called.
+static bool WindowsHitGridSetup(ImGuiWindowHitGrid* grid, const ImVec2& pos, const ImVec2& size, const ImVec2& padding)
+{
+    const int cells_x = ImMax((int)ImCeil(size.x / WINDOWS_HIT_GRID_CELL_SIZE), 1);
+    const int cells_y = ImMax((int)ImCeil(size.y / WINDOWS_HIT_GRID_CELL_SIZE), 1);
+    const bool compact = (grid->EntriesStaleCount > 1024 && grid->EntriesStaleCount * 2 > grid->EntriesCount);
+    if (!compact && grid->Rect.Min == pos && grid->Rect.Max == pos + size && grid->Padding == padding && grid->CellsX == cells_x && grid->CellsY == cells_y)
+        return false;
+    if (grid->Cells.Size != cells_x * cells_y)
+    {
+        grid->Clear();
+        grid->Cells.resize(cells_x * cells_y, ImVector<ImGuiWindow*>());
+    }
+    for (ImVector<ImGuiWindow*>& cell : grid->Cells)
+        cell.resize(0);
+    grid->Rect = ImRect(pos, pos + size);
+    grid->Padding = padding;
+    grid->CellsX = cells_x;
+    grid->CellsY = cells_y;
+    grid->Generation++;
+    grid->EntriesCount = grid->EntriesStaleCount = 0;
+    return true;
+}
+
+// Clamping to border cells keeps the mapping monotonic, so a position inside a rectangle always maps to a cell covered by that rectangle.
+static ImVec2ih WindowsHitGridGetCellAt(const ImGuiWindowHitGrid* grid, const ImVec2& pos)
+{
+    const float x = ImClamp((pos.x - grid->Rect.Min.x) * (1.0f / WINDOWS_HIT_GRID_CELL_SIZE), 0.0f, (float)(grid->CellsX - 1));
+    const float y = ImClamp((pos.y - grid->Rect.Min.y) * (1.0f / WINDOWS_HIT_GRID_CELL_SIZE), 0.0f, (float)(grid->CellsY - 1));
+    return ImVec2ih((short)x, (short)y);
+}
+
+static int WindowsHitGridCalcCellsCount(const ImVec2ih& cell_min, const ImVec2ih& cell_max)
+{
+    return ImMax(cell_max.x - cell_min.x + 1, 0) * ImMax(cell_max.y - cell_min.y + 1, 0);
+}
+
+// Called when a window stops being active: remove it from the cells it currently covers.
+static void WindowsHitGridRemoveWindow(ImGuiWindowHitGrid* grid, ImGuiWindow* window)
+{
+    IM_ASSERT(window->HitGridGeneration == grid->Generation);
+    for (int y = window->HitGridCellMin.y; y <= window->HitGridCellMax.y; y++)
+        for (int x = window->HitGridCellMin.x; x <= window->HitGridCellMax.x; x++)
+        {
+            ImVector<ImGuiWindow*>& cell = grid->Cells[y * grid->CellsX + x];
+            ImGuiWindow** it = cell.find(window);
+            IM_ASSERT(it != cell.end());
+            *it = cell.back();
+            cell.pop_back();
+        }
+    grid->EntriesCount -= WindowsHitGridCalcCellsCount(window->HitGridCellMin, window->HitGridCellMax);
+    window->HitGridGeneration = 0;
+}
+
+// Register window in the cells covered by its OuterRectClipped + padding. Empty (inverted) rectangles cover no cell.
+// When the window moves we only add it to newly covered cells: searching and removing it from the others is left to the next reset.
+static void WindowsHitGridUpdateWindow(ImGuiWindowHitGrid* grid, ImGuiWindow* window)
+{
+    const ImVec2ih cell_min = WindowsHitGridGetCellAt(grid, window->OuterRectClipped.Min - grid->Padding);
+    const ImVec2ih cell_max = WindowsHitGridGetCellAt(grid, window->OuterRectClipped.Max + grid->Padding);
+    ImVec2ih prev_min(0, 0), prev_max(-1, -1);
+    if (window->HitGridGeneration == grid->Generation)
+    {
+        prev_min = window->HitGridCellMin;
+        prev_max = window->HitGridCellMax;
+        if (prev_min.x == cell_min.x && prev_min.y == cell_min.y && prev_max.x == cell_max.x && prev_max.y == cell_max.y)
+            return;
+    }
+    for (int y = cell_min.y; y <= cell_max.y; y++)
+        for (int x = cell_min.x; x <= cell_max.x; x++)
+            if (x < prev_min.x || x > prev_max.x || y < prev_min.y || y > prev_max.y)
+                grid->Cells[y * grid->CellsX + x].push_back(window);
+    const ImVec2ih overlap_min(ImMax(cell_min.x, prev_min.x), ImMax(cell_min.y, prev_min.y));
+    const ImVec2ih overlap_max(ImMin(cell_max.x, prev_max.x), ImMin(cell_max.y, prev_max.y));
+    const int overlap_count = WindowsHitGridCalcCellsCount(overlap_min, overlap_max);
+    grid->EntriesCount += WindowsHitGridCalcCellsCount(cell_min, cell_max) - overlap_count;
+    grid->EntriesStaleCount += WindowsHitGridCalcCellsCount(prev_min, prev_max) - overlap_count;
+    window->HitGridGeneration = grid->Generation;
+    window->HitGridCellMin = cell_min;
+    window->HitGridCellMax = cell_max;
+}
+
+static bool IsWindowHitByPos(ImGuiWindow* window, const ImVec2& pos, const ImVec2& padding_regular, const ImVec2& padding_for_resize)
+{
+    IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
+    if (!window->WasActive || window->Hidden)
+        return false;
+    if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+        return false;
+
+    // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
+    ImVec2 hit_padding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? padding_regular : padding_for_resize;
+    if (!window->OuterRectClipped.ContainsWithPad(pos, hit_padding))
+        return false;
+
+    // Support for one rectangular hole in any given window
+    // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
+    if (window->HitTestHoleSize.x != 0)
+    {
+        ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
+        ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
+        if (ImRect(hole_pos, hole_pos + hole_size).Contains(pos))
+            return false;
+    }
+    return true;
+}
+
 // Find window given position, search front-to-back
 // - Typically write output back to g.HoveredWindow and g.HoveredWindowUnderMovingWindow.
 // - FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
 //   with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
 //   called, aka before the next Begin(). Moving window isn't affected.
 // - The 'find_first_and_in_any_viewport = true' mode is only used by TestEngine. It is simpler to maintain here.
+//   As it may be called mid-frame after windows rectangles have changed, it doesn't use g.WindowsHitGrid.
 void ImGui::FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_viewport, ImGuiWindow** out_hovered_window, ImGuiWindow** out_hovered_window_under_moving_window)
 {
     ImGuiContext& g = *GImGui;
@@ -6061,44 +7151,54 @@ void ImGui::FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_vi
 
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize = ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding));
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
-    {
-        ImGuiWindow* window = g.Windows[i];
-        IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-        if (!window->WasActive || window->Hidden)
-            continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
-
-        // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImVec2 hit_padding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? padding_regular : padding_for_resize;
-        if (!window->OuterRectClipped.ContainsWithPad(pos, hit_padding))
-            continue;
-
-        // Support for one rectangular hole in any given window
-        // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
-        if (window->HitTestHoleSize.x != 0)
+    ImGuiWindowHitGrid* hit_grid = &g.WindowsHitGrid;
+    if (find_first_and_in_any_viewport == false && hit_grid->CellsX > 0 && padding_for_resize.x <= hit_grid->Padding.x && padding_for_resize.y <= hit_grid->Padding.y)
+    {
+        // Only test windows registered in the cell under 'pos', keeping the front-most ones.
+        const bool hovered_window_is_moving_window = (hovered_window != NULL);
+        const ImVec2ih cell_pos = WindowsHitGridGetCellAt(hit_grid, pos);
+        int hovered_window_display_index = -1;
+        int hovered_window_under_moving_window_display_index = -1;
+        for (ImGuiWindow* window : hit_grid->Cells[cell_pos.y * hit_grid->CellsX + cell_pos.x])
         {
-            ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
-            ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
-            if (ImRect(hole_pos, hole_pos + hole_size).Contains(pos))
+            if (!IsWindowHitByPos(window, pos, padding_regular, padding_for_resize))
                 continue;
+            const int display_index = FindWindowDisplayIndex(window);
+            if (!hovered_window_is_moving_window && display_index > hovered_window_display_index)
+            {
+                hovered_window = window;
+                hovered_window_display_index = display_index;
+            }
+            if (display_index > hovered_window_under_moving_window_display_index && (!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow))
+            {
+                hovered_window_under_moving_window = window;
+                hovered_window_under_moving_window_display_index = display_index;
+            }
         }
-
-        if (find_first_and_in_any_viewport)
-        {
-            hovered_window = window;
-            break;
-        }
-        else
+    }
+    else
+    {
+        for (int i = g.Windows.Size - 1; i >= 0; i--)
         {
-            if (hovered_window == NULL)
+            ImGuiWindow* window = g.Windows[i];
+            if (!IsWindowHitByPos(window, pos, padding_regular, padding_for_resize))
+                continue;
+
+            if (find_first_and_in_any_viewport)
+            {
                 hovered_window = window;
-            IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-            if (hovered_window_under_moving_window == NULL && (!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow))
-                hovered_window_under_moving_window = window;
-            if (hovered_window && hovered_window_under_moving_window)
                 break;
+            }
+            else
+            {
+                if (hovered_window == NULL)
+                    hovered_window = window;
+                IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
+                if (hovered_window_under_moving_window == NULL && (!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow))
+                    hovered_window_under_moving_window = window;
+                if (hovered_window && hovered_window_under_moving_window)
+                    break;
+            }
         }
     }
 
@@ -6854,7 +7954,10 @@ static int ImGui::UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& si
         ButtonBehavior(border_rect, border_id, &hovered, &held, ImGuiButtonFlags_FlattenChildren | ImGuiButtonFlags_NoNavFocus);
         //GetForegroundDrawList(window)->AddRect(border_rect.Min, border_rect.Max, IM_COL32(255, 255, 0, 255));
         if (hovered && g.HoveredIdTimer <= WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER)
+        {
+            SetNextFrameWantRender(WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER - g.HoveredIdTimer);
             hovered = false;
+        }
         if (hovered || held)
             SetMouseCursor((axis == ImGuiAxis_X) ? ImGuiMouseCursor_ResizeEW : ImGuiMouseCursor_ResizeNS);
         if (held && g.IO.MouseDoubleClicked[0])
@@ -7287,6 +8390,15 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     const bool first_begin_of_the_frame = (window->LastFrameActive != current_frame);
     window->IsFallbackWindow = (g.CurrentWindowStack.Size == 0 && g.WithinFrameScopeWithImplicitWindow);
 
+    // [DEBUG] Profiler: the "Window" zone is ended in End() and contains zones submitted between Begin() and End().
+    // Not for the implicit fallback window which is ended in EndFrame(), so zones stay correctly nested.
+#ifdef IMGUI_ENABLE_PROFILER
+    const bool profiler_window_zone = !window->IsFallbackWindow;
+    if (profiler_window_zone)
+        ProfilerZoneBegin("Window", window->ID);
+#endif
+    IMGUI_PROFILER_ZONE_ID("Begin", window->ID);
+
     // Update the Appearing flag
     bool window_just_activated_by_user = (window->LastFrameActive < current_frame - 1);   // Not using !WasActive because the implicit "Debug" window would always toggle off->on
     if (flags & ImGuiWindowFlags_Popup)
@@ -7334,6 +8446,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     window_stack_data.DisabledOverrideReenableAlphaBackup = 0.0f;
     ErrorRecoveryStoreState(&window_stack_data.StackSizesInBegin);
     g.StackSizesInBeginForCurrentWindow = &window_stack_data.StackSizesInBegin;
+#ifdef IMGUI_ENABLE_PROFILER
+    window_stack_data.ProfilerWindowZone = profiler_window_zone;
+#endif
     if (flags & ImGuiWindowFlags_ChildMenu)
         g.BeginMenuDepth++;
 
@@ -7747,7 +8862,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         // Outer rectangle
         // Not affected by window border size. Used by:
-        // - FindHoveredWindow() (w/ extra padding when border resize is enabled)
+        // - FindHoveredWindow() (w/ extra padding when border resize is enabled), registered in g.WindowsHitGrid here.
         // - Begin() initial clipping rect for drawing window background and borders.
         // - Begin() clipping whole child
         const ImRect host_rect = ((flags & ImGuiWindowFlags_ChildWindow) && !(flags & ImGuiWindowFlags_Popup) && !window_is_child_tooltip) ? parent_window->ClipRect : viewport_rect;
@@ -7755,6 +8870,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         const ImRect title_bar_rect = window->TitleBarRect();
         window->OuterRectClipped = outer_rect;
         window->OuterRectClipped.ClipWith(host_rect);
+        WindowsHitGridUpdateWindow(&g.WindowsHitGrid, window);
 
         // Inner rectangle
         // Not affected by window border size. Used by:
@@ -7804,7 +8920,10 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         // Setup draw list and outer clipping rectangle
         IM_ASSERT(window->DrawList->CmdBuffer.Size == 1 && window->DrawList->CmdBuffer[0].ElemCount == 0);
-        window->DrawList->PushTexture(g.Font->ContainerAtlas->TexRef);
+        {
+            ImFontAtlasThreadLockScope lock(g.Font->ContainerAtlas, &g.DrawListSharedData);
+            window->DrawList->PushTexture(g.Font->ContainerAtlas->TexRef);
+        }
         PushClipRect(host_rect.Min, host_rect.Max, false);
 
         // Child windows can render their decoration (bg color, border, scrollbars, etc.) within their parent to save a draw call (since 1.71)
@@ -8071,6 +9190,10 @@ void ImGui::End()
     // Error checking: verify that user doesn't directly call End() on a child window.
     if (window->Flags & ImGuiWindowFlags_ChildWindow)
         IM_ASSERT_USER_ERROR(g.WithinEndChildID == window->ID, "Must call EndChild() and not End()!");
+#ifdef IMGUI_ENABLE_PROFILER
+    const bool profiler_window_zone = window_stack_data.ProfilerWindowZone;
+    ProfilerZoneBegin("End", window->ID);
+#endif
 
     // Close anything that is open
     if (window->DC.CurrentColumns)
@@ -8107,6 +9230,12 @@ void ImGui::End()
 
     g.CurrentWindowStack.pop_back();
     SetCurrentWindow(g.CurrentWindowStack.Size == 0 ? NULL : g.CurrentWindowStack.back().Window);
+
+#ifdef IMGUI_ENABLE_PROFILER
+    ProfilerZoneEnd(); // "End"
+    if (profiler_window_zone)
+        ProfilerZoneEnd(); // "Window"
+#endif
 }
 
 void ImGui::PushItemFlag(ImGuiItemFlags option, bool enabled)
@@ -8262,22 +9391,12 @@ bool ImGui::IsWindowWithinBeginStackOf(ImGuiWindow* window, ImGuiWindow* potenti
 
 bool ImGui::IsWindowAbove(ImGuiWindow* potential_above, ImGuiWindow* potential_below)
 {
-    ImGuiContext& g = *GImGui;
-
     // It would be saner to ensure that display layer is always reflected in the g.Windows[] order, which would likely requires altering all manipulations of that array
     const int display_layer_delta = GetWindowDisplayLayer(potential_above) - GetWindowDisplayLayer(potential_below);
     if (display_layer_delta != 0)
         return display_layer_delta > 0;
 
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
-    {
-        ImGuiWindow* candidate_window = g.Windows[i];
-        if (candidate_window == potential_above)
-            return true;
-        if (candidate_window == potential_below)
-            return false;
-    }
-    return false;
+    return FindWindowDisplayIndex(potential_above) >= FindWindowDisplayIndex(potential_below);
 }
 
 // Is current window hovered and hoverable (e.g. not blocked by a popup/modal)? See ImGuiHoveredFlags_ for options.
@@ -8324,7 +9443,10 @@ bool ImGui::IsWindowHovered(ImGuiHoveredFlags flags)
     if (flags & ImGuiHoveredFlags_ForTooltip)
         flags = ApplyHoverFlagsForTooltip(flags, g.Style.HoverFlagsForTooltipMouse);
     if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverWindowUnlockedStationaryId != ref_window->ID)
+    {
+        SetNextFrameWantRender(g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
         return false;
+    }
 
     return true;
 }
@@ -8768,9 +9890,13 @@ static void ImGui::UpdateTexturesNewFrame()
 {
     // Cannot update every atlases based on atlas's FrameCount < g.FrameCount, because an atlas may be shared by multiple contexts with different frame count.
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateTexturesNewFrame");
     const bool has_textures = (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures) != 0;
     for (ImFontAtlas* atlas : g.FontAtlases)
     {
+        // Previous frame has been rendered: release its textures, so they may be destroyed.
+        ImFontAtlasThreadLockScope lock(atlas, &g.DrawListSharedData);
+        ImFontAtlasReleaseTexturesInUse(atlas, &g.DrawListSharedData);
         if (atlas->OwnerContext == &g)
         {
             ImFontAtlasUpdateNewFrame(atlas, g.FrameCount, has_textures);
@@ -8784,6 +9910,7 @@ static void ImGui::UpdateTexturesNewFrame()
             IM_ASSERT(atlas->Builder != NULL && atlas->Builder->FrameCount != -1);
             IM_ASSERT(atlas->RendererHasTextures == has_textures);
         }
+        ImFontAtlasAcquireTexturesInUse(atlas, &g.DrawListSharedData);
     }
 }
 
@@ -8793,13 +9920,26 @@ static void ImGui::UpdateTexturesEndFrame()
     ImGuiContext& g = *GImGui;
     g.PlatformIO.Textures.resize(0);
     for (ImFontAtlas* atlas : g.FontAtlases)
+    {
+        ImFontAtlasThreadLockScope lock(atlas);
+        ImFontAtlasSetBoundBaked(atlas, &g.DrawListSharedData, NULL);
         for (ImTextureData* tex : atlas->TexList)
         {
+            // Textures destroyed by backend and waiting to be freed are not exposed (see ImFontAtlasUpdateNewFrame())
+            if (tex->Status == ImTextureStatus_Destroyed && tex->WantDestroyNextFrame)
+                continue;
+
+            // Textures waiting for other contexts to release them before being destroyed are only exposed by contexts still using them
+            if (tex->WantDestroyNextFrame && tex->Status != ImTextureStatus_WantDestroy && atlas->OwnerContext != &g && !g.DrawListSharedData.TexturesInUse.contains(tex))
+                continue;
+
             // We provide this information so backends can decide whether to destroy textures.
             // This means in practice that if N imgui contexts are created with a shared atlas, we assume all of them have a backend initialized.
             tex->RefCount = (unsigned short)atlas->RefCount;
             g.PlatformIO.Textures.push_back(tex);
+            ImFontAtlasAddTextureInUse(&g.DrawListSharedData, tex); // Keep alive until our next NewFrame(), as backend will access it
         }
+    }
     for (ImTextureData* tex : g.UserTextures)
         g.PlatformIO.Textures.push_back(tex);
 }
@@ -8807,6 +9947,7 @@ static void ImGui::UpdateTexturesEndFrame()
 void ImGui::UpdateFontsNewFrame()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateFontsNewFrame");
     if ((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures) == 0)
         for (ImFontAtlas* atlas : g.FontAtlases)
             atlas->Locked = true;
@@ -8867,22 +10008,26 @@ void ImGui::RegisterFontAtlas(ImFontAtlas* atlas)
     ImGuiContext& g = *GImGui;
     if (g.FontAtlases.Size == 0)
         IM_ASSERT(atlas == g.IO.Fonts);
+    ImFontAtlasThreadLock(atlas);
     atlas->RefCount++;
     g.FontAtlases.push_back(atlas);
     ImFontAtlasAddDrawListSharedData(atlas, &g.DrawListSharedData);
     for (ImTextureData* tex : atlas->TexList)
         tex->RefCount = (unsigned short)atlas->RefCount;
+    ImFontAtlasThreadUnlock(atlas);
 }
 
 void ImGui::UnregisterFontAtlas(ImFontAtlas* atlas)
 {
     ImGuiContext& g = *GImGui;
+    ImFontAtlasThreadLock(atlas);
     IM_ASSERT(atlas->RefCount > 0);
     ImFontAtlasRemoveDrawListSharedData(atlas, &g.DrawListSharedData);
     g.FontAtlases.find_erase(atlas);
     atlas->RefCount--;
     for (ImTextureData* tex : atlas->TexList)
         tex->RefCount = (unsigned short)atlas->RefCount;
+    ImFontAtlasThreadUnlock(atlas);
 }
 
 // Use ImDrawList::_SetTexture(), making our shared g.FontStack[] authoritative against window-local ImDrawList.
@@ -8907,9 +10052,10 @@ void ImGui::SetCurrentFont(ImFont* font, float font_size_before_scaling, float f
         IM_ASSERT(font->Scale > 0.0f);
 #endif
         ImFontAtlas* atlas = font->ContainerAtlas;
+        ImFontAtlasThreadLockScope lock(atlas, &g.DrawListSharedData);
         g.DrawListSharedData.FontAtlas = atlas;
         g.DrawListSharedData.Font = font;
-        ImFontAtlasUpdateDrawListsSharedData(atlas);
+        ImFontAtlasUpdateDrawListSharedDataUvs(atlas, &g.DrawListSharedData);
         if (g.CurrentWindow != NULL)
             g.CurrentWindow->DrawList->_SetTexture(atlas->TexRef);
     }
@@ -8959,11 +10105,22 @@ void ImGui::UpdateCurrentFontSize(float restore_font_size_after_scaling)
     // - We may support it better later and remove this rounding.
     final_size = GetRoundedFontSize(final_size);
     final_size = ImClamp(final_size, 1.0f, IMGUI_FONT_SIZE_MAX);
-    if (g.Font != NULL && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures))
-        g.Font->CurrentRasterizerDensity = g.FontRasterizerDensity;
     g.FontSize = final_size;
-    g.FontBaked = (g.Font != NULL && window != NULL) ? g.Font->GetFontBaked(final_size) : NULL;
-    g.FontBakedScale = (g.Font != NULL && window != NULL) ? (g.FontSize / g.FontBaked->Size) : 0.0f;
+    if (g.Font != NULL)
+    {
+        ImFontAtlasThreadLockScope lock(g.Font->ContainerAtlas); // Font is shared by all contexts using the atlas
+        if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures)
+            g.Font->CurrentRasterizerDensity = g.FontRasterizerDensity;
+        g.FontBaked = (window != NULL) ? g.Font->GetFontBaked(final_size) : NULL;
+        g.FontBakedScale = (window != NULL) ? (g.FontSize / g.FontBaked->Size) : 0.0f;
+        if (g.Font->ContainerAtlas->ThreadLockFunc != NULL && g.FontBaked != NULL)
+            ImFontAtlasSetBoundBaked(g.Font->ContainerAtlas, &g.DrawListSharedData, g.FontBaked);
+    }
+    else
+    {
+        g.FontBaked = NULL;
+        g.FontBakedScale = 0.0f;
+    }
     g.DrawListSharedData.FontSize = g.FontSize;
     g.DrawListSharedData.FontScale = g.FontBakedScale;
 }
@@ -9966,6 +11123,7 @@ static ImGuiKeyChord GetMergedModsFromKeys()
 static void ImGui::UpdateKeyboardInputs()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateKeyboardInputs");
     ImGuiIO& io = g.IO;
 
     if (io.ConfigFlags & ImGuiConfigFlags_NoKeyboard)
@@ -10033,6 +11191,7 @@ static void ImGui::UpdateKeyboardInputs()
 static void ImGui::UpdateMouseInputs()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateMouseInputs");
     ImGuiIO& io = g.IO;
 
     // Mouse Wheel swapping flag
@@ -10170,6 +11329,7 @@ void ImGui::UpdateMouseWheel()
     // Reset the locked window if we move the mouse or after the timer elapses.
     // FIXME: Ideally we could refactor to have one timer for "changing window w/ same axis" and a shorter timer for "changing window or axis w/ other axis" (#3795)
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateMouseWheel");
     if (g.WheelingWindow != NULL)
     {
         g.WheelingWindowReleaseTimer -= g.IO.DeltaTime;
@@ -10301,6 +11461,7 @@ static void DebugPrintInputEvent(const char* prefix, const ImGuiInputEvent* e)
 void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateInputEvents");
     ImGuiIO& io = g.IO;
 
     // Only trickle chars<>key when working with InputText()
@@ -12105,6 +13266,7 @@ void ImGui::OpenPopupEx(ImGuiID id, ImGuiPopupFlags popup_flags)
     if (g.OpenPopupStack.Size < current_stack_size + 1)
     {
         g.OpenPopupStack.push_back(popup_ref);
+        SetNextFrameWantRender(); // Popup will appear on next frame
     }
     else
     {
@@ -12210,6 +13372,7 @@ void ImGui::ClosePopupToLevel(int remaining, bool restore_focus_to_window_under_
     // Trim open popup stack
     ImGuiPopupData prev_popup = g.OpenPopupStack[remaining];
     g.OpenPopupStack.resize(remaining);
+    SetNextFrameWantRender(); // Popup may have been submitted already this frame
 
     // Restore focus (unless popup window was not yet submitted, and didn't have a chance to take focus anyhow. See #7325 for an edge case)
     if (restore_focus_to_window_under_popup && prev_popup.Window)
@@ -12755,10 +13918,17 @@ void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_
     }
 }
 
+// Index in g.Windows[] is cached in each window (set by EndFrame() sort), refreshed for all windows when found stale.
 int ImGui::FindWindowDisplayIndex(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
-    return g.Windows.index_from_ptr(g.Windows.find(window));
+    int index = window->DisplayIndexCached;
+    if (index >= 0 && index < g.Windows.Size && g.Windows.Data[index] == window)
+        return index;
+    for (int n = 0; n < g.Windows.Size; n++)
+        g.Windows.Data[n]->DisplayIndexCached = n;
+    index = window->DisplayIndexCached;
+    return (index >= 0 && index < g.Windows.Size && g.Windows.Data[index] == window) ? index : g.Windows.Size;
 }
 
 // Moving window to front of display and set focus (which happens to be back of our sorted list)
@@ -13106,6 +14276,33 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result, const ImRect& nav_bb)
     return new_best;
 }
 
+// Calculate g.NavScoringCullRect: items outside of it can't be scored as a better move result by NavScoreItem(), which allows skipping them.
+// - Items outside the half-plane in the move direction can't be in the move direction quadrant.
+// - dist_box >= distance between boxes along the move axis, scaled down on X as NavScoreItem() does when boxes don't overlap on Y.
+// - 1.0f margins keep culling conservative with regard to floating-point rounding and ties.
+// - Disabled for the menu layer which may use the axial check, and when IMGUI_DEBUG_NAV_SCORING is set to display all candidates.
+static void ImGui::NavUpdateScoringCullRect()
+{
+    ImGuiContext& g = *GImGui;
+    ImRect& r = g.NavScoringCullRect;
+    r = ImRect(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
+    if (!g.NavMoveScoringItems || g.NavLayer != ImGuiNavLayer_Main || (g.NavMoveFlags & ImGuiNavMoveFlags_IsTabbing) || IMGUI_DEBUG_NAV_SCORING)
+        return;
+
+    // The visible set for PageUp/PageDown is scored with its own result, so we can only use the half-plane.
+    const ImRect curr = g.NavScoringRect;
+    const float dist = ((g.NavMoveFlags & ImGuiNavMoveFlags_AlsoScoreVisibleSet) ? FLT_MAX : g.NavMoveResultLocal.DistBox) + 1.0f;
+    const float dist_x = (dist == FLT_MAX) ? FLT_MAX : ImMax(dist, (dist - 1.0f) * 1000.0f);
+    switch (g.NavMoveDir)
+    {
+    case ImGuiDir_Left:  r.Min.x = curr.Min.x - dist_x; r.Max.x = curr.Max.x + 1.0f; break;
+    case ImGuiDir_Right: r.Min.x = curr.Min.x - 1.0f; r.Max.x = curr.Max.x + dist_x; break;
+    case ImGuiDir_Up:    r.Min.y = ImLerp(curr.Min.y, curr.Max.y, 0.2f) - dist; r.Max.y = ImLerp(curr.Min.y, curr.Max.y, 0.8f) + 1.0f; break;
+    case ImGuiDir_Down:  r.Min.y = ImLerp(curr.Min.y, curr.Max.y, 0.2f) - 1.0f; r.Max.y = ImLerp(curr.Min.y, curr.Max.y, 0.8f) + dist; break;
+    default: break;
+    }
+}
+
 static void ImGui::NavApplyItemToResult(ImGuiNavItemData* result)
 {
     ImGuiContext& g = *GImGui;
@@ -13175,11 +14372,15 @@ static void ImGui::NavProcessItem()
             {
                 NavProcessItemForTabbingRequest(id, item_flags, g.NavMoveFlags);
             }
-            else if (g.NavId != id || (g.NavMoveFlags & ImGuiNavMoveFlags_AllowCurrentNavId))
+            else if ((g.NavId != id || (g.NavMoveFlags & ImGuiNavMoveFlags_AllowCurrentNavId)) && (window != g.NavWindow || g.NavScoringCullRect.Overlaps(nav_bb)))
             {
                 ImGuiNavItemData* result = (window == g.NavWindow) ? &g.NavMoveResultLocal : &g.NavMoveResultOther;
                 if (NavScoreItem(result, nav_bb))
+                {
                     NavApplyItemToResult(result);
+                    if (result == &g.NavMoveResultLocal)
+                        NavUpdateScoringCullRect();
+                }
 
                 // Features like PageUp/PageDown need to maintain a separate score for the visible set of items.
                 const float VISIBLE_RATIO = 0.70f;
@@ -13302,6 +14503,7 @@ void ImGui::NavMoveRequestSubmit(ImGuiDir move_dir, ImGuiDir clip_dir, ImGuiNavM
     g.NavMoveResultLocal.Clear();
     g.NavMoveResultLocalVisible.Clear();
     g.NavMoveResultOther.Clear();
+    g.NavScoringCullRect = ImRect(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX); // Updated by NavUpdateCreateMoveRequest() once g.NavScoringRect is known
     g.NavTabbingCounter = 0;
     g.NavTabbingResultFirst.Clear();
     NavUpdateAnyRequestFlag();
@@ -13524,6 +14726,7 @@ float ImGui::GetNavTweakPressedAmount(ImGuiAxis axis)
 static void ImGui::NavUpdate()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("NavUpdate");
     ImGuiIO& io = g.IO;
 
     io.WantSetMousePos = false;
@@ -13863,6 +15066,7 @@ void ImGui::NavUpdateCreateMoveRequest()
         //if (!g.NavScoringNoClipRect.IsInverted()) { GetForegroundDrawList()->AddRect(g.NavScoringNoClipRect.Min, g.NavScoringNoClipRect.Max, IM_COL32(255, 200, 0, 255)); } // [DEBUG]
     }
     g.NavScoringRect = scoring_rect;
+    NavUpdateScoringCullRect();
     //g.NavScoringNoClipRect.Add(scoring_rect);
 }
 
@@ -15179,6 +16383,8 @@ void ImGui::LogButtons()
 // - LoadIniSettingsFromMemory()
 // - SaveIniSettingsToDisk()
 // - SaveIniSettingsToMemory()
+// - SaveBinarySettingsToDisk()
+// - SaveBinarySettingsToMemory()
 //-----------------------------------------------------------------------------
 // - CreateNewWindowSettings() [Internal]
 // - FindWindowSettingsByID() [Internal]
@@ -15192,6 +16398,7 @@ void ImGui::UpdateSettings()
 {
     // Load settings on first frame (if not explicitly loaded manually before)
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateSettings");
     if (!g.SettingsLoaded)
     {
         IM_ASSERT(g.SettingsWindows.empty());
@@ -15200,6 +16407,9 @@ void ImGui::UpdateSettings()
         g.SettingsLoaded = true;
     }
 
+    // Apply result of a binary settings write which completed on another thread
+    SettingsBinaryWriteFinish(&g, false);
+
     // Save settings (with a delay after the last modification, so we don't spam disk too much)
     if (g.SettingsDirtyTimer > 0.0f)
     {
@@ -15264,41 +16474,182 @@ void ImGui::ClearIniSettings()
             handler.ClearAllFn(&g, &handler);
 }
 
-void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
+// Binary settings data, see SaveBinarySettingsToMemory()
+// - Header: ImU32 Magic, ImU32 FormatHash, then sections: { ImU32 TypeHash, ImU32 DataSize, ImU32 PaddedSize, records, zero padding up to PaddedSize }.
+// - Records: { ImU32 Size, ImU32 Checksum, data, zero padding to a multiple of 4 }. A record with a mismatching checksum (e.g. torn by
+//   a crash while it was rewritten in place) is ignored on load, so we never mix old and new fields of an entry.
+// - Handlers with a WriteBinaryFn store records in their in-memory layout (e.g. ImChunkStream chunks), read back directly from the file mapping.
+//   Their sections are padded to a multiple of 4 KB, so that appending records rarely moves the following sections (see SaveBinarySettingsToDisk()).
+//   FormatHash encodes the layout of core settings structures and the ID hash function: data saved by an incompatible build is ignored.
+// - Handlers without a WriteBinaryFn are stored as .ini text, in a single record in a section with TypeHash == 0.
+#define IMGUI_SETTINGS_BINARY_MAGIC     0x42534D49  // "IMSB" when stored in little-endian
+
+static ImU32 SettingsBinaryFormatHash()
 {
-    size_t file_data_size = 0;
-    char* file_data = (char*)ImFileLoadToMemory(ini_filename, "rb", &file_data_size);
-    if (!file_data)
-        return;
-    if (file_data_size > 0)
-        LoadIniSettingsFromMemory(file_data, (size_t)file_data_size);
-    IM_FREE(file_data);
+    const ImU32 layout[] = { 2, (ImU32)sizeof(ImGuiWindowSettings), (ImU32)sizeof(ImGuiTableSettings), (ImU32)sizeof(ImGuiTableColumnSettings), ImHashStr("Window") };
+    return ImHashData(layout, sizeof(layout));
 }
 
-// Zero-tolerance, no error reporting, cheap .ini parsing
-// Set ini_size==0 to let us use strlen(ini_data). Do not call this function with a 0 if your buffer is actually empty!
-void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
+static bool SettingsBinaryIsData(const char* data, size_t data_size)
 {
-    ImGuiContext& g = *GImGui;
-    IM_ASSERT(g.Initialized);
-    //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
-    //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
+    ImU32 magic = 0;
+    if (data_size >= sizeof(magic))
+        memcpy(&magic, data, sizeof(magic));
+    return magic == IMGUI_SETTINGS_BINARY_MAGIC;
+}
 
-    // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
-    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
-    if (ini_size == 0)
-        ini_size = ImStrlen(ini_data);
-    g.SettingsIniData.Buf.resize((int)ini_size + 1);
-    char* const buf = g.SettingsIniData.Buf.Data;
-    char* const buf_end = buf + ini_size;
-    memcpy(buf, ini_data, ini_size);
-    buf_end[0] = 0;
+// Compare a block of binary settings data to the data we last saved to disk.
+#define IMGUI_SETTINGS_BINARY_BLOCK_SIZE   512
+static bool SettingsBinaryIsBlockChanged(const char* data, size_t data_size, const ImVector<char>& prev_data, size_t offset)
+{
+    const size_t size = ImMin((size_t)IMGUI_SETTINGS_BINARY_BLOCK_SIZE, data_size - offset);
+    return offset + size > (size_t)prev_data.Size || memcmp(data + offset, prev_data.Data + offset, size) != 0;
+}
 
-    // Call pre-read handlers
-    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
-    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
-        if (handler.ReadInitFn != NULL)
-            handler.ReadInitFn(&g, &handler);
+// Checksum of a binary settings record, only used to detect torn or corrupted records.
+// Processes 32 bytes per iteration in 4 independent lanes (similar to XXH64): ~10x faster than ImHashData() on large settings.
+static ImU32 SettingsBinaryChecksum(const void* data, size_t data_size)
+{
+    const ImU64 PRIME_1 = 0x9E3779B185EBCA87ULL, PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+    const unsigned char* p = (const unsigned char*)data;
+    ImU64 lanes[4] = { PRIME_1 + PRIME_2, PRIME_2, 0, (ImU64)0 - PRIME_1 };
+    for (; data_size >= 32; p += 32, data_size -= 32)
+        for (int n = 0; n < 4; n++)
+        {
+            ImU64 v;
+            memcpy(&v, p + n * 8, sizeof(v));
+            lanes[n] += v * PRIME_2;
+            lanes[n] = ((lanes[n] << 31) | (lanes[n] >> 33)) * PRIME_1;
+        }
+    ImU64 h = lanes[0] ^ ((lanes[1] << 7) | (lanes[1] >> 57)) ^ ((lanes[2] << 12) | (lanes[2] >> 52)) ^ ((lanes[3] << 18) | (lanes[3] >> 46));
+    for (; data_size > 0; p++, data_size--)
+        h = (h ^ *p) * PRIME_1;
+    h ^= h >> 33;
+    h *= PRIME_2;
+    h ^= h >> 29;
+    return (ImU32)(h ^ (h >> 32));
+}
+
+static void SettingsBinaryAppendRecord(ImVector<char>* buf, const void* data, size_t data_size)
+{
+    const ImU32 record[2] = { (ImU32)data_size, SettingsBinaryChecksum(data, data_size) };
+    const int offset = buf->Size;
+    const int padded_size = (int)IM_MEMALIGN(data_size, 4);
+    buf->resize(offset + (int)sizeof(record) + padded_size);
+    memcpy(buf->Data + offset, record, sizeof(record));
+    memcpy(buf->Data + offset + sizeof(record), data, data_size);
+    memset(buf->Data + offset + sizeof(record) + data_size, 0, (size_t)padded_size - data_size);
+}
+
+// Write section header for data appended since 'section_offset', then pad.
+static void SettingsBinaryEndSection(ImVector<char>* buf, int section_offset, ImGuiID type_hash, int align)
+{
+    const int data_size = buf->Size - section_offset - (int)sizeof(ImU32) * 3;
+    const int padded_size = (int)IM_MEMALIGN(data_size, align);
+    const ImU32 section[3] = { type_hash, (ImU32)data_size, (ImU32)padded_size };
+    memcpy(buf->Data + section_offset, section, sizeof(section));
+    buf->resize(buf->Size + padded_size - data_size);
+    memset(buf->Data + buf->Size - (padded_size - data_size), 0, (size_t)(padded_size - data_size));
+}
+
+static ImU32 SettingsBinaryWriteGetState(ImGuiSettingsWriteTask* task)
+{
+#ifdef IMGUI_ENABLE_ATOMICS
+    return ImAtomicLoad(&task->State);
+#else
+    return task->State;
+#endif
+}
+
+static void SettingsBinaryWriteSetState(ImGuiSettingsWriteTask* task, ImU32 state)
+{
+#ifdef IMGUI_ENABLE_ATOMICS
+    ImAtomicStore(&task->State, state);
+#else
+    task->State = state;
+#endif
+}
+
+// Write a binary settings file. May run on any thread (see platform_io.Platform_RunSettingsWriteFn): only accesses the task.
+// Rewriting ranges in place is not atomic: if the application is interrupted while saving, the file may be left with a mix of old
+// and new records, but each record is either entirely old or entirely new (or fails its checksum and is ignored on load).
+static void SettingsBinaryWriteTaskRun(void* task_data)
+{
+    ImGuiSettingsWriteTask* task = (ImGuiSettingsWriteTask*)task_data;
+    IM_ASSERT(SettingsBinaryWriteGetState(task) == ImGuiSettingsWriteState_Pending);
+    const char* filename = task->Filename.Data;
+    const char* data = task->Data.Data;
+    const size_t data_size = (size_t)task->Data.Size;
+    ImFileHandle f = NULL;
+    bool write_ok = true;
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+    if (task->InPlaceFileSize > 0)
+        if ((f = ImFileOpen(filename, "r+b")) != NULL && ImFileGetSize(f) != (ImU64)task->InPlaceFileSize)
+        {
+            ImFileClose(f);
+            f = NULL;
+        }
+    if (f != NULL)
+        for (int n = 0; n + 1 < task->Ranges.Size && write_ok; n += 2)
+        {
+            const size_t range_offset = (size_t)task->Ranges[n];
+            const size_t range_size = (size_t)task->Ranges[n + 1];
+            write_ok = fseek(f, (long)range_offset, SEEK_SET) == 0 && ImFileWrite(data + range_offset, 1, range_size, f) == range_size;
+        }
+#endif
+    if (f == NULL)
+    {
+        if ((f = ImFileOpen(filename, "wb")) == NULL)
+            write_ok = false;
+        else
+            write_ok = (ImFileWrite(data, 1, data_size, f) == data_size);
+    }
+    if (f != NULL)
+        write_ok &= ImFileClose(f);
+    SettingsBinaryWriteSetState(task, write_ok ? ImGuiSettingsWriteState_Done : ImGuiSettingsWriteState_Failed);
+}
+
+// Apply result of last binary settings write, once it completed. Return false if it is still running and 'wait' is false.
+// On write error, our copy of the file contents is discarded so the next save rewrites the whole file.
+static bool SettingsBinaryWriteFinish(ImGuiContext* ctx, bool wait)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiSettingsWriteTask* task = &g.SettingsBinaryWriteTask;
+    ImU32 state = SettingsBinaryWriteGetState(task);
+    if (state == ImGuiSettingsWriteState_Idle)
+        return true;
+    for (; state == ImGuiSettingsWriteState_Pending; state = SettingsBinaryWriteGetState(task))
+    {
+        if (!wait)
+            return false;
+#ifdef IMGUI_ENABLE_ATOMICS
+        std::this_thread::yield();
+#endif
+    }
+    if (state == ImGuiSettingsWriteState_Done)
+    {
+        g.SettingsBinaryDiskData.swap(task->Data);
+        g.SettingsBinaryDiskFilenameHash = ImHashStr(task->Filename.Data);
+    }
+    else
+    {
+        g.SettingsBinaryDiskData.clear();
+        g.SettingsBinaryDiskFilenameHash = 0;
+    }
+    SettingsBinaryWriteSetState(task, ImGuiSettingsWriteState_Idle);
+    return true;
+}
+
+// Parse .ini text, calling ReadOpenFn/ReadLineFn handlers.
+static void LoadIniSettingsParseText(ImGuiContext& g, const char* ini_data, size_t ini_size)
+{
+    // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
+    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
+    g.SettingsIniData.Buf.resize((int)ini_size + 1);
+    char* const buf = g.SettingsIniData.Buf.Data;
+    char* const buf_end = buf + ini_size;
+    memcpy(buf, ini_data, ini_size);
+    buf_end[0] = 0;
 
     void* entry_data = NULL;
     ImGuiSettingsHandler* entry_handler = NULL;
@@ -15327,7 +16678,7 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
                 continue;
             *type_end = 0; // Overwrite first ']'
             name_start++;  // Skip second '['
-            entry_handler = FindSettingsHandler(type_start);
+            entry_handler = ImGui::FindSettingsHandler(type_start);
             entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
         }
         else if (entry_handler != NULL && entry_data != NULL)
@@ -15336,10 +16687,120 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
             entry_handler->ReadLineFn(&g, entry_handler, entry_data, line);
         }
     }
-    g.SettingsLoaded = true;
 
     // [DEBUG] Restore untouched copy so it can be browsed in Metrics (not strictly necessary)
     memcpy(buf, ini_data, ini_size);
+}
+
+// Zero-tolerance: data saved by an incompatible build is ignored. Loading stops at the first section with invalid bounds
+// (e.g. truncated file) and records with a mismatching checksum are skipped. Records are read in place ('data' may be memory-mapped).
+static void LoadBinarySettingsFromMemory(ImGuiContext& g, const char* data, size_t data_size)
+{
+    ImU32 header[2];
+    if (data_size < sizeof(header))
+        return;
+    memcpy(header, data, sizeof(header));
+    if (header[0] != IMGUI_SETTINGS_BINARY_MAGIC || header[1] != SettingsBinaryFormatHash())
+        return;
+
+    // Call pre-read handlers
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        if (handler.ReadInitFn != NULL)
+            handler.ReadInitFn(&g, &handler);
+
+    for (size_t offset = sizeof(header); data_size - offset >= sizeof(ImU32) * 3; )
+    {
+        ImU32 section[3];
+        memcpy(section, data + offset, sizeof(section));
+        offset += sizeof(section);
+        if (section[1] > section[2] || (section[2] & 3) != 0 || section[2] > data_size - offset)
+            break;
+        const char* section_data = data + offset;
+        offset += section[2];
+
+        ImGuiSettingsHandler* handler = NULL; // NULL for .ini text section
+        if (section[0] != 0)
+        {
+            for (ImGuiSettingsHandler& candidate : g.SettingsHandlers)
+                if (candidate.TypeHash == section[0] && candidate.ReadBinaryFn != NULL)
+                    handler = &candidate;
+            if (handler == NULL)
+                continue;
+        }
+        for (size_t record_offset = 0; section[1] - record_offset >= sizeof(ImU32) * 2; )
+        {
+            ImU32 record[2];
+            memcpy(record, section_data + record_offset, sizeof(record));
+            record_offset += sizeof(record);
+            if (record[0] > section[1] - record_offset)
+                break;
+            const char* record_data = section_data + record_offset;
+            record_offset = ImMin(record_offset + IM_MEMALIGN((size_t)record[0], 4), (size_t)section[1]);
+            if (SettingsBinaryChecksum(record_data, record[0]) != record[1])
+                continue;
+            if (handler == NULL)
+                LoadIniSettingsParseText(g, record_data, record[0]);
+            else
+                handler->ReadBinaryFn(&g, handler, record_data, record[0]);
+        }
+    }
+    g.SettingsLoaded = true;
+
+    // Call post-read handlers
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        if (handler.ApplyAllFn != NULL)
+            handler.ApplyAllFn(&g, &handler);
+}
+
+void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
+{
+    ImGuiContext& g = *GImGui;
+    SettingsBinaryWriteFinish(&g, true); // Don't read a file while we are writing it
+
+    size_t file_data_size = 0;
+    bool file_mapped = false;
+    const char* file_data = (const char*)ImFileMapToMemory(ini_filename, &file_data_size, &file_mapped);
+    if (!file_data)
+        return;
+    if (file_data_size > 0)
+        LoadIniSettingsFromMemory(file_data, (size_t)file_data_size);
+
+    // Keep a copy of binary data so SaveBinarySettingsToDisk() can only rewrite what changed
+    if (SettingsBinaryIsData(file_data, file_data_size))
+    {
+        g.SettingsBinaryDiskData.resize((int)file_data_size);
+        memcpy(g.SettingsBinaryDiskData.Data, file_data, file_data_size);
+        g.SettingsBinaryDiskFilenameHash = ImHashStr(ini_filename);
+    }
+    ImFileUnmapFromMemory(file_data, file_data_size, file_mapped);
+}
+
+// Zero-tolerance, no error reporting, cheap .ini parsing
+// Set ini_size==0 to let us use strlen(ini_data). Do not call this function with a 0 if your buffer is actually empty!
+// Binary settings data (output of SaveBinarySettingsToMemory()) is detected automatically.
+void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+    //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
+    //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
+
+    if (ini_size == 0)
+        ini_size = ImStrlen(ini_data);
+    if (SettingsBinaryIsData(ini_data, ini_size))
+    {
+        LoadBinarySettingsFromMemory(g, ini_data, ini_size);
+        return;
+    }
+
+    // Call pre-read handlers
+    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        if (handler.ReadInitFn != NULL)
+            handler.ReadInitFn(&g, &handler);
+
+    LoadIniSettingsParseText(g, ini_data, ini_size);
+    g.SettingsLoaded = true;
 
     // Call post-read handlers
     for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
@@ -15350,6 +16811,11 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
 void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 {
     ImGuiContext& g = *GImGui;
+    if (g.IO.IniUseBinaryFormat)
+    {
+        SaveBinarySettingsToDisk(ini_filename);
+        return;
+    }
     g.SettingsDirtyTimer = 0.0f;
     if (!ini_filename)
         return;
@@ -15377,6 +16843,113 @@ const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
     return g.SettingsIniData.c_str();
 }
 
+void ImGui::SaveBinarySettingsToDisk(const char* filename)
+{
+    ImGuiContext& g = *GImGui;
+    g.SettingsDirtyTimer = 0.0f;
+    if (!filename)
+        return;
+
+    // Previous write normally completed long ago (saves are spaced by io.IniSavingRate)
+    SettingsBinaryWriteFinish(&g, true);
+
+    // Move data to the write task (output of SaveBinarySettingsToMemory() is invalidated, as by the next call)
+    size_t data_size = 0;
+    SaveBinarySettingsToMemory(&data_size);
+    ImGuiSettingsWriteTask* task = &g.SettingsBinaryWriteTask;
+    task->Data.swap(g.SettingsBinaryData);
+    task->Filename.resize((int)ImStrlen(filename) + 1);
+    memcpy(task->Filename.Data, filename, (size_t)task->Filename.Size);
+    task->Ranges.resize(0);
+    task->InPlaceFileSize = 0;
+
+    // Rewrite only the blocks which changed since we last saved/loaded this file (typically a few records).
+    // Records keep their offset unless entries are added or removed: data can only be appended to, otherwise we rewrite everything.
+    const char* data = task->Data.Data;
+    const ImVector<char>& prev_data = g.SettingsBinaryDiskData;
+    if (g.SettingsBinaryDiskFilenameHash == ImHashStr(filename) && prev_data.Size > 0 && (size_t)prev_data.Size <= data_size)
+    {
+        task->InPlaceFileSize = prev_data.Size;
+        for (size_t block_start = 0; block_start < data_size; block_start += IMGUI_SETTINGS_BINARY_BLOCK_SIZE)
+        {
+            if (!SettingsBinaryIsBlockChanged(data, data_size, prev_data, block_start))
+                continue;
+            size_t block_end = block_start; // Merge consecutive changed blocks into a single write
+            while (block_end < data_size && SettingsBinaryIsBlockChanged(data, data_size, prev_data, block_end))
+                block_end = ImMin(block_end + IMGUI_SETTINGS_BINARY_BLOCK_SIZE, data_size);
+            task->Ranges.push_back((int)block_start);
+            task->Ranges.push_back((int)(block_end - block_start));
+            block_start = block_end; // Block at 'block_end' is unchanged
+        }
+    }
+
+    // Write, possibly on another thread. Our copy of the file contents is updated when it completed (see SettingsBinaryWriteFinish()).
+    SettingsBinaryWriteSetState(task, ImGuiSettingsWriteState_Pending);
+#ifdef IMGUI_ENABLE_ATOMICS
+    if (g.PlatformIO.Platform_RunSettingsWriteFn != NULL)
+    {
+        g.PlatformIO.Platform_RunSettingsWriteFn(&g, SettingsBinaryWriteTaskRun, task);
+        return;
+    }
+#endif
+    SettingsBinaryWriteTaskRun(task);
+    SettingsBinaryWriteFinish(&g, false);
+}
+
+// Call registered handlers (e.g. WindowSettingsHandler_WriteBinary() + custom handlers) to write their stuff into a binary buffer.
+// Handlers without a WriteBinaryFn write text with WriteAllFn. The returned data is valid until the next call.
+const void* ImGui::SaveBinarySettingsToMemory(size_t* out_size)
+{
+    ImGuiContext& g = *GImGui;
+    g.SettingsDirtyTimer = 0.0f;
+    ImGuiTextBuffer text_buf; // Not using g.SettingsIniData, so output of SaveIniSettingsToMemory() stays valid.
+
+    ImVector<char>& buf = g.SettingsBinaryData;
+    const ImU32 header[2] = { IMGUI_SETTINGS_BINARY_MAGIC, SettingsBinaryFormatHash() };
+    buf.resize(sizeof(header));
+    memcpy(buf.Data, header, sizeof(header));
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+    {
+        if (handler.WriteBinaryFn == NULL)
+        {
+            handler.WriteAllFn(&g, &handler, &text_buf);
+            continue;
+        }
+        const int section_offset = buf.Size;
+        buf.resize(buf.Size + sizeof(ImU32) * 3);
+        ImVector<char>& records = g.SettingsBinaryRecords;
+        records.resize(0);
+        handler.WriteBinaryFn(&g, &handler, &records);
+        for (int record_offset = 0, record_size = 0; record_offset < records.Size; record_offset += record_size)
+        {
+            IM_ASSERT(records.Size - record_offset >= (int)sizeof(int));
+            memcpy(&record_size, records.Data + record_offset, sizeof(int));
+            IM_ASSERT(record_size >= (int)sizeof(int) && (record_size & 3) == 0 && record_size <= records.Size - record_offset && "WriteBinaryFn() should append records starting with their int size.");
+            SettingsBinaryAppendRecord(&buf, records.Data + record_offset, (size_t)record_size);
+        }
+        SettingsBinaryEndSection(&buf, section_offset, handler.TypeHash, 4096);
+    }
+    if (text_buf.size() > 0)
+    {
+        const int section_offset = buf.Size;
+        buf.resize(buf.Size + sizeof(ImU32) * 3);
+        SettingsBinaryAppendRecord(&buf, text_buf.c_str(), (size_t)text_buf.size());
+        SettingsBinaryEndSection(&buf, section_offset, 0, 4);
+    }
+    if (out_size)
+        *out_size = (size_t)buf.Size;
+    return buf.Data;
+}
+
+// Add to index, unless it already refers to a valid entry for this ID
+static void WindowSettingsAddToMap(ImGuiWindowSettings* settings)
+{
+    ImGuiContext& g = *GImGui;
+    int* p_offset = g.SettingsWindowsMap.GetIntRef(settings->ID, -1);
+    if (*p_offset == -1 || g.SettingsWindows.ptr_from_offset(*p_offset)->WantDelete)
+        *p_offset = g.SettingsWindows.offset_from_ptr(settings);
+}
+
 ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 {
     ImGuiContext& g = *GImGui;
@@ -15389,22 +16962,27 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     // Allocate chunk
     const size_t chunk_size = sizeof(ImGuiWindowSettings) + name_len + 1;
     ImGuiWindowSettings* settings = g.SettingsWindows.alloc_chunk(chunk_size);
+    memset((void*)settings, 0, (size_t)g.SettingsWindows.chunk_size(settings) - sizeof(int)); // Clear alignment padding after name: chunks are saved as-is in binary settings
     IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
     settings->ID = ImHashStr(name, name_len);
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
 
+    WindowSettingsAddToMap(settings);
     return settings;
 }
 
 // We don't provide a FindWindowSettingsByName() because Docking system doesn't always hold on names.
 // This is called once per window .ini entry + once per newly instantiated window.
+// Entries are indexed in g.SettingsWindowsMap: .ini files may accumulate lots of entries (e.g. from dynamically named windows).
 ImGuiWindowSettings* ImGui::FindWindowSettingsByID(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
-        if (settings->ID == id && !settings->WantDelete)
-            return settings;
-    return NULL;
+    const int offset = g.SettingsWindowsMap.GetInt(id, -1);
+    if (offset == -1)
+        return NULL;
+    ImGuiWindowSettings* settings = g.SettingsWindows.ptr_from_offset(offset);
+    IM_ASSERT(settings->ID == id);
+    return settings->WantDelete ? NULL : settings;
 }
 
 // This is faster if you are holding on a Window already as we don't need to perform a search.
@@ -15436,6 +17014,7 @@ static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandl
     for (ImGuiWindow* window : g.Windows)
         window->SettingsOffset = -1;
     g.SettingsWindows.clear();
+    g.SettingsWindowsMap.Clear();
 }
 
 static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
@@ -15475,10 +17054,10 @@ static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandl
         }
 }
 
-static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+// Gather data from windows that were active during this session
+// (if a window wasn't opened in this session we preserve its settings)
+static void WindowSettingsHandler_GatherAll(ImGuiContext* ctx)
 {
-    // Gather data from windows that were active during this session
-    // (if a window wasn't opened in this session we preserve its settings)
     ImGuiContext& g = *ctx;
     for (ImGuiWindow* window : g.Windows)
     {
@@ -15498,6 +17077,12 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
         settings->Collapsed = window->Collapsed;
         settings->WantDelete = false;
     }
+}
+
+static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
 
     // Write to text buffer
     buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
@@ -15523,6 +17108,48 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
     }
 }
 
+// Read a chunk stored in its in-memory layout by WindowSettingsHandler_WriteBinary().
+// 'data' is not aligned and may point to a memory-mapped file: fields are copied out and bools are normalized.
+static void WindowSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, const void* data, size_t data_size)
+{
+    const char* src = (const char*)data + sizeof(int); // Skip ImChunkStream chunk size
+    const char* name = src + sizeof(ImGuiWindowSettings);
+    if (data_size <= sizeof(int) + sizeof(ImGuiWindowSettings) || memchr(name, 0, data_size - (sizeof(int) + sizeof(ImGuiWindowSettings))) == NULL)
+        return;
+    ImGuiID id;
+    memcpy(&id, src + offsetof(ImGuiWindowSettings, ID), sizeof(id));
+    if (id != ImHashStr(name)) // Settings are indexed by ID: a mismatch would make them unreachable or apply them to another window
+        return;
+
+    ImGuiWindowSettings* settings = ImGui::FindWindowSettingsByID(id);
+    if (settings == NULL)
+        settings = ImGui::CreateNewWindowSettings(name);
+    memcpy(&settings->Pos, src + offsetof(ImGuiWindowSettings, Pos), sizeof(settings->Pos));
+    memcpy(&settings->Size, src + offsetof(ImGuiWindowSettings, Size), sizeof(settings->Size));
+    settings->Collapsed = src[offsetof(ImGuiWindowSettings, Collapsed)] != 0;
+    settings->IsChild = src[offsetof(ImGuiWindowSettings, IsChild)] != 0;
+    settings->WantApply = true;
+    settings->WantDelete = false;
+}
+
+static void WindowSettingsHandler_WriteBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImVector<char>* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
+
+    // Copy chunks (including their size header) in their in-memory layout
+    buf->reserve(buf->Size + g.SettingsWindows.size());
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+    {
+        if (settings->WantDelete)
+            continue;
+        const int chunk_size = g.SettingsWindows.chunk_size(settings);
+        const int offset = buf->Size;
+        buf->resize(offset + chunk_size);
+        memcpy(buf->Data + offset, (const char*)settings - sizeof(int), (size_t)chunk_size);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] LOCALIZATION
 //-----------------------------------------------------------------------------
@@ -15553,6 +17180,7 @@ void ImGuiPlatformIO::ClearPlatformHandlers()
     Platform_OpenInShellUserData = NULL;
     Platform_SetImeDataFn = NULL;
     Platform_ImeUserData = NULL;
+    Platform_RunSettingsWriteFn = NULL;
 }
 
 void ImGuiPlatformIO::ClearRendererHandlers()
@@ -15855,6 +17483,116 @@ static void Platform_SetImeDataFn_DefaultImpl(ImGuiContext*, ImGuiViewport*, ImG
 
 #endif // Default IME handlers
 
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// - ProfilerGetTime() [Internal]
+// - ProfilerNewFrame() [Internal]
+// - ProfilerZoneBegin() [Internal]
+// - ProfilerZoneEnd() [Internal]
+//-----------------------------------------------------------------------------
+// Enabled by '#define IMGUI_ENABLE_PROFILER' in imconfig.h. Recorded zones are displayed in 'Metrics->Profiler'.
+// - A profiler frame runs from one NewFrame() call to the next one, so it also includes time spent by the application.
+// - Zones are recorded into g.Profiler.CurrFrame, which is swapped with g.Profiler.LastFrame by NewFrame().
+// - Zones submitted while there is no current context (e.g. from ImFontAtlas functions) are ignored.
+// - Context hook callbacks are recorded as zones: register a hook (e.g. ImGuiContextHookType_NewFramePost)
+//   to add your own zones at given points of the frame, or use IMGUI_PROFILER_ZONE() anywhere in your code.
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+ImU64 ImGui::ProfilerGetTime()
+{
+    static const ImU64 freq = []() { LARGE_INTEGER frequency; ::QueryPerformanceFrequency(&frequency); return (ImU64)frequency.QuadPart; }(); // Thread-safe initialization
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return ((ImU64)counter.QuadPart / freq) * 1000000000 + ((ImU64)counter.QuadPart % freq) * 1000000000 / freq; // Split to avoid overflow
+}
+#elif defined(CLOCK_MONOTONIC)
+ImU64 ImGui::ProfilerGetTime()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+}
+#else
+ImU64 ImGui::ProfilerGetTime()
+{
+    return (ImU64)clock() * 1000000000 / CLOCKS_PER_SEC; // Low precision fallback
+}
+#endif
+
+// Called by NewFrame(): complete current frame, apply Enabled setting and start a new frame.
+void ImGui::ProfilerNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& profiler = g.Profiler;
+    const ImU64 time = ProfilerGetTime();
+    if (profiler.Recording)
+    {
+        // Close zones left open (e.g. NewFrame() called from within a zone)
+        for (int zone_idx : profiler.ZoneStack)
+            profiler.CurrFrame.Zones[zone_idx].TimeEnd = time;
+        profiler.ZoneStack.resize(0);
+        profiler.CurrFrame.TimeEnd = time;
+        profiler.LastFrame.Swap(profiler.CurrFrame);
+
+        ImGuiProfilerFrame& last_frame = profiler.LastFrame;
+        const ImU64 frame_duration = last_frame.TimeEnd - last_frame.TimeBegin;
+        profiler.FrameTimes[profiler.FrameTimesIdx] = (float)((double)frame_duration / 1000000.0);
+        profiler.FrameTimesIdx = (profiler.FrameTimesIdx + 1) % IM_ARRAYSIZE(profiler.FrameTimes);
+        if (frame_duration > profiler.SlowestFrame.TimeEnd - profiler.SlowestFrame.TimeBegin)
+        {
+            profiler.SlowestFrame.FrameCount = last_frame.FrameCount;
+            profiler.SlowestFrame.TimeBegin = last_frame.TimeBegin;
+            profiler.SlowestFrame.TimeEnd = last_frame.TimeEnd;
+            profiler.SlowestFrame.Zones = last_frame.Zones;
+        }
+    }
+    profiler.Recording = profiler.Enabled;
+    profiler.CurrFrame.Clear();
+    profiler.CurrFrame.FrameCount = g.FrameCount + 1; // NewFrame() increments g.FrameCount after calling us
+    profiler.CurrFrame.TimeBegin = time;
+}
+
+void ImGui::ProfilerZoneBegin(const char* name, ImGuiID id)
+{
+    ImGuiContext* ctx = GImGui;
+    if (ctx == NULL || !ctx->Profiler.Recording) // May be called by ImFontAtlas functions operating without a context.
+        return;
+    ImGuiProfiler& profiler = ctx->Profiler;
+    ImGuiProfilerFrame& frame = profiler.CurrFrame;
+    profiler.ZoneStack.push_back(frame.Zones.Size);
+    frame.Zones.resize(frame.Zones.Size + 1);
+    ImGuiProfilerZone& zone = frame.Zones.back();
+    zone.Name = name;
+    zone.ID = id;
+    zone.Depth = profiler.ZoneStack.Size - 1;
+    zone.TimeEnd = 0;
+    zone.TimeBegin = ProfilerGetTime();
+}
+
+void ImGui::ProfilerZoneEnd()
+{
+    ProfilerZoneEndEx(GImGui);
+}
+
+// End zone on the context it began on (e.g. ImGuiProfilerZoneScope spanning a SetCurrentContext() call)
+void ImGui::ProfilerZoneEndEx(ImGuiContext* ctx)
+{
+    const ImU64 time = ProfilerGetTime();
+    if (ctx == NULL || !ctx->Profiler.Recording)
+        return;
+    ImGuiProfiler& profiler = ctx->Profiler;
+    if (profiler.ZoneStack.Size == 0) // Zone began before recording started, or closed by ProfilerNewFrame().
+        return;
+    profiler.CurrFrame.Zones[profiler.ZoneStack.back()].TimeEnd = time;
+    profiler.ZoneStack.pop_back();
+}
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUGGER WINDOW
 //-----------------------------------------------------------------------------
@@ -15874,6 +17612,7 @@ static void Platform_SetImeDataFn_DefaultImpl(ImGuiContext*, ImGuiViewport*, ImG
 // - DebugNodeDrawCmdShowMeshAndBoundingBox() [Internal]
 // - DebugNodeFont() [Internal]
 // - DebugNodeFontGlyph() [Internal]
+// - DebugNodeProfiler() [Internal]
 // - DebugNodeStorage() [Internal]
 // - DebugNodeTabBar() [Internal]
 // - DebugNodeViewport() [Internal]
@@ -16459,9 +18198,9 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         MetricsHelpMarker("You can also call ImGui::DebugTextEncoding() from your code with a given string to test that your UTF-8 encoding settings are correct.");
         if (cfg->ShowTextEncodingViewer)
         {
-            static char buf[64] = "";
+            char* buf = cfg->TextEncodingViewerBuf;
             SetNextItemWidth(-FLT_MIN);
-            InputText("##DebugTextEncodingBuf", buf, IM_ARRAYSIZE(buf));
+            InputText("##DebugTextEncodingBuf", buf, IM_ARRAYSIZE(cfg->TextEncodingViewerBuf));
             if (buf[0] != 0)
                 DebugTextEncoding(buf);
         }
@@ -16669,6 +18408,14 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+#ifdef IMGUI_ENABLE_PROFILER
+    if (TreeNode("Profiler"))
+    {
+        DebugNodeProfiler(&g.Profiler);
+        TreePop();
+    }
+#endif
+
     if (TreeNode("Inputs"))
     {
         Text("KEYBOARD/GAMEPAD/MOUSE KEYS");
@@ -17142,6 +18889,8 @@ void ImGui::DebugNodeFont(ImFont* font)
         {
             const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
             Text("Loader: '%s'", loader->Name ? loader->Name : "N/A");
+            if (loader->FontSrcGetCacheSize != NULL && src->FontLoaderData != NULL)
+                Text("Loader cache: %d bytes", (int)loader->FontSrcGetCacheSize(atlas, src));
 #ifdef IMGUI_ENABLE_FREETYPE
             if (loader->Name != NULL && strcmp(loader->Name, "FreeType") == 0)
             {
@@ -17204,8 +18953,11 @@ void ImGui::DebugNodeFont(ImFont* font)
         if (TreeNode("Glyphs", "Baked at { %.2fpx, d.%.2f }: %d glyphs%s", baked->Size, baked->RasterizerDensity, baked->Glyphs.Size, (baked->LastUsedFrame < atlas->Builder->FrameCount - 1) ? " *Unused*" : ""))
         {
             if (SmallButton("Load all"))
+            {
+                ImFontAtlasThreadLockScope lock(atlas);
                 for (unsigned int base = 0; base <= IM_UNICODE_CODEPOINT_MAX; base++)
                     baked->FindGlyph((ImWchar)base);
+            }
 
             const int surface_sqrt = (int)ImSqrt((float)baked->MetricsTotalSurface);
             Text("Ascent: %f, Descent: %f, Ascent-Descent: %f", baked->Ascent, baked->Descent, baked->Ascent - baked->Descent);
@@ -17246,10 +18998,13 @@ void ImGui::DebugNodeFontGlyphesForSrcMask(ImFont* font, ImFontBaked* baked, int
         }
 
         int count = 0;
-        for (unsigned int n = 0; n < 256; n++)
-            if (const ImFontGlyph* glyph = baked->IsGlyphLoaded((ImWchar)(base + n)) ? baked->FindGlyph((ImWchar)(base + n)) : NULL)
-                if (src_mask & (1 << glyph->SourceIdx))
-                    count++;
+        {
+            ImFontAtlasThreadLockScope lock(font->ContainerAtlas);
+            for (unsigned int n = 0; n < 256; n++)
+                if (const ImFontGlyph* glyph = baked->IsGlyphLoaded((ImWchar)(base + n)) ? baked->FindGlyph((ImWchar)(base + n)) : NULL)
+                    if (src_mask & (1 << glyph->SourceIdx))
+                        count++;
+        }
         if (count <= 0)
             continue;
         if (!TreeNode((void*)(intptr_t)base, "U+%04X..U+%04X (%d %s)", base, base + 255, count, count > 1 ? "glyphs" : "glyph"))
@@ -17263,7 +19018,15 @@ void ImGui::DebugNodeFontGlyphesForSrcMask(ImFont* font, ImFontBaked* baked, int
             // available here and thus cannot easily generate a zero-terminated UTF-8 encoded string.
             ImVec2 cell_p1(base_pos.x + (n % 16) * (cell_size + cell_spacing), base_pos.y + (n / 16) * (cell_size + cell_spacing));
             ImVec2 cell_p2(cell_p1.x + cell_size, cell_p1.y + cell_size);
-            const ImFontGlyph* glyph = baked->IsGlyphLoaded((ImWchar)(base + n)) ? baked->FindGlyph((ImWchar)(base + n)) : NULL;
+            ImFontGlyph glyph_copy; // Copy as glyph pointers are not stable when atlas is shared with other threads
+            bool glyph_loaded;
+            {
+                ImFontAtlasThreadLockScope lock(font->ContainerAtlas);
+                glyph_loaded = baked->IsGlyphLoaded((ImWchar)(base + n));
+                if (glyph_loaded)
+                    glyph_copy = *baked->FindGlyph((ImWchar)(base + n));
+            }
+            const ImFontGlyph* glyph = glyph_loaded ? &glyph_copy : NULL;
             draw_list->AddRect(cell_p1, cell_p2, glyph ? IM_COL32(255, 255, 255, 100) : IM_COL32(255, 255, 255, 50));
             if (!glyph || (src_mask & (1 << glyph->SourceIdx)) == 0)
                 continue;
@@ -17295,10 +19058,166 @@ void ImGui::DebugNodeFontGlyph(ImFont* font, const ImFontGlyph* glyph)
     Text("SourceIdx: %d", glyph->SourceIdx);
 }
 
+#ifdef IMGUI_ENABLE_PROFILER
+struct ImGuiProfilerZoneStats
+{
+    const char* Name;
+    int         Count;
+    double      TotalMs;
+    double      SelfMs;
+    double      MaxMs;
+};
+
+static int IMGUI_CDECL ProfilerZoneStatsComparerByTotalTime(const void* lhs, const void* rhs)
+{
+    const ImGuiProfilerZoneStats* a = (const ImGuiProfilerZoneStats*)lhs;
+    const ImGuiProfilerZoneStats* b = (const ImGuiProfilerZoneStats*)rhs;
+    return (a->TotalMs > b->TotalMs) ? -1 : (a->TotalMs < b->TotalMs) ? +1 : 0;
+}
+
+// [DEBUG] Display recorded profiler zones: flame graph of a frame + statistics aggregated by zone name.
+void ImGui::DebugNodeProfiler(ImGuiProfiler* profiler)
+{
+    ImGuiContext& g = *GImGui;
+    Checkbox("Record", &profiler->Enabled);
+    SameLine();
+    Checkbox("Show slowest frame", &profiler->DisplaySlowestFrame);
+    SameLine();
+    if (SmallButton("Reset slowest"))
+        profiler->SlowestFrame.Clear();
+    SameLine();
+    MetricsHelpMarker("Frames are measured from one NewFrame() call to the next one, including time spent by the application.\nZones are recorded when IMGUI_ENABLE_PROFILER is defined. Hover zones for details.");
+
+    char overlay[32];
+    ImFormatString(overlay, IM_ARRAYSIZE(overlay), "%.3f ms", profiler->FrameTimes[(profiler->FrameTimesIdx + IM_ARRAYSIZE(profiler->FrameTimes) - 1) % IM_ARRAYSIZE(profiler->FrameTimes)]);
+    PlotLines("##FrameTimes", profiler->FrameTimes, IM_ARRAYSIZE(profiler->FrameTimes), profiler->FrameTimesIdx, overlay, 0.0f, FLT_MAX, ImVec2(-FLT_MIN, 40.0f));
+
+    const ImGuiProfilerFrame* frame = profiler->DisplaySlowestFrame ? &profiler->SlowestFrame : &profiler->LastFrame;
+    if (frame->Zones.Size == 0 || frame->TimeEnd <= frame->TimeBegin)
+    {
+        TextDisabled("No zones recorded.");
+        return;
+    }
+    const double frame_ms = (double)(frame->TimeEnd - frame->TimeBegin) / 1000000.0;
+    Text("Frame %d: %.3f ms, %d zones", frame->FrameCount, frame_ms, frame->Zones.Size);
+
+    // Calculate self times (duration minus duration of direct children). Children are stored right after their parent.
+    ImVector<double> zones_self_ms;
+    ImVector<int> parent_stack;
+    zones_self_ms.resize(frame->Zones.Size);
+    int max_depth = 0;
+    for (int zone_n = 0; zone_n < frame->Zones.Size; zone_n++)
+    {
+        const ImGuiProfilerZone* zone = &frame->Zones[zone_n];
+        zones_self_ms[zone_n] = (double)(zone->TimeEnd - zone->TimeBegin) / 1000000.0;
+        if (zone->Depth > 0 && zone->Depth <= parent_stack.Size)
+            zones_self_ms[parent_stack[zone->Depth - 1]] -= zones_self_ms[zone_n];
+        parent_stack.resize(zone->Depth + 1);
+        parent_stack[zone->Depth] = zone_n;
+        max_depth = ImMax(max_depth, zone->Depth);
+    }
+
+    // Flame graph
+    SetNextItemWidth(GetFontSize() * 12);
+    SliderFloat("Zoom", &profiler->DisplayZoom, 1.0f, 200.0f, "%.1fx", ImGuiSliderFlags_Logarithmic);
+    const float row_height = GetTextLineHeightWithSpacing();
+    const float graph_height = (max_depth + 1) * row_height;
+    if (BeginChild("##FlameGraph", ImVec2(-FLT_MIN, graph_height + g.Style.ScrollbarSize + g.Style.WindowPadding.y * 2.0f), ImGuiChildFlags_Borders, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        ImGuiWindow* window = g.CurrentWindow;
+        ImDrawList* draw_list = window->DrawList;
+        const ImVec2 origin = window->DC.CursorPos;
+        const float graph_width = ImTrunc(GetContentRegionAvail().x * profiler->DisplayZoom);
+        const double scale = graph_width / (double)(frame->TimeEnd - frame->TimeBegin);
+        Dummy(ImVec2(graph_width, graph_height));
+        const bool graph_hovered = IsWindowHovered();
+        int hovered_zone_n = -1;
+        for (int zone_n = 0; zone_n < frame->Zones.Size; zone_n++)
+        {
+            const ImGuiProfilerZone* zone = &frame->Zones[zone_n];
+            const float x0 = origin.x + (float)((double)(zone->TimeBegin - frame->TimeBegin) * scale);
+            const float x1 = ImMax(origin.x + (float)((double)(zone->TimeEnd - frame->TimeBegin) * scale), x0 + 1.0f);
+            if (x1 < window->ClipRect.Min.x || x0 > window->ClipRect.Max.x)
+                continue;
+            ImRect bb(x0, origin.y + zone->Depth * row_height, x1, origin.y + (zone->Depth + 1) * row_height - 1.0f);
+            float col_r, col_g, col_b;
+            ColorConvertHSVtoRGB((ImHashStr(zone->Name) & 0xFF) / 255.0f, 0.50f, 0.55f, col_r, col_g, col_b);
+            draw_list->AddRectFilled(bb.Min, bb.Max, ColorConvertFloat4ToU32(ImVec4(col_r, col_g, col_b, 1.0f)));
+            if (bb.GetWidth() > g.FontSize)
+                RenderTextEllipsis(draw_list, bb.Min + ImVec2(2.0f, 0.0f), bb.Max, bb.Max.x, zone->Name, NULL, NULL);
+            if (graph_hovered && bb.Contains(g.IO.MousePos))
+            {
+                hovered_zone_n = zone_n;
+                draw_list->AddRect(bb.Min, bb.Max, IM_COL32(255, 255, 255, 255));
+            }
+        }
+        if (hovered_zone_n != -1 && BeginTooltip())
+        {
+            const ImGuiProfilerZone* zone = &frame->Zones[hovered_zone_n];
+            Text("%s", zone->Name);
+            if (ImGuiWindow* zone_window = zone->ID ? FindWindowByID(zone->ID) : NULL)
+                Text("Window: \"%s\"", zone_window->Name);
+            else if (zone->ID != 0)
+                Text("ID: 0x%08X", zone->ID);
+            Text("Duration: %.3f ms (self: %.3f ms)", (double)(zone->TimeEnd - zone->TimeBegin) / 1000000.0, zones_self_ms[hovered_zone_n]);
+            Text("Start: +%.3f ms", (double)(zone->TimeBegin - frame->TimeBegin) / 1000000.0);
+            EndTooltip();
+        }
+    }
+    EndChild();
+
+    // Statistics aggregated by zone name
+    ImVector<ImGuiProfilerZoneStats> stats;
+    ImGuiStorage stats_idx_storage;
+    for (int zone_n = 0; zone_n < frame->Zones.Size; zone_n++)
+    {
+        const ImGuiProfilerZone* zone = &frame->Zones[zone_n];
+        int* stats_idx = stats_idx_storage.GetIntRef(ImHashStr(zone->Name), -1);
+        if (*stats_idx == -1)
+        {
+            *stats_idx = stats.Size;
+            ImGuiProfilerZoneStats new_stats = { zone->Name, 0, 0.0, 0.0, 0.0 };
+            stats.push_back(new_stats);
+        }
+        ImGuiProfilerZoneStats* zone_stats = &stats[*stats_idx];
+        const double zone_ms = (double)(zone->TimeEnd - zone->TimeBegin) / 1000000.0;
+        zone_stats->Count++;
+        zone_stats->TotalMs += zone_ms; // FIXME: Recursive zones (e.g. "Window" for child windows) are counted multiple times.
+        zone_stats->SelfMs += zones_self_ms[zone_n];
+        zone_stats->MaxMs = ImMax(zone_stats->MaxMs, zone_ms);
+    }
+    ImQsort(stats.Data, (size_t)stats.Size, sizeof(ImGuiProfilerZoneStats), ProfilerZoneStatsComparerByTotalTime);
+    if (BeginTable("##ProfilerStats", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 12)))
+    {
+        TableSetupScrollFreeze(0, 1);
+        TableSetupColumn("Zone", ImGuiTableColumnFlags_WidthStretch);
+        TableSetupColumn("Count");
+        TableSetupColumn("Total (ms)");
+        TableSetupColumn("Self (ms)");
+        TableSetupColumn("Max (ms)");
+        TableHeadersRow();
+        for (const ImGuiProfilerZoneStats& zone_stats : stats)
+        {
+            TableNextColumn();
+            TextUnformatted(zone_stats.Name);
+            TableNextColumn();
+            Text("%d", zone_stats.Count);
+            TableNextColumn();
+            Text("%.3f", zone_stats.TotalMs);
+            TableNextColumn();
+            Text("%.3f", zone_stats.SelfMs);
+            TableNextColumn();
+            Text("%.3f", zone_stats.MaxMs);
+        }
+        EndTable();
+    }
+}
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
-    if (!TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+    if (!TreeNode(label, "%s: %d entries, %d bytes%s", label, storage->Data.Size, storage->Data.size_in_bytes() + storage->HashIndex.size_in_bytes(), storage->IsHashed() ? ", hashed" : ""))
         return;
     for (const ImGuiStoragePair& p : storage->Data)
     {
@@ -17366,6 +19285,8 @@ void ImGui::DebugNodeViewport(ImGuiViewportP* viewport)
             (flags & ImGuiViewportFlags_IsPlatformWindow)  ? " IsPlatformWindow"  : "",
             (flags & ImGuiViewportFlags_IsPlatformMonitor) ? " IsPlatformMonitor" : "",
             (flags & ImGuiViewportFlags_OwnedByApp)        ? " OwnedByApp"        : "");
+        if (viewport->DrawDataP.DamageRectsValid)
+            BulletText("DamageRects: %d", viewport->DrawDataP.DamageRects.Size);
         for (ImDrawList* draw_list : viewport->DrawDataP.CmdLists)
             DebugNodeDrawList(NULL, viewport, draw_list, "DrawList");
         TreePop();
@@ -17983,6 +19904,9 @@ void ImGui::DebugNodeDrawList(ImGuiWindow*, ImGuiViewportP*, const ImDrawList*,
 void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList*, const ImDrawList*, const ImDrawCmd*, bool, bool) {}
 void ImGui::DebugNodeFont(ImFont*) {}
 void ImGui::DebugNodeFontGlyphesForSrcMask(ImFont*, ImFontBaked*, int) {}
+#ifdef IMGUI_ENABLE_PROFILER
+void ImGui::DebugNodeProfiler(ImGuiProfiler*) {}
+#endif
 void ImGui::DebugNodeStorage(ImGuiStorage*, const char*) {}
 void ImGui::DebugNodeTabBar(ImGuiTabBar*, const char*) {}
 void ImGui::DebugNodeWindow(ImGuiWindow*, const char*) {}
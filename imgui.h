@@ -401,6 +401,8 @@ namespace ImGui
     IMGUI_API void          EndFrame();                                 // ends the Dear ImGui frame. automatically called by Render(). If you don't need to render data (skipping rendering) you may call EndFrame() without Render()... but you'll have wasted CPU already! If you don't need to render, better to not create any windows and not call NewFrame() at all!
     IMGUI_API void          Render();                                   // ends the Dear ImGui frame, finalize the draw data. You can then get call GetDrawData().
     IMGUI_API ImDrawData*   GetDrawData();                              // valid after Render() and until the next call to NewFrame(). Call ImGui_ImplXXXX_RenderDrawData() function in your Renderer Backend to render.
+    IMGUI_API ImDrawData*   AcquireDrawData(ImGuiContext* ctx);         // [EXPERIMENTAL] with io.ConfigDrawDataBuffers >= 2, from your render thread: get latest draw data published by Render() and hold it until next AcquireDrawData()/ReleaseDrawData() call. NULL if nothing was published yet. Hold the font atlas lock (ImFontAtlas::ThreadLockFunc) while your renderer handles ImDrawData::Textures[] requests, as main thread may add glyphs to them. Textures referenced by held draw data are not destroyed until it is released.
+    IMGUI_API void          ReleaseDrawData(ImGuiContext* ctx);         // [EXPERIMENTAL] release draw data held by AcquireDrawData().
 
     // Demo, Debug, Information
     IMGUI_API void          ShowDemoWindow(bool* p_open = NULL);        // create Demo window. demonstrate most ImGui features. call this to learn about the library! try to make it always available in your application!
@@ -1032,6 +1034,7 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API void          SetNextFrameWantRender(float delay = 0.0f);                         // request a new frame within 'delay' seconds even without new inputs (e.g. when animating something with GetTime()). Lowers io.WantRenderTimeout, or sets io.WantRender when 'delay <= 0.0f'. See io.WantRender.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
@@ -1115,10 +1118,14 @@ namespace ImGui
     // - The disk functions are automatically called if io.IniFilename != NULL (default is "imgui.ini").
     // - Set io.IniFilename to NULL to load/save manually. Read io.WantSaveIniSettings description about handling .ini saving manually.
     // - Important: default value "imgui.ini" is relative to current working dir! Most apps will want to lock this to an absolute path (e.g. same path as executables).
+    // - Binary settings are faster to save and load, at the cost of being unreadable and only compatible with the same build/version. Loading functions detect the format automatically.
+    //   Records are checksummed: a record torn by a crash while saving is ignored on load. Set platform_io.Platform_RunSettingsWriteFn to write files from another thread.
     IMGUI_API void          LoadIniSettingsFromDisk(const char* ini_filename);                  // call after CreateContext() and before the first call to NewFrame(). NewFrame() automatically calls LoadIniSettingsFromDisk(io.IniFilename).
-    IMGUI_API void          LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size=0); // call after CreateContext() and before the first call to NewFrame() to provide .ini data from your own data source.
-    IMGUI_API void          SaveIniSettingsToDisk(const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext).
+    IMGUI_API void          LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size=0); // call after CreateContext() and before the first call to NewFrame() to provide .ini data from your own data source. For binary data, 'ini_size' is required and 'ini_data' may be memory-mapped.
+    IMGUI_API void          SaveIniSettingsToDisk(const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext). Calls SaveBinarySettingsToDisk() if io.IniUseBinaryFormat is set.
     IMGUI_API const char*   SaveIniSettingsToMemory(size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings.
+    IMGUI_API void          SaveBinarySettingsToDisk(const char* filename);                     // save binary settings. Only the parts of the file which changed since it was last saved or loaded are rewritten, possibly on another thread (see platform_io.Platform_RunSettingsWriteFn).
+    IMGUI_API const void*   SaveBinarySettingsToMemory(size_t* out_size);                       // return binary settings data. This only copies records (no formatting), and data stays valid until the next call: you may write it from another thread.
 
     // Debug Utilities
     // - Your main debugging friend is the ShowMetricsWindow() function, which is also accessible from Demo->Tools->Metrics Debugger
@@ -2383,6 +2390,7 @@ struct ImGuiIO
     float       DeltaTime;                      // = 1.0f/60.0f     // Time elapsed since last frame, in seconds. May change every frame.
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file (important: default "imgui.ini" is relative to current working dir!). Set NULL to disable automatic .ini loading/saving or if you want to manually call LoadIniSettingsXXX() / SaveIniSettingsXXX() functions.
+    bool        IniUseBinaryFormat;             // = false          // Save io.IniFilename using a compact binary format (see SaveBinarySettingsToDisk()). Loading detects the format automatically.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
     void*       UserData;                       // = NULL           // Store your own data.
 
@@ -2405,6 +2413,7 @@ struct ImGuiIO
     bool        MouseDrawCursor;                // = false          // Request ImGui to draw a mouse cursor for you (if you are on a platform without a mouse cursor). Cannot be easily renamed to 'io.ConfigXXX' because this is frequently used by backend implementations.
     bool        ConfigMacOSXBehaviors;          // = defined(__APPLE__) // Swap Cmd<>Ctrl keys + OS X style text editing cursor movement using Alt instead of Ctrl, Shortcuts using Cmd/Super instead of Ctrl, Line/Text Start and End using Cmd+Arrows instead of Home/End, Double click selects by word instead of selecting whole text, Multi-selection in lists uses Cmd/Super instead of Ctrl.
     bool        ConfigInputTrickleEventQueue;   // = true           // Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.
+    bool        ConfigInputCoalesceMouseEvents; // = false          // Merge consecutive mouse move events, and consecutive mouse wheel events, as they are submitted. Keeps input queue small with high-rate mice/pens. Button/key/text events are never merged so trickling is unaffected, but internal g.InputEventsTrail[] loses intermediate mouse positions.
     bool        ConfigInputTextCursorBlink;     // = true           // Enable blinking cursor (optional as some users consider it to be distracting).
     bool        ConfigInputTextEnterKeepActive; // = false          // [BETA] Pressing Enter will keep item active and select contents (single-line only).
     bool        ConfigDragClickToInputText;     // = false          // [BETA] Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving). Not desirable on devices without a keyboard.
@@ -2412,6 +2421,8 @@ struct ImGuiIO
     bool        ConfigWindowsMoveFromTitleBarOnly;  // = false      // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] CTRL+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
+    bool        ConfigDrawDataDamageRects;      // = false          // [EXPERIMENTAL] Compute ImDrawData::DamageRects[] in Render(): regions of the display which changed since the previous Render(), for partial redraws or streaming. Hashes all vertices/indices every frame.
+    int         ConfigDrawDataBuffers;          // = 0              // [EXPERIMENTAL] When >= 2 (double/triple buffering): Render() publishes draw data into one of N buffers, for a render thread to use with AcquireDrawData() while next frame is being built. Buffers are swapped with live draw lists, not copied. Set before first frame. Requires io.Fonts->ThreadLockFunc/ThreadUnlockFunc (see AcquireDrawData()).
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
 
     // Inputs Behaviors
@@ -2505,6 +2516,7 @@ struct ImGuiIO
     IMGUI_API void  SetKeyEventNativeData(ImGuiKey key, int native_keycode, int native_scancode, int native_legacy_index = -1); // [Optional] Specify index for legacy <1.87 IsKeyXXX() functions with native indices + specify native keycode, scancode.
     IMGUI_API void  SetAppAcceptingEvents(bool accepting_events);           // Set master flag for accepting key/mouse/text events (default to true). Useful if you have native dialog boxes that are interrupting your application loop/refresh, and you want to disable events being queued while your app is frozen.
     IMGUI_API void  ClearEventsQueue();                                     // Clear all incoming events.
+    IMGUI_API void  SetInputEventsThreaded(bool threaded, int capacity = 1024); // [EXPERIMENTAL] Allow calling the AddXXX() functions above from any thread at any time: events go through a lock-free queue and are forwarded by NewFrame(). Call from main thread while no other thread is submitting events. Events are dropped when the queue is full. Requires atomic intrinsics (MSVC, GCC, Clang): otherwise asserts and stays disabled.
     IMGUI_API void  ClearInputKeys();                                       // Clear current keyboard/gamepad state + current frame text input buffer. Equivalent to releasing all keys/buttons.
     IMGUI_API void  ClearInputMouse();                                      // Clear current mouse state.
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
@@ -2522,8 +2534,10 @@ struct ImGuiIO
     bool        WantTextInput;                      // Mobile/console: when set, you may display an on-screen keyboard. This is set by Dear ImGui when it wants textual keyboard input to happen (e.g. when a InputText widget is active).
     bool        WantSetMousePos;                    // MousePos has been altered, backend should reposition mouse on next frame. Rarely used! Set only when io.ConfigNavMoveSetMousePos is enabled.
     bool        WantSaveIniSettings;                // When manual .ini load/save is active (io.IniFilename == NULL), this will be set to notify your application that you can call SaveIniSettingsToMemory() and save yourself. Important: clear io.WantSaveIniSettings yourself after saving!
+    bool        WantRender;                         // Set by EndFrame() when the next frame may differ from the last one (pending or just processed inputs, active item, animation or timer in progress, window still settling its layout, etc.). When false, your application may skip NewFrame()/Render() and block until new inputs arrive, or until io.WantRenderTimeout elapses. Default to true.
     bool        NavActive;                          // Keyboard/Gamepad navigation is currently allowed (will handle ImGuiKey_NavXXX events) = a window is focused and it doesn't use the ImGuiWindowFlags_NoNavInputs flag.
     bool        NavVisible;                         // Keyboard/Gamepad navigation highlight is visible and allowed (will handle ImGuiKey_NavXXX events).
+    float       WantRenderTimeout;                  // When io.WantRender is false: time in seconds after which a new frame is needed even without new inputs (e.g. hover delay, text cursor blinking). FLT_MAX when only new inputs require a new frame. e.g. pass to glfwWaitEventsTimeout() or SDL_WaitEventTimeout().
     float       Framerate;                          // Estimate of application framerate (rolling average over 60 frames, based on io.DeltaTime), in frame per second. Solely for convenience. Slow applications may not want to use a moving average or may want to reset underlying buffers occasionally.
     int         MetricsRenderVertices;              // Vertices output during last call to Render()
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
@@ -2759,6 +2773,7 @@ struct ImGuiStoragePair
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
 // This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// For large storages with frequent insertions (e.g. 100k+ tree nodes), use SetHashed(true) or '#define IMGUI_USE_HASHED_STORAGE' to make lookups and insertions O(1).
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -2766,12 +2781,16 @@ struct ImGuiStoragePair
 struct ImGuiStorage
 {
     // [Internal]
-    ImVector<ImGuiStoragePair>      Data;
+    ImVector<ImGuiStoragePair>      Data;           // Sorted by key, unless hashed: then stored in insertion order.
+    ImVector<int>                   HashIndex;      // When hashed: open-addressing table of indices into Data (-1 = empty slot). Size is a power of two.
+    signed char                     HashMode;       // 0: default (sorted unless IMGUI_USE_HASHED_STORAGE is defined), +1: hashed, -1: sorted. Zero-initialized structures get the default.
 
-    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
+    ImGuiStorage()      { HashMode = 0; }
+
+    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N), or O(1) when hashed.
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    void                Clear() { Data.clear(); HashIndex.clear(); }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2791,7 +2810,11 @@ struct ImGuiStorage
     IMGUI_API void**    GetVoidPtrRef(ImGuiID key, void* default_val = NULL);
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // (this also rebuilds the index of a hashed storage: call it after modifying Data[] directly)
     IMGUI_API void      BuildSortByKey();
+    // Advanced: switch between sorted (compact, O(log N) lookup, O(N) insertion) and hashed (O(1) lookup and insertion, Data[] in insertion order).
+    IMGUI_API void      SetHashed(bool hashed);
+    IMGUI_API bool      IsHashed() const;
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
@@ -3410,13 +3433,15 @@ struct ImDrawData
     ImVec2              FramebufferScale;   // Amount of pixels for each unit of DisplaySize. Copied from viewport->FramebufferScale (== io.DisplayFramebufferScale for main viewport). Generally (1,1) on normal display, (2,2) on OSX with Retina display.
     ImGuiViewport*      OwnerViewport;      // Viewport carrying the ImDrawData instance, might be of use to the renderer (generally not).
     ImVector<ImTextureData*>* Textures;     // List of textures to update. Most of the times the list is shared by all ImDrawData, has only 1 texture and it doesn't need any update. This almost always points to ImGui::GetPlatformIO().Textures[]. May be overriden or set to NULL if you want to manually update textures.
+    ImVector<ImVec4>    DamageRects;        // Regions (x1,y1,x2,y2) which changed since the previous Render(), in the same coordinates as ImDrawCmd::ClipRect. Empty when nothing changed. Only computed when io.ConfigDrawDataDamageRects is set.
+    bool                DamageRectsValid;   // DamageRects[] was computed for this frame. When false, consider the whole display as damaged.
 
     // Functions
     ImDrawData()    { Clear(); }
     IMGUI_API void  Clear();
     IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData.
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
-    IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd (and DamageRects[]). Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
 
 //-----------------------------------------------------------------------------
@@ -3483,6 +3508,9 @@ struct ImTextureData
     bool                UseColors;              // w    r   // Tell whether our texture data is known to use colors (rather than just white + alpha).
     bool                WantDestroyNextFrame;   // rw   -   // [Internal] Queued to set ImTextureStatus_WantDestroy next frame. May still be used in the current frame.
 
+    //------------------------------------------ [Internal] Don't use! Not for backends -----------------
+    unsigned short      UseCount;               // Number of draw list users (contexts, draw data buffers) which may still reference this texture. Destroying is deferred until it reaches zero.
+
     // Functions
     ImTextureData()     { memset(this, 0, sizeof(*this)); Status = ImTextureStatus_Destroyed; TexID = ImTextureID_Invalid; }
     ~ImTextureData()    { DestroyPixels(); }
@@ -3630,7 +3658,7 @@ struct ImFontAtlas
     IMGUI_API ImFont*           AddFontDefault(const ImFontConfig* font_cfg = NULL);
     IMGUI_API ImFont*           AddFontFromFileTTF(const char* filename, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);
     IMGUI_API ImFont*           AddFontFromMemoryTTF(void* font_data, int font_data_size, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // Note: Transfer ownership of 'ttf_data' to ImFontAtlas! Will be deleted after destruction of the atlas. Set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed.
-    IMGUI_API ImFont*           AddFontFromMemoryCompressedTTF(const void* compressed_font_data, int compressed_font_data_size, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp.
+    IMGUI_API ImFont*           AddFontFromMemoryCompressedTTF(const void* compressed_font_data, int compressed_font_data_size, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp (default or -lz4 format, detected automatically).
     IMGUI_API ImFont*           AddFontFromMemoryCompressedBase85TTF(const char* compressed_font_data_base85, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);              // 'compressed_font_data_base85' still owned by caller. Compress with binary_to_compressed_c.cpp with -base85 parameter.
     IMGUI_API void              RemoveFont(ImFont* font);
 
@@ -3638,6 +3666,19 @@ struct ImFontAtlas
     IMGUI_API void              CompactCache();             // Compact cached glyphs and texture.
     IMGUI_API void              SetFontLoader(const ImFontLoader* font_loader); // Change font loader at runtime.
 
+    // Glyph preloading
+    // - Queue glyphs to be baked ahead of their first use (e.g. during a loading screen), to avoid stalls when they first appear during interaction.
+    // - 'glyph_ranges' is a zero-terminated list of inclusive pairs, e.g. GetGlyphRangesDefault() or the output of ImFontGlyphRangesBuilder::BuildRanges(). Data is copied.
+    // - Pending requests are processed by NewFrame() within a budget of 'PreloadGlyphsPerFrame' glyphs per frame, each frame publishing its own texture update.
+    // - Call ProcessPreloadRequests() to process them all at once: new glyphs will then be published in a single texture update.
+    // - Background bake: when using ThreadLockFunc/ThreadUnlockFunc, ProcessPreloadRequests() may be called from a worker thread with no current
+    //   Dear ImGui context (e.g. with IMGUI_USE_THREAD_LOCAL_CONTEXT), while contexts keep running. The lock is held during the call, so other threads
+    //   wait for it when they need the atlas: pass a 'max_glyphs' budget and call it repeatedly to bake in smaller steps. Set PreloadGlyphsPerFrame to 0
+    //   to leave all baking to the worker. Texture changes (e.g. the texture growing) are applied by each context the next time it uses the atlas.
+    // - Pending requests are dropped when the atlas is cleared. Preloaded sizes may still be garbage collected if left unused while the atlas needs space.
+    IMGUI_API void              AddPreloadRequest(ImFont* font, float font_size, const ImWchar* glyph_ranges, float rasterizer_density = -1.0f);
+    IMGUI_API bool              ProcessPreloadRequests(int max_glyphs = -1); // Bake up to 'max_glyphs' glyphs from pending requests (-1: no limit). Return true when no requests are pending.
+
     // As we are transitioning toward a new font system, we expect to obsolete those soon:
     IMGUI_API void              ClearInputData();           // [OBSOLETE] Clear input data (all ImFontConfig structures including sizes, TTF data, glyph ranges, etc.) = all the data used to build the texture and fonts.
     IMGUI_API void              ClearFonts();               // [OBSOLETE] Clear input+output font data (same as ClearInputData() + glyphs storage, UV coordinates).
@@ -3718,8 +3759,21 @@ struct ImFontAtlas
     int                         TexMinHeight;       // Minimum desired texture height. Must be a power of two. Default to 128.
     int                         TexMaxWidth;        // Maximum desired texture width. Must be a power of two. Default to 8192.
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
+    int                         BakedSizeBucketsPerOctave; // Default to 0 (disabled). When > 0, font sizes which are not already baked are snapped up to one of N sizes per octave (e.g. with 4: 16, 20, 23, 27, 32...) and rendered scaled down from that bake. Bounds the number of bakes created by e.g. an animated zoom.
+    int                         BakedSizeExactAfterFrames; // Default to 0 (never). When > 0 and using BakedSizeBucketsPerOctave: bake the exact size once it has been requested for that many consecutive frames.
+    int                         PreloadGlyphsPerFrame; // Maximum number of glyphs baked by NewFrame() to process pending AddPreloadRequest() calls. Default to 128. Set to 0 to only bake them when calling ProcessPreloadRequests() (e.g. from a worker thread).
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
 
+    // Sharing an atlas between contexts running on different threads (optional)
+    // - Set both functions to lock/unlock a RECURSIVE mutex of yours (e.g. std::recursive_mutex). Contexts using the atlas then hold it briefly while
+    //   accessing glyphs (text rendering/measurement, baking new glyphs) and while updating texture lists in NewFrame()/EndFrame(). It is never held
+    //   between two calls to Dear ImGui functions, and only one atlas is locked at a time.
+    // - Texture changes made by a context (e.g. after the texture grows) are applied to draw lists of contexts on other threads the next time they take the lock.
+    // - Also hold the lock when calling your renderer backend's RenderDrawData() (as it reads and updates textures), any ImFontAtlas function,
+    //   and when calling ImFontBaked functions directly (FindGlyph() etc.): returned glyph pointers are only valid while it is held.
+    void                        (*ThreadLockFunc)(ImFontAtlas* atlas);
+    void                        (*ThreadUnlockFunc)(ImFontAtlas* atlas);
+
     // Output
     // - Because textures are dynamically created/resized, the current texture identifier may changed at *ANY TIME* during the frame.
     // - This should not affect you as you can always use the latest value. But note that any precomputed UV coordinates are only valid for the current TexRef.
@@ -3823,6 +3877,7 @@ struct ImFont
 {
     // [Internal] Members: Hot ~12-20 bytes
     ImFontBaked*                LastBaked;          // 4-8   // Cache last bound baked. NEVER USE DIRECTLY. Use GetFontBaked().
+    float                       LastBakedRequestedSize; // 4 // Size requested when LastBaked was returned, which may differ from LastBaked->Size (see ImFontAtlas::BakedSizeBucketsPerOctave).
     ImFontAtlas*                ContainerAtlas;     // 4-8   // What we have been loaded into.
     ImFontFlags                 Flags;              // 4     // Font flags.
     float                       CurrentRasterizerDensity;    // Current rasterizer density. This is a varying state of the font.
@@ -3836,7 +3891,9 @@ struct ImFont
     ImWchar                     FallbackChar;       // 2-4   // out // Character used if a glyph isn't found (U+FFFD, '?')
     ImU8                        Used8kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/8192/8]; // 1 bytes if ImWchar=ImWchar16, 16 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
     bool                        EllipsisAutoBake;   // 1     //     // Mark when the "..." glyph needs to be generated.
-    ImGuiStorage                RemapPairs;         // 16    //     // Remapping pairs when using AddRemapChar(), otherwise empty.
+    bool                        SourcesIndexDirty;  // 1     //     // Mark when SourcesIndex[] needs to be rebuilt.
+    ImGuiStorage                RemapPairs;         // 40    //     // Remapping pairs when using AddRemapChar(), otherwise empty.
+    ImVector<ImU32>             SourcesIndex;       // 16    //     // Codepoint -> source lookup when merging multiple sources. Sorted ranges, each entry is (first_codepoint << 5) | source_index. Empty when not available.
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     float                       Scale;              // 4     // in  // Legacy base font scale (~1.0f), multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
 #endif
@@ -3955,6 +4012,10 @@ struct ImGuiPlatformIO
     void*       Platform_ImeUserData;
     //void      (*SetPlatformImeDataFn)(ImGuiViewport* viewport, ImGuiPlatformImeData* data); // [Renamed to platform_io.PlatformSetImeDataFn in 1.91.1]
 
+    // Optional: Run binary settings file writes off the main thread (see io.IniUseBinaryFormat, SaveBinarySettingsToDisk())
+    // (default to NULL: files are written synchronously. Otherwise call 'task_fn(task_data)' exactly once, from any thread, e.g. from a job system. One write is in flight at a time and it doesn't access the context)
+    void        (*Platform_RunSettingsWriteFn)(ImGuiContext* ctx, void (*task_fn)(void* task_data), void* task_data);
+
     // Optional: Platform locale
     // [Experimental] Configure decimal point e.g. '.' or ',' useful for some languages (e.g. German), generally pulled from *localeconv()->decimal_point
     ImWchar     Platform_LocaleDecimalPoint;     // '.'
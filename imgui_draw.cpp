@@ -2256,6 +2256,8 @@ void ImDrawData::Clear()
     DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.0f, 0.0f);
     OwnerViewport = NULL;
     Textures = NULL;
+    DamageRects.resize(0);
+    DamageRectsValid = false;
 }
 
 // Important: 'out_list' is generally going to be draw_data->CmdLists, but may be another temporary list
@@ -2330,7 +2332,7 @@ void ImDrawData::DeIndexAllBuffers()
     }
 }
 
-// Helper to scale the ClipRect field of each ImDrawCmd.
+// Helper to scale the ClipRect field of each ImDrawCmd (and DamageRects[] which use the same coordinates).
 // Use if your final output buffer is at a different scale than draw_data->DisplaySize,
 // or if there is a difference between your window resolution and framebuffer resolution.
 void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
@@ -2338,6 +2340,8 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
     for (ImDrawList* draw_list : CmdLists)
         for (ImDrawCmd& cmd : draw_list->CmdBuffer)
             cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
+    for (ImVec4& rect : DamageRects)
+        rect = ImVec4(rect.x * fb_scale.x, rect.y * fb_scale.y, rect.z * fb_scale.x, rect.w * fb_scale.y);
 }
 
 //-----------------------------------------------------------------------------
@@ -2492,6 +2496,8 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlas()
 // - ImFontAtlas::Clear()
 // - ImFontAtlas::CompactCache()
+// - ImFontAtlas::AddPreloadRequest()
+// - ImFontAtlas::ProcessPreloadRequests()
 // - ImFontAtlas::ClearInputData()
 // - ImFontAtlas::ClearTexData()
 // - ImFontAtlas::ClearFonts()
@@ -2543,8 +2549,11 @@ void ImTextureData::DestroyPixels()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasAddDrawListSharedData()
 // - ImFontAtlasRemoveDrawListSharedData()
+// - ImFontAtlasAcquireTexturesInUse()
+// - ImFontAtlasReleaseTexturesInUse()
 // - ImFontAtlasUpdateDrawListsTextures()
 // - ImFontAtlasUpdateDrawListsSharedData()
+// - ImFontAtlasSyncDrawListSharedData()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasBuildSetTexture()
 // - ImFontAtlasBuildAddTexture()
@@ -2566,6 +2575,8 @@ void ImTextureData::DestroyPixels()
 //-----------------------------------------------------------------------------
 // - ImFontBaked_BuildGrowIndex()
 // - ImFontBaked_BuildLoadGlyph()
+// - ImFontAtlasBakedLoadGlyphs()
+// - ImFontAtlasBuildProcessPreloadRequests()
 // - ImFontBaked_BuildLoadGlyphAdvanceX()
 // - ImFontAtlasDebugLogTextureRequests()
 //-----------------------------------------------------------------------------
@@ -2636,6 +2647,7 @@ ImFontAtlas::ImFontAtlas()
     TexMinHeight = 128;
     TexMaxWidth = 8192;
     TexMaxHeight = 8192;
+    PreloadGlyphsPerFrame = 128;
     TexRef._TexID = ImTextureID_Invalid;
     RendererHasTextures = false; // Assumed false by default, as apps can call e.g Atlas::Build() after backend init and before ImGui can update.
     TexNextUniqueID = 1;
@@ -2664,6 +2676,12 @@ void ImFontAtlas::Clear()
 
 void ImFontAtlas::CompactCache()
 {
+    for (ImFontConfig& src : Sources)
+    {
+        const ImFontLoader* loader = src.FontLoader ? src.FontLoader : FontLoader;
+        if (loader && loader->FontSrcCompactCache && src.FontLoaderData != NULL)
+            loader->FontSrcCompactCache(this, &src);
+    }
     ImFontAtlasTextureCompact(this);
 }
 
@@ -2672,6 +2690,41 @@ void ImFontAtlas::SetFontLoader(const ImFontLoader* font_loader)
     ImFontAtlasBuildSetupFontLoader(this, font_loader);
 }
 
+void ImFontAtlas::AddPreloadRequest(ImFont* font, float font_size, const ImWchar* glyph_ranges, float rasterizer_density)
+{
+    IM_ASSERT(font != NULL && font->ContainerAtlas == this);
+    IM_ASSERT(font_size > 0.0f && glyph_ranges != NULL);
+    ImFontAtlasThreadLockScope lock(this); // A worker thread may be processing requests
+    if (Builder == NULL)
+        ImFontAtlasBuildInit(this);
+    ImFontAtlasBuilder* builder = Builder;
+
+    ImFontAtlasPreloadRequest req;
+    req.FontId = font->FontId;
+    req.Size = ImGui::GetRoundedFontSize(font_size);
+    req.RasterizerDensity = rasterizer_density;
+    req.RangesOffset = builder->PreloadRanges.Size;
+    req.RangesCursor = 0;
+    req.NextCodepoint = 0;
+    for (; glyph_ranges[0]; glyph_ranges += 2)
+    {
+        IM_ASSERT(glyph_ranges[0] <= glyph_ranges[1] && "Invalid range: is that your glyph range array persistent? it is zero-terminated?");
+        builder->PreloadRanges.push_back(glyph_ranges[0]);
+        builder->PreloadRanges.push_back(glyph_ranges[1]);
+    }
+    builder->PreloadRanges.push_back(0);
+    builder->PreloadRequests.push_back(req);
+}
+
+// May be called from a worker thread with no current context when using ThreadLockFunc (see comments in imgui.h).
+// The lock is held for the whole call, so everything baked here is seen at once by renderers and contexts.
+bool ImFontAtlas::ProcessPreloadRequests(int max_glyphs)
+{
+    ImFontAtlasThreadLockScope lock(this);
+    ImFontAtlasBuildProcessPreloadRequests(this, max_glyphs);
+    return Builder == NULL || Builder->PreloadRequests.Size == 0;
+}
+
 void ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas!");
@@ -2736,6 +2789,7 @@ static void ImFontAtlasBuildUpdateRendererHasTexturesFromContext(ImFontAtlas* at
 // - 'frame_count' may not match those of all imgui contexts using this atlas, as contexts may be updated as different frequencies. But generally you can use ImGui::GetFrameCount() on one of your context.
 void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures)
 {
+    IMGUI_PROFILER_ZONE("ImFontAtlasUpdateNewFrame");
     IM_ASSERT(atlas->Builder == NULL || atlas->Builder->FrameCount < frame_count); // Protection against being called twice.
     atlas->RendererHasTextures = renderer_has_textures;
 
@@ -2760,7 +2814,8 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
         font->LastBaked = NULL;
 
     // Garbage collect BakedPool
-    if (builder->BakedDiscardedCount > 0)
+    // (not when shared with other threads, as it moves ImFontBaked instances which may be in use by their current frame: ImFontAtlasBakedAdd() reuses slots instead)
+    if (builder->BakedDiscardedCount > 0 && atlas->ThreadLockFunc == NULL)
     {
         int dst_n = 0, src_n = 0;
         for (; src_n < builder->BakedPool.Size; src_n++)
@@ -2796,7 +2851,8 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
         // Request destroy
         // - Keep bool to true in order to differentiate a planned destroy vs a destroy decided by the backend.
         // - We don't destroy pixels right away, as backend may have an in-flight copy from RAM.
-        if (tex->WantDestroyNextFrame && tex->Status != ImTextureStatus_Destroyed && tex->Status != ImTextureStatus_WantDestroy)
+        // - Wait until no context references it anymore (e.g. another context sharing the atlas has not rendered yet, see ImFontAtlasAcquireTexturesInUse()).
+        if (tex->WantDestroyNextFrame && tex->UseCount == 0 && tex->Status != ImTextureStatus_Destroyed && tex->Status != ImTextureStatus_WantDestroy)
         {
             IM_ASSERT(tex->Status == ImTextureStatus_OK || tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates);
             tex->Status = ImTextureStatus_WantDestroy;
@@ -2813,7 +2869,7 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
         {
             IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == NULL && "Backend set texture Status to Destroyed but did not clear TexID/BackendUserData!");
             if (tex->WantDestroyNextFrame)
-                remove_from_list = true; // Destroy was scheduled by us
+                remove_from_list = (tex->UseCount == 0); // Destroy was scheduled by us
             else
                 tex->Status = ImTextureStatus_WantCreate; // Destroy was done was backend: recreate it (e.g. freed resources mid-run)
         }
@@ -2833,6 +2889,10 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
             tex_n--;
         }
     }
+
+    // Bake glyphs for pending preload requests, within a per-frame budget
+    if (atlas->RendererHasTextures && atlas->PreloadGlyphsPerFrame > 0 && builder->PreloadRequests.Size > 0)
+        ImFontAtlasBuildProcessPreloadRequests(atlas, atlas->PreloadGlyphsPerFrame);
 }
 
 void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h)
@@ -3087,9 +3147,12 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg_in)
     return font;
 }
 
-// Default font TTF is compressed with stb_compress then base85 encoded (see misc/fonts/binary_to_compressed_c.cpp for encoder)
+// Compressed TTF data is either compressed with stb_compress or in LZ4 block format (see misc/fonts/binary_to_compressed_c.cpp for encoder)
 static unsigned int stb_decompress_length(const unsigned char* input);
 static unsigned int stb_decompress(unsigned char* output, const unsigned char* input, unsigned int length);
+static bool         ImLz4IsCompressedData(const unsigned char* input, int input_size);
+static unsigned int ImLz4DecompressLength(const unsigned char* input);
+static unsigned int ImLz4Decompress(unsigned char* output, const unsigned char* input, unsigned int input_size);
 static unsigned int Decode85Byte(char c)                                    { return c >= '\\' ? c-36 : c-35; }
 static void         Decode85(const unsigned char* src, unsigned char* dst)
 {
@@ -3175,9 +3238,21 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* font_data, int font_data_size, f
 
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
-    const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
+    // Detect format: LZ4 ('binary_to_compressed_c -lz4') or stb_compress (default)
+    const unsigned char* src = (const unsigned char*)compressed_ttf_data;
+    const bool is_lz4 = ImLz4IsCompressedData(src, compressed_ttf_size);
+    const unsigned int buf_decompressed_size = is_lz4 ? ImLz4DecompressLength(src) : stb_decompress_length(src);
     unsigned char* buf_decompressed_data = (unsigned char*)IM_ALLOC(buf_decompressed_size);
-    stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
+    if (is_lz4)
+    {
+        const unsigned int decompressed_size = ImLz4Decompress(buf_decompressed_data, src, (unsigned int)compressed_ttf_size);
+        IM_ASSERT(decompressed_size == buf_decompressed_size && "Invalid LZ4 compressed font data!");
+        IM_UNUSED(decompressed_size);
+    }
+    else
+    {
+        stb_decompress(buf_decompressed_data, src, (unsigned int)compressed_ttf_size);
+    }
 
     ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
     IM_ASSERT(font_cfg.FontData == NULL);
@@ -3370,6 +3445,7 @@ bool ImFontAtlasGetMouseCursorTexData(ImFontAtlas* atlas, ImGuiMouseCursor curso
 // When atlas->RendererHasTextures = true, this is only called if no font were loaded.
 void ImFontAtlasBuildMain(ImFontAtlas* atlas)
 {
+    IMGUI_PROFILER_ZONE("ImFontAtlasBuildMain");
     IM_ASSERT(!atlas->Locked && "Cannot modify a locked ImFontAtlas!");
     if (atlas->TexData && atlas->TexData->Format != atlas->TexDesiredFormat)
         ImFontAtlasBuildClear(atlas);
@@ -3434,13 +3510,15 @@ void ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas)
             baked->FindGlyph(font->FallbackChar);
         if (font->EllipsisChar != 0)
             baked->FindGlyph(font->EllipsisChar);
+        ImVector<ImWchar> codepoints;
         for (ImFontConfig* src : font->Sources)
         {
             const ImWchar* ranges = src->GlyphRanges ? src->GlyphRanges : atlas->GetGlyphRangesDefault();
             for (; ranges[0]; ranges += 2)
                 for (unsigned int c = ranges[0]; c <= ranges[1] && c <= IM_UNICODE_CODEPOINT_MAX; c++) //-V560
-                    baked->FindGlyph((ImWchar)c);
+                    codepoints.push_back((ImWchar)c);
         }
+        ImFontAtlasBakedLoadGlyphs(atlas, baked, codepoints.Data, codepoints.Size);
     }
 }
 
@@ -3624,9 +3702,133 @@ void ImFontAtlasFontSourceAddToFont(ImFontAtlas* atlas, ImFont* font, ImFontConf
         IM_ASSERT(font->Sources[0] == src);
     }
     atlas->TexIsBuilt = false; // For legacy backends
+    font->SourcesIndexDirty = true;
     ImFontAtlasBuildSetupFontSpecialGlyphs(atlas, font, src);
 }
 
+// Append [first, last] pairs of 'ranges' minus pairs of 'exclude_ranges' (zero-terminated) into 'out_ranges'.
+static void ImFontAtlasBuildSubtractRanges(const ImWchar* ranges, int ranges_count, const ImWchar* exclude_ranges, ImVector<ImU32>* out_ranges)
+{
+    for (int n = 0; n < ranges_count; n += 2)
+    {
+        ImU32 first = ranges[n], last = ranges[n + 1];
+        if (exclude_ranges != NULL)
+            for (const ImWchar* ex = exclude_ranges; ex[0] != 0 && first <= last; ex += 2)
+            {
+                if (ex[1] < first || ex[0] > last)
+                    continue;
+                if (ex[0] > first)
+                {
+                    out_ranges->push_back(first);
+                    out_ranges->push_back(ex[0] - 1);
+                }
+                first = (ImU32)ex[1] + 1;
+            }
+        if (first <= last)
+        {
+            out_ranges->push_back(first);
+            out_ranges->push_back(last);
+        }
+    }
+}
+
+// Build codepoint -> source lookup for fonts merged from multiple sources, so glyph loading doesn't need to query every source.
+// - Requires all loaders to implement FontSrcGetCodepointRanges(), otherwise SourcesIndex[] stays empty and we query each source.
+// - Honor ImFontConfig::GlyphExcludeRanges[]: each codepoint maps to the first source which provides it and doesn't exclude it.
+// - This is built lazily on first glyph load after sources have been added or re-initialized.
+void ImFontAtlasFontBuildSourcesIndex(ImFontAtlas* atlas, ImFont* font)
+{
+    font->SourcesIndex.resize(0);
+    font->SourcesIndexDirty = false;
+    const int sources_count = font->Sources.Size;
+    if (sources_count <= 1 || sources_count > 16) // Single source doesn't benefit from an index. ImFontGlyph::SourceIdx is 4-bits.
+        return;
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        if (loader->FontSrcGetCodepointRanges == NULL)
+            return;
+    }
+
+    // Gather ranges for each source, minus excluded ranges
+    ImVector<ImWchar> src_ranges;
+    ImVector<ImU32> ranges;
+    ImVector<ImU32> boundaries;
+    int ranges_offsets[16 + 1];
+    for (int src_n = 0; src_n < sources_count; src_n++)
+    {
+        ImFontConfig* src = font->Sources[src_n];
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        src_ranges.resize(0);
+        loader->FontSrcGetCodepointRanges(atlas, src, &src_ranges);
+        IM_ASSERT((src_ranges.Size & 1) == 0);
+        ranges_offsets[src_n] = ranges.Size;
+        ImFontAtlasBuildSubtractRanges(src_ranges.Data, src_ranges.Size, src->GlyphExcludeRanges, &ranges);
+    }
+    ranges_offsets[sources_count] = ranges.Size;
+    boundaries.reserve(ranges.Size + 1);
+    boundaries.push_back(0);
+    for (int n = 0; n < ranges.Size; n += 2)
+    {
+        boundaries.push_back(ranges[n]);
+        boundaries.push_back(ranges[n + 1] + 1);
+    }
+    struct Func { static int IMGUI_CDECL BoundaryComparer(const void* lhs, const void* rhs) { ImU32 a = *(const ImU32*)lhs, b = *(const ImU32*)rhs; return (a > b) - (a < b); } };
+    ImQsort(boundaries.Data, (size_t)boundaries.Size, sizeof(ImU32), Func::BoundaryComparer);
+
+    // Sweep through boundaries, each elementary interval maps to the first source covering it
+    int cursors[16];
+    for (int src_n = 0; src_n < sources_count; src_n++)
+        cursors[src_n] = ranges_offsets[src_n];
+    const ImU32 no_source = 0x1F;
+    for (int n = 0; n < boundaries.Size; n++)
+    {
+        const ImU32 c = boundaries[n];
+        if ((n > 0 && c == boundaries[n - 1]) || c > IM_UNICODE_CODEPOINT_MAX)
+            continue;
+        ImU32 found_src = no_source;
+        for (int src_n = 0; src_n < sources_count; src_n++)
+        {
+            int& cursor = cursors[src_n];
+            while (cursor < ranges_offsets[src_n + 1] && ranges[cursor + 1] < c)
+                cursor += 2;
+            if (cursor < ranges_offsets[src_n + 1] && ranges[cursor] <= c)
+            {
+                found_src = (ImU32)src_n;
+                break;
+            }
+        }
+        if (font->SourcesIndex.Size > 0 && (font->SourcesIndex.back() & 0x1F) == found_src)
+            continue;
+        font->SourcesIndex.push_back((c << 5) | found_src);
+    }
+}
+
+int ImFontAtlasFontFindSourceForCodepoint(ImFont* font, ImWchar codepoint)
+{
+    IM_ASSERT(font->SourcesIndex.Size > 0 && font->SourcesIndexDirty == false);
+
+    // Binary search for last entry with first_codepoint <= codepoint. First entry always has first_codepoint == 0.
+    const ImU32 key = ((ImU32)codepoint << 5) | 0x1F;
+    const ImU32* first = font->SourcesIndex.Data;
+    int count = font->SourcesIndex.Size;
+    while (count > 0)
+    {
+        int step = count >> 1;
+        if (first[step] <= key)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    const ImU32 src_n = first[-1] & 0x1F;
+    return (src_n == 0x1F) ? -1 : (int)src_n;
+}
+
 void ImFontAtlasFontDestroySourceData(ImFontAtlas* atlas, ImFontConfig* src)
 {
     IM_UNUSED(atlas);
@@ -3776,7 +3978,18 @@ void ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBa
 ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
 {
     IMGUI_DEBUG_LOG_FONT("[font] Created baked %.2fpx\n", font_size);
-    ImFontBaked* baked = atlas->Builder->BakedPool.push_back(ImFontBaked());
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontBaked* baked = NULL;
+    if (builder->BakedDiscardedCount > 0 && atlas->ThreadLockFunc != NULL)
+        for (int baked_n = 0; baked_n < builder->BakedPool.Size && baked == NULL; baked_n++)
+            if (builder->BakedPool[baked_n].WantDestroy)
+            {
+                baked = &builder->BakedPool[baked_n];
+                *baked = ImFontBaked();
+                builder->BakedDiscardedCount--;
+            }
+    if (baked == NULL)
+        baked = builder->BakedPool.push_back(ImFontBaked());
     baked->Size = font_size;
     baked->RasterizerDensity = font_rasterizer_density;
     baked->BakedId = baked_id;
@@ -3862,6 +4075,25 @@ void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* bake
     font->LastBaked = NULL;
 }
 
+// A baked font bound by another context may not have been used for 'unused_frames' atlas frames,
+// as contexts sharing an atlas don't necessarily update at the same rate (see ImFontAtlasSetBoundBaked()).
+static bool ImFontAtlasBakedIsUnused(ImFontAtlas* atlas, ImFontBaked* baked, int unused_frames)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (baked->LastUsedFrame + unused_frames > builder->FrameCount)
+        return false;
+    if (unused_frames > 0)
+    {
+        for (const ImFontAtlasBoundBaked& bound_baked : builder->BoundBakeds)
+            if (bound_baked.Baked == baked)
+                return false;
+        for (const ImFontAtlasPreloadRequest& req : builder->PreloadRequests) // Being preloaded in steps: keep glyphs baked by previous steps
+            if (req.FontId == baked->ContainerFont->FontId && req.Size == baked->Size)
+                return false;
+    }
+    return true;
+}
+
 // use unused_frames==0 to discard everything.
 void ImFontAtlasFontDiscardBakes(ImFontAtlas* atlas, ImFont* font, int unused_frames)
 {
@@ -3869,7 +4101,7 @@ void ImFontAtlasFontDiscardBakes(ImFontAtlas* atlas, ImFont* font, int unused_fr
         for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
         {
             ImFontBaked* baked = &builder->BakedPool[baked_n];
-            if (baked->LastUsedFrame + unused_frames > atlas->Builder->FrameCount)
+            if (!ImFontAtlasBakedIsUnused(atlas, baked, unused_frames))
                 continue;
             if (baked->ContainerFont != font || baked->WantDestroy)
                 continue;
@@ -3884,7 +4116,7 @@ void ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames)
     for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
     {
         ImFontBaked* baked = &builder->BakedPool[baked_n];
-        if (baked->LastUsedFrame + unused_frames > atlas->Builder->FrameCount)
+        if (!ImFontAtlasBakedIsUnused(atlas, baked, unused_frames))
             continue;
         if (baked->WantDestroy || (baked->ContainerFont->Flags & ImFontFlags_LockBakedSizes))
             continue;
@@ -3903,25 +4135,131 @@ void ImFontAtlasRemoveDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedDat
 {
     IM_ASSERT(atlas->DrawListSharedDatas.contains(data));
     atlas->DrawListSharedDatas.find_erase(data);
+    ImFontAtlasReleaseTexturesInUse(atlas, data);
+    ImFontAtlasSetBoundBaked(atlas, data, NULL);
+    if (ImFontAtlasBuilder* builder = atlas->Builder)
+        for (int n = builder->DeferredTexChanges.Size - 1; n >= 0; n--)
+            if (builder->DeferredTexChanges[n].SharedData == data)
+                builder->DeferredTexChanges.erase(builder->DeferredTexChanges.Data + n);
+}
+
+// Called when binding a font (ImGuiContext::FontBaked) and by EndFrame() with baked==NULL.
+// The ImFontBaked instance bound by a context can't be discarded by other contexts for being unused.
+void ImFontAtlasSetBoundBaked(ImFontAtlas* atlas, ImDrawListSharedData* shared_data, ImFontBaked* baked)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL)
+        return;
+    for (int n = 0; n < builder->BoundBakeds.Size; n++)
+        if (builder->BoundBakeds[n].SharedData == shared_data)
+        {
+            if (baked != NULL)
+                builder->BoundBakeds[n].Baked = baked;
+            else
+                builder->BoundBakeds.erase(builder->BoundBakeds.Data + n);
+            return;
+        }
+    if (baked != NULL)
+    {
+        ImFontAtlasBoundBaked bound_baked = { shared_data, baked };
+        builder->BoundBakeds.push_back(bound_baked);
+    }
+}
+
+// When an atlas is shared with contexts running on other threads, we cannot touch their draw lists and ImDrawListSharedData
+// while they may be in use: changes are queued and applied by ImFontAtlasSyncDrawListSharedData() on their own thread.
+static bool ImFontAtlasIsDrawListSharedDataOnOtherThread(ImFontAtlas* atlas, ImDrawListSharedData* shared_data)
+{
+    return atlas->ThreadLockFunc != NULL && atlas->Builder != NULL && shared_data->Context != NULL && shared_data->Context != GImGui;
+}
+
+void ImFontAtlasAddTextureInUse(ImDrawListSharedData* shared_data, ImTextureData* tex)
+{
+    if (shared_data->Context == NULL || shared_data->TexturesInUse.contains(tex))
+        return; // Without a context, nothing would release it
+    shared_data->TexturesInUse.push_back(tex);
+    tex->UseCount++;
+}
+
+// Called by NewFrame(), with ImFontAtlasReleaseTexturesInUse(): textures of the atlas may be referenced by the draw lists of
+// this context until its next NewFrame(). Textures created during the frame are added when applied to its draw lists,
+// and textures exposed to the backend are added by EndFrame().
+void ImFontAtlasAcquireTexturesInUse(ImFontAtlas* atlas, ImDrawListSharedData* shared_data)
+{
+    for (ImTextureData* tex : atlas->TexList)
+        if (!tex->WantDestroyNextFrame)
+            ImFontAtlasAddTextureInUse(shared_data, tex);
+}
+
+void ImFontAtlasReleaseTexturesInUse(ImFontAtlas* atlas, ImDrawListSharedData* shared_data)
+{
+    for (int n = shared_data->TexturesInUse.Size - 1; n >= 0; n--)
+    {
+        ImTextureData* tex = shared_data->TexturesInUse[n];
+        if (!atlas->TexList.contains(tex))
+            continue;
+        IM_ASSERT(tex->UseCount > 0);
+        tex->UseCount--;
+        shared_data->TexturesInUse.erase(shared_data->TexturesInUse.Data + n);
+    }
+}
+
+// Update texture identifier in draw lists of a single ImDrawListSharedData
+// - Caller needs to call ImFontAtlasAddTextureInUse() for the new texture.
+// - Draw lists of contexts which are outside of their NewFrame()..EndFrame() scope are left untouched: they are either
+//   waiting to be rendered (old texture is kept alive until their next NewFrame()) or will be reset on their next NewFrame().
+static void ImFontAtlasUpdateDrawListsTexturesForSharedData(ImDrawListSharedData* shared_data, ImTextureRef old_tex, ImTextureRef new_tex)
+{
+    if (shared_data->Context != NULL && !shared_data->Context->WithinFrameScope)
+        return;
+    for (ImDrawList* draw_list : shared_data->DrawLists)
+    {
+        // Replace in command-buffer
+        // (there is not need to replace in ImDrawListSplitter: current channel is in ImDrawList's CmdBuffer[],
+        //  other channels will be on SetCurrentChannel() which already needs to compare CmdHeader anyhow)
+        if (draw_list->CmdBuffer.Size > 0 && draw_list->_CmdHeader.TexRef == old_tex)
+            draw_list->_SetTexture(new_tex);
+
+        // Replace in stack
+        for (ImTextureRef& stacked_tex : draw_list->_TextureStack)
+            if (stacked_tex == old_tex)
+                stacked_tex = new_tex;
+    }
+}
+
+// Update texture coordinates in a single draw list shared context
+void ImFontAtlasUpdateDrawListSharedDataUvs(ImFontAtlas* atlas, ImDrawListSharedData* shared_data)
+{
+    if (shared_data->FontAtlas != atlas)
+        return;
+    shared_data->TexUvWhitePixel = atlas->TexUvWhitePixel;
+    if (atlas->ThreadLockFunc != NULL && shared_data->Context != NULL)
+    {
+        // Atlas may rewrite its TexUvLines[] while this context is using it on another thread
+        memcpy(shared_data->TexUvLinesCopy, atlas->TexUvLines, sizeof(shared_data->TexUvLinesCopy));
+        shared_data->TexUvLines = shared_data->TexUvLinesCopy;
+    }
+    else
+    {
+        shared_data->TexUvLines = atlas->TexUvLines;
+    }
 }
 
 // Update texture identifier in all active draw lists
 void ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atlas, ImTextureRef old_tex, ImTextureRef new_tex)
 {
     for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
-        for (ImDrawList* draw_list : shared_data->DrawLists)
+    {
+        if (ImFontAtlasIsDrawListSharedDataOnOtherThread(atlas, shared_data))
         {
-            // Replace in command-buffer
-            // (there is not need to replace in ImDrawListSplitter: current channel is in ImDrawList's CmdBuffer[],
-            //  other channels will be on SetCurrentChannel() which already needs to compare CmdHeader anyhow)
-            if (draw_list->CmdBuffer.Size > 0 && draw_list->_CmdHeader.TexRef == old_tex)
-                draw_list->_SetTexture(new_tex);
-
-            // Replace in stack
-            for (ImTextureRef& stacked_tex : draw_list->_TextureStack)
-                if (stacked_tex == old_tex)
-                    stacked_tex = new_tex;
+            ImFontAtlasDeferredTexChange change = { shared_data, old_tex, new_tex };
+            atlas->Builder->DeferredTexChanges.push_back(change);
+            continue;
         }
+        ImFontAtlasUpdateDrawListsTexturesForSharedData(shared_data, old_tex, new_tex);
+        if (new_tex._TexData != NULL && (shared_data->Context == NULL || shared_data->Context->WithinFrameScope))
+            ImFontAtlasAddTextureInUse(shared_data, new_tex._TexData);
+    }
 }
 
 // Update texture coordinates in all draw list shared context
@@ -3929,11 +4267,41 @@ void ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atlas, ImTextureRef old_tex
 void ImFontAtlasUpdateDrawListsSharedData(ImFontAtlas* atlas)
 {
     for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
-        if (shared_data->FontAtlas == atlas)
+    {
+        if (ImFontAtlasIsDrawListSharedDataOnOtherThread(atlas, shared_data))
         {
-            shared_data->TexUvWhitePixel = atlas->TexUvWhitePixel;
-            shared_data->TexUvLines = atlas->TexUvLines;
+            ImFontAtlasDeferredTexChange change = { shared_data, atlas->TexRef, atlas->TexRef };
+            atlas->Builder->DeferredTexChanges.push_back(change);
+            continue;
         }
+        ImFontAtlasUpdateDrawListSharedDataUvs(atlas, shared_data);
+    }
+}
+
+// Apply texture changes queued by ImFontAtlasUpdateDrawListsTextures()/ImFontAtlasUpdateDrawListsSharedData() while
+// this context was running on another thread. Called with the lock held (see ImFontAtlasThreadLockScope), on the context's thread.
+void ImFontAtlasSyncDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* shared_data)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL || builder->DeferredTexChanges.Size == 0)
+        return;
+    bool synced = false;
+    for (int n = 0; n < builder->DeferredTexChanges.Size; n++)
+    {
+        ImFontAtlasDeferredTexChange* change = &builder->DeferredTexChanges[n];
+        if (change->SharedData != shared_data)
+            continue;
+        if (change->OldTex != change->NewTex)
+            ImFontAtlasUpdateDrawListsTexturesForSharedData(shared_data, change->OldTex, change->NewTex); // Only compare pointers: intermediate textures may have been destroyed already
+        builder->DeferredTexChanges.erase(change);
+        n--;
+        synced = true;
+    }
+    if (!synced)
+        return;
+    ImFontAtlasUpdateDrawListSharedDataUvs(atlas, shared_data);
+    if (shared_data->Context->WithinFrameScope)
+        ImFontAtlasAddTextureInUse(shared_data, atlas->TexData);
 }
 
 // Set current texture. This is mostly called from AddTexture() + to handle a failed resize.
@@ -3999,6 +4367,7 @@ static void ImFontAtlasDebugWriteTexToDisk(ImTextureData* tex, const char* descr
 
 void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
 {
+    IMGUI_PROFILER_ZONE("ImFontAtlasTextureRepack");
     ImFontAtlasBuilder* builder = atlas->Builder;
     builder->LockDisableResize = true;
 
@@ -4071,6 +4440,7 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
 
 void ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_tex_w, int old_tex_h)
 {
+    IMGUI_PROFILER_ZONE("ImFontAtlasTextureGrow");
     //ImFontAtlasDebugWriteTexToDisk(atlas->TexData, "Before Grow");
     ImFontAtlasBuilder* builder = atlas->Builder;
     if (old_tex_w == -1)
@@ -4421,8 +4791,10 @@ static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font,
 
 static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x)
 {
+    IMGUI_PROFILER_ZONE("ImFontBaked_BuildLoadGlyph");
     ImFont* font = baked->ContainerFont;
     ImFontAtlas* atlas = font->ContainerAtlas;
+    ImFontAtlasThreadLockScope lock(atlas);
     if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
     {
         // Lazily load fallback glyph
@@ -4444,13 +4816,20 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
         if (ImFontGlyph* glyph = ImFontAtlasBuildSetupFontBakedEllipsis(atlas, baked))
             return glyph;
 
+    // Skip sources which don't provide the codepoint, when we know that
+    if (font->SourcesIndexDirty)
+        ImFontAtlasFontBuildSourcesIndex(atlas, font);
+    const int first_src_n = font->SourcesIndex.Size ? ImFontAtlasFontFindSourceForCodepoint(font, codepoint) : 0;
+
     // Call backend
     char* loader_user_data_p = (char*)baked->FontLoaderDatas;
     int src_n = 0;
     for (ImFontConfig* src : font->Sources)
     {
         const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
-        if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
+        if (first_src_n == -1)
+            break;
+        if (src_n >= first_src_n && (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint)))
         {
             if (only_load_advance_x == NULL)
             {
@@ -4490,6 +4869,196 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
     return NULL;
 }
 
+static inline bool ImFontBaked_IsGlyphResolved(ImFontBaked* baked, ImWchar c)
+{
+    return c < (size_t)baked->IndexLookup.Size && baked->IndexLookup.Data[c] != IM_FONTGLYPH_INDEX_UNUSED;
+}
+
+static int IMGUI_CDECL ImWcharCompare(const void* lhs, const void* rhs)
+{
+    return (int)*(const ImWchar*)lhs - (int)*(const ImWchar*)rhs;
+}
+
+// Load multiple glyphs at once. Same result as calling FindGlyph() on each codepoint, but loaders implementing
+// FontBakedLoadGlyphs() get to process each source in a single call, amortizing their per-call setup.
+// - Codepoints already loaded (or known to be missing) are skipped, duplicates are allowed.
+// - Codepoints affected by user remapping or special hooks go through the regular path.
+void ImFontAtlasBakedLoadGlyphs(ImFontAtlas* atlas, ImFontBaked* baked, const ImWchar* codepoints, int codepoints_count)
+{
+    IMGUI_PROFILER_ZONE("ImFontAtlasBakedLoadGlyphs");
+    ImFontAtlasThreadLockScope lock(atlas);
+    ImFont* font = baked->ContainerFont;
+    if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
+        return;
+    if (atlas->Builder == NULL)
+        ImFontAtlasBuildInit(atlas);
+    ImFontAtlasBuilder* builder = atlas->Builder;
+
+    // Gather codepoints which are not resolved yet
+    ImVector<ImWchar>& pending = builder->TempCodepoints;
+    pending.resize(0);
+    for (int n = 0; n < codepoints_count; n++)
+    {
+        ImWchar c = codepoints[n];
+        if (ImFontBaked_IsGlyphResolved(baked, c))
+            continue;
+        ImWchar c_remapped = c;
+        ImFontAtlas_FontHookRemapCodepoint(atlas, font, &c_remapped);
+        if (c_remapped != c || (c == font->EllipsisChar && font->EllipsisAutoBake))
+            ImFontBaked_BuildLoadGlyph(baked, c, NULL);
+        else
+            pending.push_back(c);
+    }
+    if (pending.Size == 0)
+        return;
+    if (pending.Size > 1)
+    {
+        ImQsort(pending.Data, (size_t)pending.Size, sizeof(ImWchar), ImWcharCompare);
+        int write_n = 1;
+        for (int read_n = 1; read_n < pending.Size; read_n++)
+            if (pending.Data[read_n] != pending.Data[write_n - 1])
+                pending.Data[write_n++] = pending.Data[read_n];
+        pending.Size = write_n;
+    }
+
+    // Call backend, one source at a time. Glyphs not provided by a source are forwarded to the next one.
+    if (font->SourcesIndexDirty)
+        ImFontAtlasFontBuildSourcesIndex(atlas, font);
+    const bool use_sources_index = font->SourcesIndex.Size > 0;
+    ImVector<ImWchar>& src_codepoints = builder->TempCodepointsForSrc;
+    ImVector<ImFontGlyph>& glyphs = builder->TempGlyphs;
+    char* loader_user_data_p = (char*)baked->FontLoaderDatas;
+    int src_n = 0;
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        src_codepoints.resize(0);
+        for (ImWchar c : pending)
+        {
+            if (use_sources_index)
+            {
+                const int first_src_n = ImFontAtlasFontFindSourceForCodepoint(font, c);
+                if (first_src_n == -1 || first_src_n > src_n)
+                    continue;
+            }
+            if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, c))
+                src_codepoints.push_back(c);
+        }
+
+        if (src_codepoints.Size > 0)
+        {
+            glyphs.resize(0);
+            if (loader->FontBakedLoadGlyphs != NULL)
+            {
+                loader->FontBakedLoadGlyphs(atlas, src, baked, loader_user_data_p, src_codepoints.Data, src_codepoints.Size, &glyphs);
+            }
+            else
+            {
+                for (ImWchar c : src_codepoints)
+                {
+                    ImFontGlyph glyph_buf;
+                    if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, c, &glyph_buf, NULL))
+                        glyphs.push_back(glyph_buf);
+                }
+            }
+            for (ImFontGlyph& glyph : glyphs)
+            {
+                glyph.SourceIdx = src_n;
+                ImFontAtlasBakedAddFontGlyph(atlas, baked, src, &glyph);
+            }
+
+            // Remove what we just loaded from the pending list
+            if (glyphs.Size > 0)
+            {
+                int write_n = 0;
+                for (ImWchar c : pending)
+                    if (!ImFontBaked_IsGlyphResolved(baked, c))
+                        pending.Data[write_n++] = c;
+                pending.Size = write_n;
+                if (pending.Size == 0)
+                    return;
+            }
+        }
+        loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
+        src_n++;
+    }
+
+    // Lazily load fallback glyph then mark remaining codepoints as not found, so we don't attempt the search twice
+    if (baked->LoadNoFallback)
+        return;
+    if (baked->FallbackGlyphIndex == -1)
+        ImFontAtlasBuildSetupFontBakedFallback(baked);
+    for (ImWchar c : pending)
+    {
+        if (ImFontBaked_IsGlyphResolved(baked, c)) // e.g. fallback glyph itself
+            continue;
+        ImFontBaked_BuildGrowIndex(baked, c + 1);
+        baked->IndexAdvanceX[c] = baked->FallbackAdvanceX;
+        baked->IndexLookup[c] = IM_FONTGLYPH_INDEX_NOT_FOUND;
+    }
+}
+
+// Process pending ImFontAtlas::AddPreloadRequest() requests. Return number of glyphs submitted for loading.
+// Already loaded glyphs are skipped and not counted against 'max_glyphs' (-1: no limit).
+int ImFontAtlasBuildProcessPreloadRequests(ImFontAtlas* atlas, int max_glyphs)
+{
+    ImFontAtlasThreadLockScope lock(atlas);
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL || builder->PreloadRequests.Size == 0 || atlas->Locked)
+        return 0;
+
+    int glyphs_count = 0;
+    int req_n = 0;
+    for (; req_n < builder->PreloadRequests.Size && (max_glyphs < 0 || glyphs_count < max_glyphs); req_n++)
+    {
+        ImFontAtlasPreloadRequest* req = &builder->PreloadRequests[req_n];
+        ImFont* font = NULL;
+        for (ImFont* font_n : atlas->Fonts)
+            if (font_n->FontId == req->FontId)
+                font = font_n;
+        if (font == NULL || (font->Flags & ImFontFlags_NoLoadGlyphs))
+            continue;
+        ImFontBaked* baked = ImFontAtlasBakedGetOrAdd(atlas, font, req->Size, req->RasterizerDensity > 0.0f ? req->RasterizerDensity : font->CurrentRasterizerDensity);
+        if (baked == NULL)
+            continue;
+        baked->LastUsedFrame = builder->FrameCount;
+
+        // Gather unloaded codepoints in chunks, so we can use a local buffer
+        ImWchar codepoints[256];
+        while (true)
+        {
+            int codepoints_count = 0;
+            const int codepoints_max = (max_glyphs < 0) ? IM_ARRAYSIZE(codepoints) : ImMin(IM_ARRAYSIZE(codepoints), max_glyphs - glyphs_count);
+            const ImWchar* ranges = &builder->PreloadRanges[req->RangesOffset + req->RangesCursor];
+            for (; ranges[0] != 0 && codepoints_count < codepoints_max; ranges += 2, req->RangesCursor += 2, req->NextCodepoint = 0)
+            {
+                unsigned int c = ImMax(req->NextCodepoint, (unsigned int)ranges[0]);
+                for (; c <= ranges[1] && codepoints_count < codepoints_max; c++)
+                    if (!ImFontBaked_IsGlyphResolved(baked, (ImWchar)c))
+                        codepoints[codepoints_count++] = (ImWchar)c;
+                if (c <= ranges[1])
+                {
+                    req->NextCodepoint = c;
+                    break;
+                }
+            }
+            ImFontAtlasBakedLoadGlyphs(atlas, baked, codepoints, codepoints_count);
+            glyphs_count += codepoints_count;
+            if (ranges[0] == 0 || (max_glyphs >= 0 && glyphs_count >= max_glyphs))
+                break;
+        }
+        if (builder->PreloadRanges[req->RangesOffset + req->RangesCursor] != 0)
+            break; // Out of budget
+    }
+
+    // Remove completed requests
+    if (req_n > 0)
+        builder->PreloadRequests.erase(builder->PreloadRequests.Data, builder->PreloadRequests.Data + req_n);
+    if (builder->PreloadRequests.Size == 0)
+        builder->PreloadRanges.clear();
+    return glyphs_count;
+}
+
 static float ImFontBaked_BuildLoadGlyphAdvanceX(ImFontBaked* baked, ImWchar codepoint)
 {
     if (baked->Size >= IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE || baked->LoadNoRenderOnLayout)
@@ -4507,9 +5076,38 @@ static float ImFontBaked_BuildLoadGlyphAdvanceX(ImFontBaked* baked, ImWchar code
 }
 
 // The point of this indirection is to not be inlined in debug mode in order to not bloat inner loop.b
+// On a miss, we also gather the next few unresolved codepoints of the string and load them in a single batch.
+// The lookahead is bounded in bytes, so a miss in a long and mostly loaded string doesn't scan (and bake) too far ahead.
+#define IMGUI_FONT_LOAD_GLYPHS_LOOKAHEAD        64
+#define IMGUI_FONT_LOAD_GLYPHS_LOOKAHEAD_BYTES  256
 IM_MSVC_RUNTIME_CHECKS_OFF
-static float BuildLoadGlyphGetAdvanceOrFallback(ImFontBaked* baked, unsigned int codepoint)
+static float BuildLoadGlyphGetAdvanceOrFallback(ImFontBaked* baked, unsigned int codepoint, const char* text_next, const char* text_end)
 {
+    ImFontAtlas* atlas = baked->ContainerFont->ContainerAtlas;
+    if (baked->Size < IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE && !baked->LoadNoRenderOnLayout && codepoint <= IM_UNICODE_CODEPOINT_MAX)
+    {
+        ImWchar codepoints[IMGUI_FONT_LOAD_GLYPHS_LOOKAHEAD];
+        int codepoints_count = 0;
+        codepoints[codepoints_count++] = (ImWchar)codepoint;
+        const char* scan_end = (text_end - text_next > IMGUI_FONT_LOAD_GLYPHS_LOOKAHEAD_BYTES) ? text_next + IMGUI_FONT_LOAD_GLYPHS_LOOKAHEAD_BYTES : text_end;
+        for (const char* s = text_next; s < scan_end && codepoints_count < IM_ARRAYSIZE(codepoints); )
+        {
+            unsigned int c = (unsigned int)*s;
+            if (c < 0x80)
+                s += 1;
+            else
+                s += ImTextCharFromUtf8(&c, s, text_end);
+            if (c >= 32 && c <= IM_UNICODE_CODEPOINT_MAX && !ImFontBaked_IsGlyphResolved(baked, (ImWchar)c))
+                codepoints[codepoints_count++] = (ImWchar)c;
+        }
+        if (codepoints_count > 1)
+        {
+            // Batch includes 'codepoint': don't load it a second time.
+            ImFontAtlasBakedLoadGlyphs(atlas, baked, codepoints, codepoints_count);
+            if (ImFontBaked_IsGlyphResolved(baked, (ImWchar)codepoint))
+                return baked->IndexAdvanceX.Data[codepoint];
+        }
+    }
     return ImFontBaked_BuildLoadGlyphAdvanceX(baked, (ImWchar)codepoint);
 }
 IM_MSVC_RUNTIME_CHECKS_RESTORE
@@ -4551,19 +5149,58 @@ void ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atlas)
 
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
 
+// Glyph outline cache: flattened contours in font units, so baking an already seen glyph at another size or density
+// skips parsing the glyph and flattening its curves. Contours flattened for a given scale are reused for smaller scales.
+// This uses stb_truetype internals (stbtt__rasterize() etc.) so it is only available when the implementation is in this compilation unit.
+#ifdef STB_TRUETYPE_IMPLEMENTATION
+#define IMGUI_STB_TRUETYPE_OUTLINE_CACHE
+static const int STB_TRUETYPE_OUTLINE_CACHE_MAX_SIZE = 2 * 1024 * 1024; // Per font source. When exceeded, the cache is cleared before adding a glyph.
+struct ImGui_ImplStbTrueType_GlyphOutline
+{
+    int             BoxX0, BoxY0, BoxX1, BoxY1; // Bounding box in font units, from stbtt_GetGlyphBox()
+    bool            BoxValid;                   // false for empty glyphs (e.g. space character)
+    float           FlattenScale;               // Largest scale the contours can be rasterized at (0.0f if not flattened yet)
+    stbtt__point*   Points;                     // Flattened contours, in font units
+    int*            ContourLengths;
+    int             ContourCount;
+};
+#endif
+
 // One for each ConfigData
 struct ImGui_ImplStbTrueType_FontSrcData
 {
     stbtt_fontinfo  FontInfo;
     float           ScaleFactor;
+#ifdef IMGUI_STB_TRUETYPE_OUTLINE_CACHE
+    ImVector<int>   GlyphOutlinesIndex;         // Sparse. Index into GlyphOutlines by glyph index, -1 if not cached.
+    ImVector<ImGui_ImplStbTrueType_GlyphOutline> GlyphOutlines;
+    int             GlyphOutlinesContoursSize;  // Sum of allocated Points[] and ContourLengths[] sizes, in bytes.
+#endif
 };
 
+#ifdef IMGUI_STB_TRUETYPE_OUTLINE_CACHE
+static void ImGui_ImplStbTrueType_ClearGlyphOutlines(ImGui_ImplStbTrueType_FontSrcData* bd_font_data)
+{
+    for (ImGui_ImplStbTrueType_GlyphOutline& outline : bd_font_data->GlyphOutlines)
+    {
+        STBTT_free(outline.Points, bd_font_data->FontInfo.userdata);
+        STBTT_free(outline.ContourLengths, bd_font_data->FontInfo.userdata);
+    }
+    bd_font_data->GlyphOutlines.clear();
+    bd_font_data->GlyphOutlinesIndex.clear();
+    bd_font_data->GlyphOutlinesContoursSize = 0;
+}
+#endif
+
 static bool ImGui_ImplStbTrueType_FontSrcInit(ImFontAtlas* atlas, ImFontConfig* src)
 {
     IM_UNUSED(atlas);
 
     ImGui_ImplStbTrueType_FontSrcData* bd_font_data = IM_NEW(ImGui_ImplStbTrueType_FontSrcData);
     IM_ASSERT(src->FontLoaderData == NULL);
+#ifdef IMGUI_STB_TRUETYPE_OUTLINE_CACHE
+    bd_font_data->GlyphOutlinesContoursSize = 0;
+#endif
 
     // Initialize helper structure for font loading and verify that the TTF/OTF data is correct
     const int font_offset = stbtt_GetFontOffsetForIndex((unsigned char*)src->FontData, src->FontNo);
@@ -4599,10 +5236,31 @@ static void ImGui_ImplStbTrueType_FontSrcDestroy(ImFontAtlas* atlas, ImFontConfi
 {
     IM_UNUSED(atlas);
     ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+#ifdef IMGUI_STB_TRUETYPE_OUTLINE_CACHE
+    if (bd_font_data != NULL)
+        ImGui_ImplStbTrueType_ClearGlyphOutlines(bd_font_data);
+#endif
     IM_DELETE(bd_font_data);
     src->FontLoaderData = NULL;
 }
 
+#ifdef IMGUI_STB_TRUETYPE_OUTLINE_CACHE
+static void ImGui_ImplStbTrueType_FontSrcCompactCache(ImFontAtlas* atlas, ImFontConfig* src)
+{
+    IM_UNUSED(atlas);
+    ImGui_ImplStbTrueType_ClearGlyphOutlines((ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData);
+}
+
+static size_t ImGui_ImplStbTrueType_FontSrcGetCacheSize(ImFontAtlas* atlas, ImFontConfig* src)
+{
+    IM_UNUSED(atlas);
+    ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+    if (bd_font_data == NULL)
+        return 0;
+    return (size_t)bd_font_data->GlyphOutlinesIndex.size_in_bytes() + (size_t)bd_font_data->GlyphOutlines.size_in_bytes() + (size_t)bd_font_data->GlyphOutlinesContoursSize;
+}
+#endif
+
 static bool ImGui_ImplStbTrueType_FontSrcContainsGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImWchar codepoint)
 {
     IM_UNUSED(atlas);
@@ -4614,6 +5272,59 @@ static bool ImGui_ImplStbTrueType_FontSrcContainsGlyph(ImFontAtlas* atlas, ImFon
     return glyph_index != 0;
 }
 
+// Append [first, last] pair or extend last pair. Codepoints must be submitted in increasing order.
+static void ImGui_ImplStbTrueType_AddCodepointToRanges(ImVector<ImWchar>* out_ranges, unsigned int c, int ranges_start)
+{
+    if (out_ranges->Size > ranges_start && (unsigned int)out_ranges->back() + 1 == c)
+        out_ranges->back() = (ImWchar)c;
+    else
+    {
+        out_ranges->push_back((ImWchar)c);
+        out_ranges->push_back((ImWchar)c);
+    }
+}
+
+// Use cmap subtable segments/groups to find candidate codepoints, then verify each with stbtt_FindGlyphIndex().
+static void ImGui_ImplStbTrueType_FontSrcGetCodepointRanges(ImFontAtlas* atlas, ImFontConfig* src, ImVector<ImWchar>* out_ranges)
+{
+    IM_UNUSED(atlas);
+    ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+    const stbtt_fontinfo* info = &bd_font_data->FontInfo;
+    const unsigned char* cmap = info->data + info->index_map;
+    #define IM_READ_U16(p)  (((unsigned int)(p)[0] << 8) | (p)[1])
+    #define IM_READ_U32(p)  (((unsigned int)(p)[0] << 24) | ((unsigned int)(p)[1] << 16) | ((unsigned int)(p)[2] << 8) | (p)[3])
+    const unsigned int format = IM_READ_U16(cmap);
+    const int ranges_start = out_ranges->Size;
+    if (format == 4)
+    {
+        const unsigned int seg_count = IM_READ_U16(cmap + 6) / 2;
+        const unsigned char* end_codes = cmap + 14;
+        const unsigned char* start_codes = end_codes + seg_count * 2 + 2;
+        for (unsigned int seg_n = 0; seg_n < seg_count; seg_n++)
+            for (unsigned int c = IM_READ_U16(start_codes + seg_n * 2), c_last = IM_READ_U16(end_codes + seg_n * 2); c <= c_last && c <= IM_UNICODE_CODEPOINT_MAX; c++)
+                if (stbtt_FindGlyphIndex(info, (int)c) != 0)
+                    ImGui_ImplStbTrueType_AddCodepointToRanges(out_ranges, c, ranges_start);
+    }
+    else if (format == 12 || format == 13)
+    {
+        const unsigned int groups_count = IM_READ_U32(cmap + 12);
+        const unsigned char* groups = cmap + 16;
+        for (unsigned int group_n = 0; group_n < groups_count; group_n++)
+            for (unsigned int c = IM_READ_U32(groups + group_n * 12), c_last = IM_READ_U32(groups + group_n * 12 + 4); c <= c_last && c <= IM_UNICODE_CODEPOINT_MAX; c++)
+                if (stbtt_FindGlyphIndex(info, (int)c) != 0)
+                    ImGui_ImplStbTrueType_AddCodepointToRanges(out_ranges, c, ranges_start);
+    }
+    else
+    {
+        // Other formats (0, 2, 6) only cover the BMP.
+        for (unsigned int c = 0; c <= 0xFFFF && c <= IM_UNICODE_CODEPOINT_MAX; c++)
+            if (stbtt_FindGlyphIndex(info, (int)c) != 0)
+                ImGui_ImplStbTrueType_AddCodepointToRanges(out_ranges, c, ranges_start);
+    }
+    #undef IM_READ_U16
+    #undef IM_READ_U32
+}
+
 static bool ImGui_ImplStbTrueType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*)
 {
     IM_UNUSED(atlas);
@@ -4632,7 +5343,125 @@ static bool ImGui_ImplStbTrueType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig
     return true;
 }
 
-static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+// Per-call setup, shared by all glyphs loaded by a FontBakedLoadGlyph()/FontBakedLoadGlyphs() call.
+struct ImGui_ImplStbTrueType_GlyphLoadParams
+{
+    int             OversampleH, OversampleV;
+    float           ScaleForLayout;
+    float           ScaleForRasterX, ScaleForRasterY;
+    float           FontOffX, FontOffY;     // Before adding sub-pixel offsets
+    float           AscentRounded;
+    float           RecipH, RecipV;
+};
+
+static void ImGui_ImplStbTrueType_InitGlyphLoadParams(ImFontConfig* src, ImFontBaked* baked, ImGui_ImplStbTrueType_GlyphLoadParams* p)
+{
+    ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+
+    // Fonts unit to pixels
+    ImFontAtlasBuildGetOversampleFactors(src, baked, &p->OversampleH, &p->OversampleV);
+    const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+    p->ScaleForLayout = bd_font_data->ScaleFactor * baked->Size;
+    p->ScaleForRasterX = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * p->OversampleH;
+    p->ScaleForRasterY = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * p->OversampleV;
+
+    const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
+    const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
+    p->FontOffX = (src->GlyphOffset.x * offsets_scale);
+    p->FontOffY = (src->GlyphOffset.y * offsets_scale);
+    if (src->PixelSnapH) // Snap scaled offset. This is to mitigate backward compatibility issues for GlyphOffset, but a better design would be welcome.
+        p->FontOffX = IM_ROUND(p->FontOffX);
+    if (src->PixelSnapV)
+        p->FontOffY = IM_ROUND(p->FontOffY);
+    p->AscentRounded = IM_ROUND(baked->Ascent);
+    p->RecipH = 1.0f / (p->OversampleH * rasterizer_density);
+    p->RecipV = 1.0f / (p->OversampleV * rasterizer_density);
+}
+
+#ifdef IMGUI_STB_TRUETYPE_OUTLINE_CACHE
+static ImGui_ImplStbTrueType_GlyphOutline* ImGui_ImplStbTrueType_GetGlyphOutline(ImGui_ImplStbTrueType_FontSrcData* bd_font_data, int glyph_index)
+{
+    if (glyph_index < bd_font_data->GlyphOutlinesIndex.Size && bd_font_data->GlyphOutlinesIndex.Data[glyph_index] != -1)
+        return &bd_font_data->GlyphOutlines.Data[bd_font_data->GlyphOutlinesIndex.Data[glyph_index]];
+
+    // Bound memory usage: start over when full (e.g. after baking many glyphs of a large CJK font). Glyphs in use get cached again on demand.
+    if (bd_font_data->GlyphOutlinesContoursSize + bd_font_data->GlyphOutlines.size_in_bytes() > STB_TRUETYPE_OUTLINE_CACHE_MAX_SIZE)
+        ImGui_ImplStbTrueType_ClearGlyphOutlines(bd_font_data);
+    if (glyph_index >= bd_font_data->GlyphOutlinesIndex.Size)
+        bd_font_data->GlyphOutlinesIndex.resize(glyph_index + 1, -1);
+    int* p_outline_idx = &bd_font_data->GlyphOutlinesIndex.Data[glyph_index];
+    *p_outline_idx = bd_font_data->GlyphOutlines.Size;
+    bd_font_data->GlyphOutlines.resize(bd_font_data->GlyphOutlines.Size + 1);
+    ImGui_ImplStbTrueType_GlyphOutline* outline = &bd_font_data->GlyphOutlines.back();
+    memset(outline, 0, sizeof(*outline));
+    outline->BoxValid = stbtt_GetGlyphBox(&bd_font_data->FontInfo, glyph_index, &outline->BoxX0, &outline->BoxY0, &outline->BoxX1, &outline->BoxY1) != 0;
+    return outline;
+}
+
+// Same as stbtt_GetGlyphBitmapBoxSubpixel(), with 0.0f shift
+static void ImGui_ImplStbTrueType_GetGlyphOutlineBitmapBox(const ImGui_ImplStbTrueType_GlyphOutline* outline, float scale_x, float scale_y, int* x0, int* y0, int* x1, int* y1)
+{
+    if (!outline->BoxValid)
+    {
+        *x0 = *y0 = *x1 = *y1 = 0;
+        return;
+    }
+    *x0 = STBTT_ifloor(outline->BoxX0 * scale_x);
+    *y0 = STBTT_ifloor(-outline->BoxY1 * scale_y);
+    *x1 = STBTT_iceil(outline->BoxX1 * scale_x);
+    *y1 = STBTT_iceil(-outline->BoxY0 * scale_y);
+}
+
+static int ImGui_ImplStbTrueType_GetGlyphOutlineContoursSize(const ImGui_ImplStbTrueType_GlyphOutline* outline)
+{
+    if (outline->Points == NULL)
+        return 0;
+    int points_count = 0;
+    for (int n = 0; n < outline->ContourCount; n++)
+        points_count += outline->ContourLengths[n];
+    return points_count * (int)sizeof(stbtt__point) + outline->ContourCount * (int)sizeof(int);
+}
+
+// Same as stbtt_MakeGlyphBitmapSubpixelPrefilter(), with 0.0f shift, using cached contours.
+static void ImGui_ImplStbTrueType_RasterizeGlyphOutline(ImGui_ImplStbTrueType_FontSrcData* bd_font_data, ImGui_ImplStbTrueType_GlyphOutline* outline, int glyph_index, unsigned char* pixels, int w, int h, int x0, int y0, float scale_x, float scale_y, int oversample_h, int oversample_v, float* out_sub_x, float* out_sub_y)
+{
+    // Flatten contours if not already done for this scale or a larger one.
+    // When flattening again for a larger scale we leave some headroom to avoid doing it again for every step of a progressive zoom.
+    void* userdata = bd_font_data->FontInfo.userdata;
+    const float scale = ImMin(scale_x, scale_y);
+    if (outline->FlattenScale < scale)
+    {
+        const float flatten_scale = (outline->FlattenScale == 0.0f) ? scale : scale * 2.0f;
+        bd_font_data->GlyphOutlinesContoursSize -= ImGui_ImplStbTrueType_GetGlyphOutlineContoursSize(outline);
+        STBTT_free(outline->Points, userdata);
+        STBTT_free(outline->ContourLengths, userdata);
+        outline->ContourLengths = NULL;
+        outline->ContourCount = 0;
+        stbtt_vertex* vertices = NULL;
+        const int vertices_count = stbtt_GetGlyphShape(&bd_font_data->FontInfo, glyph_index, &vertices);
+        outline->Points = stbtt_FlattenCurves(vertices, vertices_count, 0.35f / flatten_scale, &outline->ContourLengths, &outline->ContourCount, userdata);
+        outline->FlattenScale = flatten_scale;
+        bd_font_data->GlyphOutlinesContoursSize += ImGui_ImplStbTrueType_GetGlyphOutlineContoursSize(outline);
+        stbtt_FreeShape(&bd_font_data->FontInfo, vertices);
+    }
+
+    stbtt__bitmap gbm;
+    gbm.pixels = pixels;
+    gbm.w = w - (oversample_h - 1);
+    gbm.h = h - (oversample_v - 1);
+    gbm.stride = w;
+    if (gbm.w > 0 && gbm.h > 0 && outline->Points != NULL)
+        stbtt__rasterize(&gbm, outline->Points, outline->ContourLengths, outline->ContourCount, scale_x, scale_y, 0.0f, 0.0f, x0, y0, 1, userdata);
+    if (oversample_h > 1)
+        stbtt__h_prefilter(pixels, w, h, w, oversample_h);
+    if (oversample_v > 1)
+        stbtt__v_prefilter(pixels, w, h, w, oversample_v);
+    *out_sub_x = stbtt__oversample_shift(oversample_h);
+    *out_sub_y = stbtt__oversample_shift(oversample_v);
+}
+#endif
+
+static bool ImGui_ImplStbTrueType_LoadGlyphEx(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, const ImGui_ImplStbTrueType_GlyphLoadParams* p, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
 {
     // Search for first font which has the glyph
     ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
@@ -4641,37 +5470,36 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     if (glyph_index == 0)
         return false;
 
-    // Fonts unit to pixels
-    int oversample_h, oversample_v;
-    ImFontAtlasBuildGetOversampleFactors(src, baked, &oversample_h, &oversample_v);
-    const float scale_for_layout = bd_font_data->ScaleFactor * baked->Size;
-    const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
-    const float scale_for_raster_x = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * oversample_h;
-    const float scale_for_raster_y = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * oversample_v;
-
     // Obtain size and advance
     int x0, y0, x1, y1;
     int advance, lsb;
-    stbtt_GetGlyphBitmapBoxSubpixel(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, 0, 0, &x0, &y0, &x1, &y1);
+#ifdef IMGUI_STB_TRUETYPE_OUTLINE_CACHE
+    ImGui_ImplStbTrueType_GlyphOutline* outline = ImGui_ImplStbTrueType_GetGlyphOutline(bd_font_data, glyph_index);
+    ImGui_ImplStbTrueType_GetGlyphOutlineBitmapBox(outline, p->ScaleForRasterX, p->ScaleForRasterY, &x0, &y0, &x1, &y1);
+#else
+    stbtt_GetGlyphBitmapBoxSubpixel(&bd_font_data->FontInfo, glyph_index, p->ScaleForRasterX, p->ScaleForRasterY, 0, 0, &x0, &y0, &x1, &y1);
+#endif
     stbtt_GetGlyphHMetrics(&bd_font_data->FontInfo, glyph_index, &advance, &lsb);
 
     // Load metrics only mode
     if (out_advance_x != NULL)
     {
         IM_ASSERT(out_glyph == NULL);
-        *out_advance_x = advance * scale_for_layout;
+        *out_advance_x = advance * p->ScaleForLayout;
         return true;
     }
 
     // Prepare glyph
     out_glyph->Codepoint = codepoint;
-    out_glyph->AdvanceX = advance * scale_for_layout;
+    out_glyph->AdvanceX = advance * p->ScaleForLayout;
 
     // Pack and retrieve position inside texture atlas
     // (generally based on stbtt_PackFontRangesRenderIntoRects)
     const bool is_visible = (x0 != x1 && y0 != y1);
     if (is_visible)
     {
+        const int oversample_h = p->OversampleH;
+        const int oversample_v = p->OversampleV;
         const int w = (x1 - x0 + oversample_h - 1);
         const int h = (y1 - y0 + oversample_v - 1);
         ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
@@ -4684,7 +5512,6 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
 
         // Render
-        stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
         ImFontAtlasBuilder* builder = atlas->Builder;
         builder->TempBuffer.resize(w * h * 1);
         unsigned char* bitmap_pixels = builder->TempBuffer.Data;
@@ -4693,29 +5520,25 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         // Render with oversampling
         // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
         float sub_x, sub_y;
+#ifdef IMGUI_STB_TRUETYPE_OUTLINE_CACHE
+        ImGui_ImplStbTrueType_RasterizeGlyphOutline(bd_font_data, outline, glyph_index, bitmap_pixels, w, h, x0, y0,
+            p->ScaleForRasterX, p->ScaleForRasterY, oversample_h, oversample_v, &sub_x, &sub_y);
+#else
+        stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, p->ScaleForRasterX, p->ScaleForRasterY, &x0, &y0, &x1, &y1);
         stbtt_MakeGlyphBitmapSubpixelPrefilter(&bd_font_data->FontInfo, bitmap_pixels, w, h, w,
-            scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
+            p->ScaleForRasterX, p->ScaleForRasterY, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
+#endif
 
-        const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
-        const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
-        float font_off_x = (src->GlyphOffset.x * offsets_scale);
-        float font_off_y = (src->GlyphOffset.y * offsets_scale);
-        if (src->PixelSnapH) // Snap scaled offset. This is to mitigate backward compatibility issues for GlyphOffset, but a better design would be welcome.
-            font_off_x = IM_ROUND(font_off_x);
-        if (src->PixelSnapV)
-            font_off_y = IM_ROUND(font_off_y);
-        font_off_x += sub_x;
-        font_off_y += sub_y + IM_ROUND(baked->Ascent);
-        float recip_h = 1.0f / (oversample_h * rasterizer_density);
-        float recip_v = 1.0f / (oversample_v * rasterizer_density);
+        const float font_off_x = p->FontOffX + sub_x;
+        const float font_off_y = p->FontOffY + (sub_y + p->AscentRounded);
 
         // Register glyph
         // r->x r->y are coordinates inside texture (in pixels)
         // glyph.X0, glyph.Y0 are drawing coordinates from base text position, and accounting for oversampling.
-        out_glyph->X0 = x0 * recip_h + font_off_x;
-        out_glyph->Y0 = y0 * recip_v + font_off_y;
-        out_glyph->X1 = (x0 + (int)r->w) * recip_h + font_off_x;
-        out_glyph->Y1 = (y0 + (int)r->h) * recip_v + font_off_y;
+        out_glyph->X0 = x0 * p->RecipH + font_off_x;
+        out_glyph->Y0 = y0 * p->RecipV + font_off_y;
+        out_glyph->X1 = (x0 + (int)r->w) * p->RecipH + font_off_x;
+        out_glyph->Y1 = (y0 + (int)r->h) * p->RecipV + font_off_y;
         out_glyph->Visible = true;
         out_glyph->PackId = pack_id;
         ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
@@ -4724,16 +5547,52 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     return true;
 }
 
-const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
+static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+{
+    ImGui_ImplStbTrueType_GlyphLoadParams params;
+    ImGui_ImplStbTrueType_InitGlyphLoadParams(src, baked, &params);
+    return ImGui_ImplStbTrueType_LoadGlyphEx(atlas, src, baked, &params, codepoint, out_glyph, out_advance_x);
+}
+
+static int ImGui_ImplStbTrueType_FontBakedLoadGlyphs(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, const ImWchar* codepoints, int codepoints_count, ImVector<ImFontGlyph>* out_glyphs)
 {
-    static ImFontLoader loader;
+    ImGui_ImplStbTrueType_GlyphLoadParams params;
+    ImGui_ImplStbTrueType_InitGlyphLoadParams(src, baked, &params);
+    int loaded_count = 0;
+    for (int n = 0; n < codepoints_count; n++)
+    {
+        ImFontGlyph glyph;
+        if (ImGui_ImplStbTrueType_LoadGlyphEx(atlas, src, baked, &params, codepoints[n], &glyph, NULL))
+        {
+            out_glyphs->push_back(glyph);
+            loaded_count++;
+        }
+    }
+    return loaded_count;
+}
+
+static ImFontLoader ImGui_ImplStbTrueType_CreateFontLoader()
+{
+    ImFontLoader loader;
     loader.Name = "stb_truetype";
     loader.FontSrcInit = ImGui_ImplStbTrueType_FontSrcInit;
     loader.FontSrcDestroy = ImGui_ImplStbTrueType_FontSrcDestroy;
     loader.FontSrcContainsGlyph = ImGui_ImplStbTrueType_FontSrcContainsGlyph;
+    loader.FontSrcGetCodepointRanges = ImGui_ImplStbTrueType_FontSrcGetCodepointRanges;
     loader.FontBakedInit = ImGui_ImplStbTrueType_FontBakedInit;
     loader.FontBakedDestroy = NULL;
     loader.FontBakedLoadGlyph = ImGui_ImplStbTrueType_FontBakedLoadGlyph;
+    loader.FontBakedLoadGlyphs = ImGui_ImplStbTrueType_FontBakedLoadGlyphs;
+#ifdef IMGUI_STB_TRUETYPE_OUTLINE_CACHE
+    loader.FontSrcCompactCache = ImGui_ImplStbTrueType_FontSrcCompactCache;
+    loader.FontSrcGetCacheSize = ImGui_ImplStbTrueType_FontSrcGetCacheSize;
+#endif
+    return loader;
+}
+
+const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
+{
+    static const ImFontLoader loader = ImGui_ImplStbTrueType_CreateFontLoader(); // Initialized once (thread-safe since C++11)
     return &loader;
 }
 
@@ -4806,14 +5665,18 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesChineseFull()
     return &ranges[0];
 }
 
-static void UnpackAccumulativeOffsetsIntoRanges(int base_codepoint, const short* accumulative_offsets, int accumulative_offsets_count, ImWchar* out_ranges)
+// Called from a function-local static initializer (thread-safe since C++11), so contexts on multiple threads may query those ranges concurrently.
+static bool UnpackAccumulativeOffsetsIntoRanges(const ImWchar* base_ranges, int base_ranges_count, int base_codepoint, const short* accumulative_offsets, int accumulative_offsets_count, ImWchar* out_ranges)
 {
+    memcpy(out_ranges, base_ranges, sizeof(ImWchar) * base_ranges_count);
+    out_ranges += base_ranges_count;
     for (int n = 0; n < accumulative_offsets_count; n++, out_ranges += 2)
     {
         out_ranges[0] = out_ranges[1] = (ImWchar)(base_codepoint + accumulative_offsets[n]);
         base_codepoint += accumulative_offsets[n];
     }
     out_ranges[0] = 0;
+    return true;
 }
 
 const ImWchar*  ImFontAtlas::GetGlyphRangesChineseSimplifiedCommon()
@@ -4866,7 +5729,7 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesChineseSimplifiedCommon()
         2,2,7,34,21,13,70,2,128,1,1,2,1,1,2,1,1,3,2,2,2,15,1,4,1,3,4,42,10,6,1,49,85,8,1,2,1,1,4,4,2,3,6,1,5,7,4,3,211,4,1,2,1,2,5,1,2,4,2,2,6,5,6,
         10,3,4,48,100,6,2,16,296,5,27,387,2,2,3,7,16,8,5,38,15,39,21,9,10,3,7,59,13,27,21,47,5,21,6
     };
-    static ImWchar base_ranges[] = // not zero-terminated
+    static const ImWchar base_ranges[] = // not zero-terminated
     {
         0x0020, 0x00FF, // Basic Latin + Latin Supplement
         0x2000, 0x206F, // General Punctuation
@@ -4876,11 +5739,8 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesChineseSimplifiedCommon()
         0xFFFD, 0xFFFD  // Invalid
     };
     static ImWchar full_ranges[IM_ARRAYSIZE(base_ranges) + IM_ARRAYSIZE(accumulative_offsets_from_0x4E00) * 2 + 1] = { 0 };
-    if (!full_ranges[0])
-    {
-        memcpy(full_ranges, base_ranges, sizeof(base_ranges));
-        UnpackAccumulativeOffsetsIntoRanges(0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges + IM_ARRAYSIZE(base_ranges));
-    }
+    static const bool full_ranges_unpacked = UnpackAccumulativeOffsetsIntoRanges(base_ranges, IM_ARRAYSIZE(base_ranges), 0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges);
+    IM_UNUSED(full_ranges_unpacked);
     return &full_ranges[0];
 }
 
@@ -4957,7 +5817,7 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesJapanese()
         4,1,10,3,1,6,1,2,51,5,40,15,24,43,22928,11,1,13,154,70,3,1,1,7,4,10,1,2,1,1,2,1,2,1,2,2,1,1,2,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,
         3,2,1,1,1,1,2,1,1,
     };
-    static ImWchar base_ranges[] = // not zero-terminated
+    static const ImWchar base_ranges[] = // not zero-terminated
     {
         0x0020, 0x00FF, // Basic Latin + Latin Supplement
         0x3000, 0x30FF, // CJK Symbols and Punctuations, Hiragana, Katakana
@@ -4966,11 +5826,8 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesJapanese()
         0xFFFD, 0xFFFD  // Invalid
     };
     static ImWchar full_ranges[IM_ARRAYSIZE(base_ranges) + IM_ARRAYSIZE(accumulative_offsets_from_0x4E00)*2 + 1] = { 0 };
-    if (!full_ranges[0])
-    {
-        memcpy(full_ranges, base_ranges, sizeof(base_ranges));
-        UnpackAccumulativeOffsetsIntoRanges(0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges + IM_ARRAYSIZE(base_ranges));
-    }
+    static const bool full_ranges_unpacked = UnpackAccumulativeOffsetsIntoRanges(base_ranges, IM_ARRAYSIZE(base_ranges), 0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges);
+    IM_UNUSED(full_ranges_unpacked);
     return &full_ranges[0];
 }
 
@@ -5098,6 +5955,8 @@ void ImFont::ClearOutputData()
     FallbackChar = EllipsisChar = 0;
     memset(Used8kPagesMap, 0, sizeof(Used8kPagesMap));
     LastBaked = NULL;
+    SourcesIndex.clear();
+    SourcesIndexDirty = true;
 }
 
 // API is designed this way to avoid exposing the 8K page size
@@ -5193,11 +6052,13 @@ void ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* bake
 }
 
 // Copy to texture, post-process and queue update for backend
+// - Loaders which can write directly into the texture (at 'r', using 'atlas->TexData->Format') may pass src_pixels == NULL to skip the copy.
 void ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch)
 {
     ImTextureData* tex = atlas->TexData;
     IM_ASSERT(r->x + r->w <= tex->Width && r->y + r->h <= tex->Height);
-    ImFontAtlasTextureBlockConvert(src_pixels, src_fmt, src_pitch, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
+    if (src_pixels != NULL)
+        ImFontAtlasTextureBlockConvert(src_pixels, src_fmt, src_pitch, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
     ImFontAtlasPostProcessData pp_data = { atlas, baked->ContainerFont, src, baked, glyph, tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h };
     ImFontAtlasTextureBlockPostProcess(&pp_data);
     ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
@@ -5294,6 +6155,7 @@ ImGuiID ImFontAtlasBakedGetId(ImGuiID font_id, float baked_size, float rasterize
 // ImFontBaked pointers are valid for the entire frame but shall never be kept between frames.
 ImFontBaked* ImFont::GetFontBaked(float size, float density)
 {
+    ImFontAtlasThreadLockScope lock(ContainerAtlas); // LastBaked is shared by all contexts using the atlas
     ImFontBaked* baked = LastBaked;
 
     // Round font size
@@ -5305,13 +6167,19 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
     if (baked && baked->Size == size && baked->RasterizerDensity == density)
         return baked;
 
+    // Size bucketing may return a baked with a different size: reuse it for the same requested size, but query again once
+    // per frame, as the bucketing policy may select another size over time (see ImFontAtlas::BakedSizeExactAfterFrames).
     ImFontAtlas* atlas = ContainerAtlas;
     ImFontAtlasBuilder* builder = atlas->Builder;
-    baked = ImFontAtlasBakedGetOrAdd(atlas, this, size, density);
+    if (baked && LastBakedRequestedSize == size && baked->RasterizerDensity == density && baked->LastUsedFrame == builder->FrameCount)
+        return baked;
+
+    baked = (atlas->BakedSizeBucketsPerOctave > 0) ? ImFontAtlasBakedGetOrAddBucketed(atlas, this, size, density) : ImFontAtlasBakedGetOrAdd(atlas, this, size, density);
     if (baked == NULL)
         return NULL;
     baked->LastUsedFrame = builder->FrameCount;
     LastBaked = baked;
+    LastBakedRequestedSize = size;
     return baked;
 }
 
@@ -5350,6 +6218,61 @@ ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float fo
     return baked;
 }
 
+// Return size of the bucket containing 'font_size', rounding up. With 4 buckets per octave: 16 -> 16, 17 -> 20, 21 -> 23, etc.
+float ImFontAtlasBakedGetBucketSize(ImFontAtlas* atlas, float font_size)
+{
+    const float buckets_per_octave = (float)atlas->BakedSizeBucketsPerOctave;
+    const float bucket_n = ImCeil(ImLog(font_size) / ImLog(2.0f) * buckets_per_octave - 0.001f);
+    const float bucket_size = ImCeil(ImPow(2.0f, bucket_n / buckets_per_octave) - 0.01f);
+    return ImClamp(bucket_size, font_size, ImMax(font_size, IMGUI_FONT_SIZE_MAX));
+}
+
+// Return number of consecutive frames (including current one) a size which is not baked has been requested.
+static int ImFontAtlasBakedUpdateSizeRequest(ImFontAtlasBuilder* builder, ImGuiID baked_id)
+{
+    // Remove requests which were interrupted
+    ImVector<ImFontAtlasBakedSizeRequest>& requests = builder->BakedSizeRequests;
+    for (int n = 0; n < requests.Size; n++)
+        if (requests[n].LastFrame < builder->FrameCount - 1)
+            requests.erase(&requests[n--]);
+
+    ImFontAtlasBakedSizeRequest* req = NULL;
+    for (ImFontAtlasBakedSizeRequest& req_n : requests)
+        if (req_n.BakedId == baked_id)
+            req = &req_n;
+    if (req == NULL)
+    {
+        ImFontAtlasBakedSizeRequest new_req = { baked_id, builder->FrameCount, builder->FrameCount };
+        requests.push_back(new_req);
+        req = &requests.back();
+    }
+    req->LastFrame = builder->FrameCount;
+    return req->LastFrame - req->FirstFrame + 1;
+}
+
+// Size bucketing policy (see ImFontAtlas::BakedSizeBucketsPerOctave)
+// - Exact size is used when already baked.
+// - Otherwise the size is snapped up to its bucket and the caller will render with a scale factor (always <= 1.0f, so glyphs are downscaled).
+// - When ImFontAtlas::BakedSizeExactAfterFrames is set, the exact size gets baked once it has been requested for long enough (e.g. after a zoom animation).
+// - Density is not bucketed, as only few different densities are expected to be in use.
+ImFontBaked* ImFontAtlasBakedGetOrAddBucketed(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density)
+{
+    // Legacy backends preload a single size and use closest match afterwards.
+    if ((font->Flags & ImFontFlags_LockBakedSizes) || atlas->Locked || !atlas->RendererHasTextures)
+        return ImFontAtlasBakedGetOrAdd(atlas, font, font_size, font_rasterizer_density);
+    const float bucket_size = ImFontAtlasBakedGetBucketSize(atlas, font_size);
+    if (bucket_size == font_size)
+        return ImFontAtlasBakedGetOrAdd(atlas, font, font_size, font_rasterizer_density);
+
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImGuiID baked_id = ImFontAtlasBakedGetId(font->FontId, font_size, font_rasterizer_density);
+    if (ImFontBaked* baked = (ImFontBaked*)builder->BakedMap.GetVoidPtr(baked_id))
+        return baked;
+    if (atlas->BakedSizeExactAfterFrames > 0 && ImFontAtlasBakedUpdateSizeRequest(builder, baked_id) >= atlas->BakedSizeExactAfterFrames)
+        return ImFontAtlasBakedGetOrAdd(atlas, font, font_size, font_rasterizer_density);
+    return ImFontAtlasBakedGetOrAdd(atlas, font, bucket_size, font_rasterizer_density);
+}
+
 // Trim trailing space and find beginning of next line
 const char* ImTextCalcWordWrapNextLineStart(const char* text, const char* text_end, ImDrawTextFlags flags)
 {
@@ -5378,6 +6301,7 @@ const char* ImFontCalcWordWrapPositionEx(ImFont* font, float size, const char* t
     // Cut words that cannot possibly fit within one line.
     // e.g.: "The tropical fish" with ~5 characters worth of width --> "The tr" "opical" "fish"
 
+    ImFontAtlasThreadLockScope lock(font->ContainerAtlas);
     ImFontBaked* baked = font->GetFontBaked(size);
     const float scale = size / baked->Size;
 
@@ -5415,7 +6339,7 @@ const char* ImFontCalcWordWrapPositionEx(ImFont* font, float size, const char* t
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
         float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
         if (char_width < 0.0f)
-            char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
+            char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c, next_s, text_end);
 
         if (ImCharIsBlankW(c))
         {
@@ -5479,6 +6403,7 @@ ImVec2 ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wra
     if (!text_end_display)
         text_end_display = text_end;
 
+    ImFontAtlasThreadLockScope lock(font->ContainerAtlas);
     ImFontBaked* baked = font->GetFontBaked(size);
     const float line_height = size;
     const float scale = line_height / baked->Size;
@@ -5536,7 +6461,7 @@ ImVec2 ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wra
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
         float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
         if (char_width < 0.0f)
-            char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
+            char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c, s, text_end);
         char_width *= scale;
 
         if (line_width + char_width >= max_width)
@@ -5571,6 +6496,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c, const ImVec4* cpu_fine_clip)
 {
+    ImFontAtlasThreadLockScope lock(ContainerAtlas, draw_list->_Data);
     ImFontBaked* baked = GetFontBaked(size);
     const ImFontGlyph* glyph = baked->FindGlyph(c);
     if (!glyph || !glyph->Visible)
@@ -5607,10 +6533,49 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
 }
 
+// SSE path to write a glyph quad, used by RenderText() for glyphs which don't need CPU fine clipping.
+// Each vertex is written with one unaligned 16 bytes store for pos+uv (which are contiguous with the default ImDrawVert layout) and one store for col.
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+#define IMGUI_ENABLE_SSE_TEXT_QUADS
+static inline void ImFontRenderGlyphQuadSSE(ImDrawVert* vtx_write, ImDrawIdx* idx_write, unsigned int vtx_index, __m128 p, __m128 uv, ImU32 col)
+{
+    // p = (x1, y1, x2, y2), uv = (u1, v1, u2, v2)
+    const __m128 v0 = _mm_movelh_ps(p, uv);                                     // x1, y1, u1, v1
+    const __m128 v2 = _mm_movehl_ps(uv, p);                                     // x2, y2, u2, v2
+    const __m128 t1 = _mm_shuffle_ps(v2, v0, _MM_SHUFFLE(3, 1, 2, 0));          // x2, u2, y1, v1
+    const __m128 t3 = _mm_shuffle_ps(v0, v2, _MM_SHUFFLE(3, 1, 2, 0));          // x1, u1, y2, v2
+    _mm_storeu_ps(&vtx_write[0].pos.x, v0);
+    _mm_storeu_ps(&vtx_write[1].pos.x, _mm_shuffle_ps(t1, t1, _MM_SHUFFLE(3, 1, 2, 0))); // x2, y1, u2, v1
+    _mm_storeu_ps(&vtx_write[2].pos.x, v2);
+    _mm_storeu_ps(&vtx_write[3].pos.x, _mm_shuffle_ps(t3, t3, _MM_SHUFFLE(3, 1, 2, 0))); // x1, y2, u1, v2
+    vtx_write[0].col = vtx_write[1].col = vtx_write[2].col = vtx_write[3].col = col;
+
+    // Indices: (0, 1, 2, 0, 2, 3)
+    if (sizeof(ImDrawIdx) == 2)
+    {
+        // 16-bit indices are written as one 64-bit + one 32-bit store (SSE implies x86, so little-endian).
+        // Each lane is truncated individually, same as the scalar path, as vtx_index may exceed 16-bit without ImDrawListFlags_AllowVtxOffset.
+        const ImU64 i0 = (ImU16)vtx_index, i1 = (ImU16)(vtx_index + 1), i2 = (ImU16)(vtx_index + 2), i3 = (ImU16)(vtx_index + 3);
+        const ImU64 idx_0120 = i0 | (i1 << 16) | (i2 << 32) | (i0 << 48);
+        const ImU32 idx_23 = (ImU32)(i2 | (i3 << 16));
+        memcpy(idx_write, &idx_0120, 8);
+        memcpy(idx_write + 4, &idx_23, 4);
+    }
+    else
+    {
+        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+    }
+}
+#endif
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 // DO NOT CALL DIRECTLY THIS WILL CHANGE WILDLY IN 2025-2025. Use ImDrawList::AddText().
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, ImDrawTextFlags flags)
 {
+    IMGUI_PROFILER_ZONE("ImFont::RenderText");
+    ImFontAtlasThreadLockScope lock(ContainerAtlas, draw_list->_Data);
+
     // Align to be pixel perfect
 begin:
     float x = IM_TRUNC(pos.x);
@@ -5735,6 +6700,18 @@ begin:
             float y2 = y + glyph->Y1 * scale;
             if (x1 <= clip_rect.z && x2 >= clip_rect.x)
             {
+#ifdef IMGUI_ENABLE_SSE_TEXT_QUADS
+                // Fast path: glyph doesn't need CPU fine clipping
+                if (!cpu_fine_clip || (x1 >= clip_rect.x && y1 >= clip_rect.y && x2 <= clip_rect.z && y2 <= clip_rect.w))
+                {
+                    ImFontRenderGlyphQuadSSE(vtx_write, idx_write, vtx_index, _mm_setr_ps(x1, y1, x2, y2), _mm_loadu_ps(&glyph->U0), glyph->Colored ? col_untinted : col);
+                    vtx_write += 4;
+                    vtx_index += 4;
+                    idx_write += 6;
+                    x += char_width;
+                    continue;
+                }
+#endif
                 // Render a character
                 float u1 = glyph->U0;
                 float v1 = glyph->V0;
@@ -6025,7 +7002,7 @@ void ImGui::RenderColorRectWithAlphaCheckerboard(ImDrawList* draw_list, ImVec2 p
 //-----------------------------------------------------------------------------
 // [SECTION] Decompression code
 //-----------------------------------------------------------------------------
-// Compressed with stb_compress() then converted to a C array and encoded as base85.
+// Compressed with stb_compress() or in LZ4 block format, then converted to a C array (optionally encoded as base85).
 // Use the program in misc/fonts/binary_to_compressed_c.cpp to create the array from a TTF file.
 // The purpose of encoding as base85 instead of "0x00,0x01,..." style is only save on _source code_ size.
 // Decompression from stb.h (public domain) by Sean Barrett https://github.com/nothings/stb/blob/master/stb.h
@@ -6036,9 +7013,9 @@ static unsigned int stb_decompress_length(const unsigned char *input)
     return (input[8] << 24) + (input[9] << 16) + (input[10] << 8) + input[11];
 }
 
-static unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
-static const unsigned char *stb__barrier_in_b;
-static unsigned char *stb__dout;
+static IM_THREAD_LOCAL unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
+static IM_THREAD_LOCAL const unsigned char *stb__barrier_in_b;
+static IM_THREAD_LOCAL unsigned char *stb__dout;
 static void stb__match(const unsigned char *data, unsigned int length)
 {
     // INVERSE of memmove... write each byte before copying the next...
@@ -6141,6 +7118,93 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
     }
 }
 
+// LZ4 block format decompression, as output by 'binary_to_compressed_c -lz4'.
+// See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+// Data is prefixed with an 8 bytes header: 'L','Z','4',0 followed by the big-endian decompressed size.
+// Unlike stb_decompress() there is no checksum: every read and write is bounds-checked instead.
+// 'input_size' may include trailing padding (e.g. from base85 or u32 encodings): we stop once the output is full.
+static bool ImLz4IsCompressedData(const unsigned char* input, int input_size)
+{
+    return input_size >= 8 && input[0] == 'L' && input[1] == 'Z' && input[2] == '4' && input[3] == 0;
+}
+
+static unsigned int ImLz4DecompressLength(const unsigned char* input)
+{
+    return ((unsigned int)input[4] << 24) + (input[5] << 16) + (input[6] << 8) + input[7];
+}
+
+static unsigned int ImLz4Decompress(unsigned char* output, const unsigned char* input, unsigned int input_size)
+{
+    const unsigned int olen = ImLz4DecompressLength(input);
+    const unsigned char* ip = input + 8;
+    const unsigned char* ip_end = input + input_size;
+    unsigned char* op = output;
+    unsigned char* op_end = output + olen;
+    while (op < op_end)
+    {
+        if (ip >= ip_end)
+            return 0;
+        const unsigned int token = *ip++;
+
+        // Literals
+        unsigned int literals_len = token >> 4;
+        if (literals_len == 15)
+            for (unsigned int b = 255; b == 255; literals_len += b)
+            {
+                if (ip >= ip_end)
+                    return 0;
+                b = *ip++;
+            }
+        if (literals_len <= 16 && ip_end - ip >= 16 && op_end - op >= 16)
+        {
+            memcpy(op, ip, 16); // Fast path: fixed-size copy, may overrun into bytes that will be overwritten later
+        }
+        else
+        {
+            if (literals_len > (unsigned int)(ip_end - ip) || literals_len > (unsigned int)(op_end - op))
+                return 0;
+            memcpy(op, ip, literals_len);
+        }
+        ip += literals_len;
+        op += literals_len;
+        if (op == op_end)
+            break; // Last sequence only has literals
+
+        // Match
+        if (ip_end - ip < 2)
+            return 0;
+        const unsigned int offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (unsigned int)(op - output))
+            return 0;
+        unsigned int match_len = token & 15;
+        if (match_len == 15)
+            for (unsigned int b = 255; b == 255; match_len += b)
+            {
+                if (ip >= ip_end)
+                    return 0;
+                b = *ip++;
+            }
+        match_len += 4;
+        if (match_len > (unsigned int)(op_end - op))
+            return 0;
+        const unsigned char* match = op - offset;
+        unsigned char* match_op_end = op + match_len;
+        if (offset >= 8 && op_end - match_op_end >= 8)
+        {
+            for (; op < match_op_end; op += 8, match += 8) // Fast path: 8 bytes chunks, may overrun by up to 7 bytes
+                memcpy(op, match, 8);
+            op = match_op_end;
+        }
+        else
+        {
+            while (op < match_op_end) // Overlapping copy (repeating pattern) or near the end of output
+                *op++ = *match++;
+        }
+    }
+    return olen;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Default font data (ProggyClean.ttf)
 //-----------------------------------------------------------------------------
@@ -6154,176 +7218,131 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
 #ifndef IMGUI_DISABLE_DEFAULT_FONT
 
 // File: 'ProggyClean.ttf' (41208 bytes)
-// Exported using binary_to_compressed_c.exe -u8 "ProggyClean.ttf" proggy_clean_ttf
-static const unsigned int proggy_clean_ttf_compressed_size = 9583;
-static const unsigned char proggy_clean_ttf_compressed_data[9583] =
-{
-    87,188,0,0,0,0,0,0,0,0,160,248,0,4,0,0,55,0,1,0,0,0,12,0,128,0,3,0,64,79,83,47,50,136,235,116,144,0,0,1,72,130,21,44,78,99,109,97,112,2,18,35,117,0,0,3,160,130,19,36,82,99,118,116,
-    32,130,23,130,2,33,4,252,130,4,56,2,103,108,121,102,18,175,137,86,0,0,7,4,0,0,146,128,104,101,97,100,215,145,102,211,130,27,32,204,130,3,33,54,104,130,16,39,8,66,1,195,0,0,1,4,130,
-    15,59,36,104,109,116,120,138,0,126,128,0,0,1,152,0,0,2,6,108,111,99,97,140,115,176,216,0,0,5,130,30,41,2,4,109,97,120,112,1,174,0,218,130,31,32,40,130,16,44,32,110,97,109,101,37,89,
-    187,150,0,0,153,132,130,19,44,158,112,111,115,116,166,172,131,239,0,0,155,36,130,51,44,210,112,114,101,112,105,2,1,18,0,0,4,244,130,47,32,8,132,203,46,1,0,0,60,85,233,213,95,15,60,
-    245,0,3,8,0,131,0,34,183,103,119,130,63,43,0,0,189,146,166,215,0,0,254,128,3,128,131,111,130,241,33,2,0,133,0,32,1,130,65,38,192,254,64,0,0,3,128,131,16,130,5,32,1,131,7,138,3,33,2,
-    0,130,17,36,1,1,0,144,0,130,121,130,23,38,2,0,8,0,64,0,10,130,9,32,118,130,9,130,6,32,0,130,59,33,1,144,131,200,35,2,188,2,138,130,16,32,143,133,7,37,1,197,0,50,2,0,131,0,33,4,9,131,
-    5,145,3,43,65,108,116,115,0,64,0,0,32,172,8,0,131,0,35,5,0,1,128,131,77,131,3,33,3,128,191,1,33,1,128,130,184,35,0,0,128,0,130,3,131,11,32,1,130,7,33,0,128,131,1,32,1,136,9,32,0,132,
-    15,135,5,32,1,131,13,135,27,144,35,32,1,149,25,131,21,32,0,130,0,32,128,132,103,130,35,132,39,32,0,136,45,136,97,133,17,130,5,33,0,0,136,19,34,0,128,1,133,13,133,5,32,128,130,15,132,
-    131,32,3,130,5,32,3,132,27,144,71,32,0,133,27,130,29,130,31,136,29,131,63,131,3,65,63,5,132,5,132,205,130,9,33,0,0,131,9,137,119,32,3,132,19,138,243,130,55,32,1,132,35,135,19,131,201,
-    136,11,132,143,137,13,130,41,32,0,131,3,144,35,33,128,0,135,1,131,223,131,3,141,17,134,13,136,63,134,15,136,53,143,15,130,96,33,0,3,131,4,130,3,34,28,0,1,130,5,34,0,0,76,130,17,131,
-    9,36,28,0,4,0,48,130,17,46,8,0,8,0,2,0,0,0,127,0,255,32,172,255,255,130,9,34,0,0,129,132,9,130,102,33,223,213,134,53,132,22,33,1,6,132,6,64,4,215,32,129,165,216,39,177,0,1,141,184,
-    1,255,133,134,45,33,198,0,193,1,8,190,244,1,28,1,158,2,20,2,136,2,252,3,20,3,88,3,156,3,222,4,20,4,50,4,80,4,98,4,162,5,22,5,102,5,188,6,18,6,116,6,214,7,56,7,126,7,236,8,78,8,108,
-    8,150,8,208,9,16,9,74,9,136,10,22,10,128,11,4,11,86,11,200,12,46,12,130,12,234,13,94,13,164,13,234,14,80,14,150,15,40,15,176,16,18,16,116,16,224,17,82,17,182,18,4,18,110,18,196,19,
-    76,19,172,19,246,20,88,20,174,20,234,21,64,21,128,21,166,21,184,22,18,22,126,22,198,23,52,23,142,23,224,24,86,24,186,24,238,25,54,25,150,25,212,26,72,26,156,26,240,27,92,27,200,28,
-    4,28,76,28,150,28,234,29,42,29,146,29,210,30,64,30,142,30,224,31,36,31,118,31,166,31,166,32,16,130,1,52,46,32,138,32,178,32,200,33,20,33,116,33,152,33,238,34,98,34,134,35,12,130,1,
-    33,128,35,131,1,60,152,35,176,35,216,36,0,36,74,36,104,36,144,36,174,37,6,37,96,37,130,37,248,37,248,38,88,38,170,130,1,8,190,216,39,64,39,154,40,10,40,104,40,168,41,14,41,32,41,184,
-    41,248,42,54,42,96,42,96,43,2,43,42,43,94,43,172,43,230,44,32,44,52,44,154,45,40,45,92,45,120,45,170,45,232,46,38,46,166,47,38,47,182,47,244,48,94,48,200,49,62,49,180,50,30,50,158,
-    51,30,51,130,51,238,52,92,52,206,53,58,53,134,53,212,54,38,54,114,54,230,55,118,55,216,56,58,56,166,57,18,57,116,57,174,58,46,58,154,59,6,59,124,59,232,60,58,60,150,61,34,61,134,61,
-    236,62,86,62,198,63,42,63,154,64,18,64,106,64,208,65,54,65,162,66,8,66,64,66,122,66,184,66,240,67,98,67,204,68,42,68,138,68,238,69,88,69,182,69,226,70,84,70,180,71,20,71,122,71,218,
-    72,84,72,198,73,64,0,36,70,21,8,8,77,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,107,0,111,0,115,
-    0,119,0,123,0,127,0,131,0,135,0,139,0,143,0,0,17,53,51,21,49,150,3,32,5,130,23,32,33,130,3,211,7,151,115,32,128,133,0,37,252,128,128,2,128,128,190,5,133,74,32,4,133,6,206,5,42,0,7,
-    1,128,0,0,2,0,4,0,0,65,139,13,37,0,1,53,51,21,7,146,3,32,3,130,19,32,1,141,133,32,3,141,14,131,13,38,255,0,128,128,0,6,1,130,84,35,2,128,4,128,140,91,132,89,32,51,65,143,6,139,7,33,
-    1,0,130,57,32,254,130,3,32,128,132,4,32,4,131,14,138,89,35,0,0,24,0,130,0,33,3,128,144,171,66,55,33,148,115,65,187,19,32,5,130,151,143,155,163,39,32,1,136,182,32,253,134,178,132,7,
-    132,200,145,17,32,3,65,48,17,165,17,39,0,0,21,0,128,255,128,3,65,175,17,65,3,27,132,253,131,217,139,201,155,233,155,27,131,67,131,31,130,241,33,255,0,131,181,137,232,132,15,132,4,138,
-    247,34,255,0,128,179,238,32,0,130,0,32,20,65,239,48,33,0,19,67,235,10,32,51,65,203,14,65,215,11,32,7,154,27,135,39,32,33,130,35,33,128,128,130,231,32,253,132,231,32,128,132,232,34,
-    128,128,254,133,13,136,8,32,253,65,186,5,130,36,130,42,176,234,133,231,34,128,0,0,66,215,44,33,0,1,68,235,6,68,211,19,32,49,68,239,14,139,207,139,47,66,13,7,32,51,130,47,33,1,0,130,
-    207,35,128,128,1,0,131,222,131,5,130,212,130,6,131,212,32,0,130,10,133,220,130,233,130,226,32,254,133,255,178,233,39,3,1,128,3,0,2,0,4,68,15,7,68,99,12,130,89,130,104,33,128,4,133,
-    93,130,10,38,0,0,11,1,0,255,0,68,63,16,70,39,9,66,215,8,32,7,68,77,6,68,175,14,32,29,68,195,6,132,7,35,2,0,128,255,131,91,132,4,65,178,5,141,111,67,129,23,165,135,140,107,142,135,33,
-    21,5,69,71,6,131,7,33,1,0,140,104,132,142,130,4,137,247,140,30,68,255,12,39,11,0,128,0,128,3,0,3,69,171,15,67,251,7,65,15,8,66,249,11,65,229,7,67,211,7,66,13,7,35,1,128,128,254,133,
-    93,32,254,131,145,132,4,132,18,32,2,151,128,130,23,34,0,0,9,154,131,65,207,8,68,107,15,68,51,7,32,7,70,59,7,135,121,130,82,32,128,151,111,41,0,0,4,0,128,255,0,1,128,1,137,239,33,0,
-    37,70,145,10,65,77,10,65,212,14,37,0,0,0,5,0,128,66,109,5,70,123,10,33,0,19,72,33,18,133,237,70,209,11,33,0,2,130,113,137,119,136,115,33,1,0,133,43,130,5,34,0,0,10,69,135,6,70,219,
-    13,66,155,7,65,9,12,66,157,11,66,9,11,32,7,130,141,132,252,66,151,9,137,9,66,15,30,36,0,20,0,128,0,130,218,71,11,42,68,51,8,65,141,7,73,19,15,69,47,23,143,39,66,81,7,32,1,66,55,6,34,
-    1,128,128,68,25,5,69,32,6,137,6,136,25,32,254,131,42,32,3,66,88,26,148,26,32,0,130,0,32,14,164,231,70,225,12,66,233,7,67,133,19,71,203,15,130,161,32,255,130,155,32,254,139,127,134,
-    12,164,174,33,0,15,164,159,33,59,0,65,125,20,66,25,7,32,5,68,191,6,66,29,7,144,165,65,105,9,35,128,128,255,0,137,2,133,182,164,169,33,128,128,197,171,130,155,68,235,7,32,21,70,77,19,
-    66,21,10,68,97,8,66,30,5,66,4,43,34,0,17,0,71,19,41,65,253,20,71,25,23,65,91,15,65,115,7,34,2,128,128,66,9,8,130,169,33,1,0,66,212,13,132,28,72,201,43,35,0,0,0,18,66,27,38,76,231,5,
-    68,157,20,135,157,32,7,68,185,13,65,129,28,66,20,5,32,253,66,210,11,65,128,49,133,61,32,0,65,135,6,74,111,37,72,149,12,66,203,19,65,147,19,68,93,7,68,85,8,76,4,5,33,255,0,133,129,34,
-    254,0,128,68,69,8,181,197,34,0,0,12,65,135,32,65,123,20,69,183,27,133,156,66,50,5,72,87,10,67,137,32,33,0,19,160,139,78,251,13,68,55,20,67,119,19,65,91,36,69,177,15,32,254,143,16,65,
-    98,53,32,128,130,0,32,0,66,43,54,70,141,23,66,23,15,131,39,69,47,11,131,15,70,129,19,74,161,9,36,128,255,0,128,254,130,153,65,148,32,67,41,9,34,0,0,4,79,15,5,73,99,10,71,203,8,32,3,
-    72,123,6,72,43,8,32,2,133,56,131,99,130,9,34,0,0,6,72,175,5,73,159,14,144,63,135,197,132,189,133,66,33,255,0,73,6,7,70,137,12,35,0,0,0,10,130,3,73,243,25,67,113,12,65,73,7,69,161,7,
-    138,7,37,21,2,0,128,128,254,134,3,73,116,27,33,128,128,130,111,39,12,0,128,1,0,3,128,2,72,219,21,35,43,0,47,0,67,47,20,130,111,33,21,1,68,167,13,81,147,8,133,230,32,128,77,73,6,32,
-    128,131,142,134,18,130,6,32,255,75,18,12,131,243,37,128,0,128,3,128,3,74,231,21,135,123,32,29,134,107,135,7,32,21,74,117,7,135,7,134,96,135,246,74,103,23,132,242,33,0,10,67,151,28,
-    67,133,20,66,141,11,131,11,32,3,77,71,6,32,128,130,113,32,1,81,4,6,134,218,66,130,24,131,31,34,0,26,0,130,0,77,255,44,83,15,11,148,155,68,13,7,32,49,78,231,18,79,7,11,73,243,11,32,
-    33,65,187,10,130,63,65,87,8,73,239,19,35,0,128,1,0,131,226,32,252,65,100,6,32,128,139,8,33,1,0,130,21,32,253,72,155,44,73,255,20,32,128,71,67,8,81,243,39,67,15,20,74,191,23,68,121,
-    27,32,1,66,150,6,32,254,79,19,11,131,214,32,128,130,215,37,2,0,128,253,0,128,136,5,65,220,24,147,212,130,210,33,0,24,72,219,42,84,255,13,67,119,16,69,245,19,72,225,19,65,3,15,69,93,
-    19,131,55,132,178,71,115,14,81,228,6,142,245,33,253,0,132,43,172,252,65,16,11,75,219,8,65,219,31,66,223,24,75,223,10,33,29,1,80,243,10,66,175,8,131,110,134,203,133,172,130,16,70,30,
-    7,164,183,130,163,32,20,65,171,48,65,163,36,65,143,23,65,151,19,65,147,13,65,134,17,133,17,130,216,67,114,5,164,217,65,137,12,72,147,48,79,71,19,74,169,22,80,251,8,65,173,7,66,157,
-    15,74,173,15,32,254,65,170,8,71,186,45,72,131,6,77,143,40,187,195,152,179,65,123,38,68,215,57,68,179,15,65,85,7,69,187,14,32,21,66,95,15,67,19,25,32,1,83,223,6,32,2,76,240,7,77,166,
-    43,65,8,5,130,206,32,0,67,39,54,143,167,66,255,19,82,193,11,151,47,85,171,5,67,27,17,132,160,69,172,11,69,184,56,66,95,6,33,12,1,130,237,32,2,68,179,27,68,175,16,80,135,15,72,55,7,
-    71,87,12,73,3,12,132,12,66,75,32,76,215,5,169,139,147,135,148,139,81,12,12,81,185,36,75,251,7,65,23,27,76,215,9,87,165,12,65,209,15,72,157,7,65,245,31,32,128,71,128,6,32,1,82,125,5,
-    34,0,128,254,131,169,32,254,131,187,71,180,9,132,27,32,2,88,129,44,32,0,78,47,40,65,79,23,79,171,14,32,21,71,87,8,72,15,14,65,224,33,130,139,74,27,62,93,23,7,68,31,7,75,27,7,139,15,
-    74,3,7,74,23,27,65,165,11,65,177,15,67,123,5,32,1,130,221,32,252,71,96,5,74,12,12,133,244,130,25,34,1,0,128,130,2,139,8,93,26,8,65,9,32,65,57,14,140,14,32,0,73,79,67,68,119,11,135,
-    11,32,51,90,75,14,139,247,65,43,7,131,19,139,11,69,159,11,65,247,6,36,1,128,128,253,0,90,71,9,33,1,0,132,14,32,128,89,93,14,69,133,6,130,44,131,30,131,6,65,20,56,33,0,16,72,179,40,
-    75,47,12,65,215,19,74,95,19,65,43,11,131,168,67,110,5,75,23,17,69,106,6,75,65,5,71,204,43,32,0,80,75,47,71,203,15,159,181,68,91,11,67,197,7,73,101,13,68,85,6,33,128,128,130,214,130,
-    25,32,254,74,236,48,130,194,37,0,18,0,128,255,128,77,215,40,65,139,64,32,51,80,159,10,65,147,39,130,219,84,212,43,130,46,75,19,97,74,33,11,65,201,23,65,173,31,33,1,0,79,133,6,66,150,
-    5,67,75,48,85,187,6,70,207,37,32,71,87,221,13,73,163,14,80,167,15,132,15,83,193,19,82,209,8,78,99,9,72,190,11,77,110,49,89,63,5,80,91,35,99,63,32,70,235,23,81,99,10,69,148,10,65,110,
-    36,32,0,65,99,47,95,219,11,68,171,51,66,87,7,72,57,7,74,45,17,143,17,65,114,50,33,14,0,65,111,40,159,195,98,135,15,35,7,53,51,21,100,78,9,95,146,16,32,254,82,114,6,32,128,67,208,37,
-    130,166,99,79,58,32,17,96,99,14,72,31,19,72,87,31,82,155,7,67,47,14,32,21,131,75,134,231,72,51,17,72,78,8,133,8,80,133,6,33,253,128,88,37,9,66,124,36,72,65,12,134,12,71,55,43,66,139,
-    27,85,135,10,91,33,12,65,35,11,66,131,11,71,32,8,90,127,6,130,244,71,76,11,168,207,33,0,12,66,123,32,32,0,65,183,15,68,135,11,66,111,7,67,235,11,66,111,15,32,254,97,66,12,160,154,67,
-    227,52,80,33,15,87,249,15,93,45,31,75,111,12,93,45,11,77,99,9,160,184,81,31,12,32,15,98,135,30,104,175,7,77,249,36,69,73,15,78,5,12,32,254,66,151,19,34,128,128,4,87,32,12,149,35,133,
-    21,96,151,31,32,19,72,35,5,98,173,15,143,15,32,21,143,99,158,129,33,0,0,65,35,52,65,11,15,147,15,98,75,11,33,1,0,143,151,132,15,32,254,99,200,37,132,43,130,4,39,0,10,0,128,1,128,3,
-    0,104,151,14,97,187,20,69,131,15,67,195,11,87,227,7,33,128,128,132,128,33,254,0,68,131,9,65,46,26,42,0,0,0,7,0,0,255,128,3,128,0,88,223,15,33,0,21,89,61,22,66,209,12,65,2,12,37,0,2,
-    1,0,3,128,101,83,8,36,0,1,53,51,29,130,3,34,21,1,0,66,53,8,32,0,68,215,6,100,55,25,107,111,9,66,193,11,72,167,8,73,143,31,139,31,33,1,0,131,158,32,254,132,5,33,253,128,65,16,9,133,
-    17,89,130,25,141,212,33,0,0,93,39,8,90,131,25,93,39,14,66,217,6,106,179,8,159,181,71,125,15,139,47,138,141,87,11,14,76,23,14,65,231,26,140,209,66,122,8,81,179,5,101,195,26,32,47,74,
-    75,13,69,159,11,83,235,11,67,21,16,136,167,131,106,130,165,130,15,32,128,101,90,24,134,142,32,0,65,103,51,108,23,11,101,231,15,75,173,23,74,237,23,66,15,6,66,46,17,66,58,17,65,105,
-    49,66,247,55,71,179,12,70,139,15,86,229,7,84,167,15,32,1,95,72,12,89,49,6,33,128,128,65,136,38,66,30,9,32,0,100,239,7,66,247,29,70,105,20,65,141,19,69,81,15,130,144,32,128,83,41,5,
-    32,255,131,177,68,185,5,133,126,65,97,37,32,0,130,0,33,21,0,130,55,66,195,28,67,155,13,34,79,0,83,66,213,13,73,241,19,66,59,19,65,125,11,135,201,66,249,16,32,128,66,44,11,66,56,17,
-    68,143,8,68,124,38,67,183,12,96,211,9,65,143,29,112,171,5,32,0,68,131,63,34,33,53,51,71,121,11,32,254,98,251,16,32,253,74,231,10,65,175,37,133,206,37,0,0,8,1,0,0,107,123,11,113,115,
-    9,33,0,1,130,117,131,3,73,103,7,66,51,18,66,44,5,133,75,70,88,5,32,254,65,39,12,68,80,9,34,12,0,128,107,179,28,68,223,6,155,111,86,147,15,32,2,131,82,141,110,33,254,0,130,15,32,4,103,
-    184,15,141,35,87,176,5,83,11,5,71,235,23,114,107,11,65,189,16,70,33,15,86,153,31,135,126,86,145,30,65,183,41,32,0,130,0,32,10,65,183,24,34,35,0,39,67,85,9,65,179,15,143,15,33,1,0,65,
-    28,17,157,136,130,123,32,20,130,3,32,0,97,135,24,115,167,19,80,71,12,32,51,110,163,14,78,35,19,131,19,155,23,77,229,8,78,9,17,151,17,67,231,46,94,135,8,73,31,31,93,215,56,82,171,25,
-    72,77,8,162,179,169,167,99,131,11,69,85,19,66,215,15,76,129,13,68,115,22,72,79,35,67,113,5,34,0,0,19,70,31,46,65,89,52,73,223,15,85,199,33,95,33,8,132,203,73,29,32,67,48,16,177,215,
-    101,13,15,65,141,43,69,141,15,75,89,5,70,0,11,70,235,21,178,215,36,10,0,128,0,0,71,207,24,33,0,19,100,67,6,80,215,11,66,67,7,80,43,12,71,106,7,80,192,5,65,63,5,66,217,26,33,0,13,156,
-    119,68,95,5,72,233,12,134,129,85,81,11,76,165,20,65,43,8,73,136,8,75,10,31,38,128,128,0,0,0,13,1,130,4,32,3,106,235,29,114,179,12,66,131,23,32,7,77,133,6,67,89,12,131,139,116,60,9,
-    89,15,37,32,0,74,15,7,103,11,22,65,35,5,33,55,0,93,81,28,67,239,23,78,85,5,107,93,14,66,84,17,65,193,26,74,183,10,66,67,34,143,135,79,91,15,32,7,117,111,8,75,56,9,84,212,9,154,134,
-    32,0,130,0,32,18,130,3,70,171,41,83,7,16,70,131,19,84,191,15,84,175,19,84,167,30,84,158,12,154,193,68,107,15,33,0,0,65,79,42,65,71,7,73,55,7,118,191,16,83,180,9,32,255,76,166,9,154,
-    141,32,0,130,0,69,195,52,65,225,15,151,15,75,215,31,80,56,10,68,240,17,100,32,9,70,147,39,65,93,12,71,71,41,92,85,15,84,135,23,78,35,15,110,27,10,84,125,8,107,115,29,136,160,38,0,0,
-    14,0,128,255,0,82,155,24,67,239,8,119,255,11,69,131,11,77,29,6,112,31,8,134,27,105,203,8,32,2,75,51,11,75,195,12,74,13,29,136,161,37,128,0,0,0,11,1,130,163,82,115,8,125,191,17,69,35,
-    12,74,137,15,143,15,32,1,65,157,12,136,12,161,142,65,43,40,65,199,6,65,19,24,102,185,11,76,123,11,99,6,12,135,12,32,254,130,8,161,155,101,23,9,39,8,0,0,1,128,3,128,2,78,63,17,72,245,
-    12,67,41,11,90,167,9,32,128,97,49,9,32,128,109,51,14,132,97,81,191,8,130,97,125,99,12,121,35,9,127,75,15,71,79,12,81,151,23,87,97,7,70,223,15,80,245,16,105,97,15,32,254,113,17,6,32,
-    128,130,8,105,105,8,76,122,18,65,243,21,74,63,7,38,4,1,0,255,0,2,0,119,247,28,133,65,32,255,141,91,35,0,0,0,16,67,63,36,34,59,0,63,77,59,9,119,147,11,143,241,66,173,15,66,31,11,67,
-    75,8,81,74,16,32,128,131,255,87,181,42,127,43,5,34,255,128,2,120,235,11,37,19,0,23,0,0,37,109,191,14,118,219,7,127,43,14,65,79,14,35,0,0,0,3,73,91,5,130,5,38,3,0,7,0,11,0,0,70,205,
-    11,88,221,12,32,0,73,135,7,87,15,22,73,135,10,79,153,15,97,71,19,65,49,11,32,1,131,104,121,235,11,80,65,11,142,179,144,14,81,123,46,32,1,88,217,5,112,5,8,65,201,15,83,29,15,122,147,
-    11,135,179,142,175,143,185,67,247,39,66,199,7,35,5,0,128,3,69,203,15,123,163,12,67,127,7,130,119,71,153,10,141,102,70,175,8,32,128,121,235,30,136,89,100,191,11,116,195,11,111,235,15,
-    72,39,7,32,2,97,43,5,132,5,94,67,8,131,8,125,253,10,32,3,65,158,16,146,16,130,170,40,0,21,0,128,0,0,3,128,5,88,219,15,24,64,159,32,135,141,65,167,15,68,163,10,97,73,49,32,255,82,58,
-    7,93,80,8,97,81,16,24,67,87,52,34,0,0,5,130,231,33,128,2,80,51,13,65,129,8,113,61,6,132,175,65,219,5,130,136,77,152,17,32,0,95,131,61,70,215,6,33,21,51,90,53,10,78,97,23,105,77,31,
-    65,117,7,139,75,24,68,195,9,24,64,22,9,33,0,128,130,11,33,128,128,66,25,5,121,38,5,134,5,134,45,66,40,36,66,59,18,34,128,0,0,66,59,81,135,245,123,103,19,120,159,19,77,175,12,33,255,
-    0,87,29,10,94,70,21,66,59,54,39,3,1,128,3,0,2,128,4,24,65,7,15,66,47,7,72,98,12,37,0,0,0,3,1,0,24,65,55,21,131,195,32,1,67,178,6,33,4,0,77,141,8,32,6,131,47,74,67,16,24,69,3,20,24,
-    65,251,7,133,234,130,229,94,108,17,35,0,0,6,0,141,175,86,59,5,162,79,85,166,8,70,112,13,32,13,24,64,67,26,24,71,255,7,123,211,12,80,121,11,69,215,15,66,217,11,69,71,10,131,113,132,
-    126,119,90,9,66,117,19,132,19,32,0,130,0,24,64,47,59,33,7,0,73,227,5,68,243,15,85,13,12,76,37,22,74,254,15,130,138,33,0,4,65,111,6,137,79,65,107,16,32,1,77,200,6,34,128,128,3,75,154,
-    12,37,0,16,0,0,2,0,104,115,36,140,157,68,67,19,68,51,15,106,243,15,134,120,70,37,10,68,27,10,140,152,65,121,24,32,128,94,155,7,67,11,8,24,74,11,25,65,3,12,83,89,18,82,21,37,67,200,
-    5,130,144,24,64,172,12,33,4,0,134,162,74,80,14,145,184,32,0,130,0,69,251,20,32,19,81,243,5,82,143,8,33,5,53,89,203,5,133,112,79,109,15,33,0,21,130,71,80,175,41,36,75,0,79,0,83,121,
-    117,9,87,89,27,66,103,11,70,13,15,75,191,11,135,67,87,97,20,109,203,5,69,246,8,108,171,5,78,195,38,65,51,13,107,203,11,77,3,17,24,75,239,17,65,229,28,79,129,39,130,175,32,128,123,253,
-    7,132,142,24,65,51,15,65,239,41,36,128,128,0,0,13,65,171,5,66,163,28,136,183,118,137,11,80,255,15,67,65,7,74,111,8,32,0,130,157,32,253,24,76,35,10,103,212,5,81,175,9,69,141,7,66,150,
-    29,131,158,24,75,199,28,124,185,7,76,205,15,68,124,14,32,3,123,139,16,130,16,33,128,128,108,199,6,33,0,3,65,191,35,107,11,6,73,197,11,24,70,121,15,83,247,15,24,70,173,23,69,205,14,
-    32,253,131,140,32,254,136,4,94,198,9,32,3,78,4,13,66,127,13,143,13,32,0,130,0,33,16,0,24,69,59,39,109,147,12,76,253,19,24,69,207,15,69,229,15,130,195,71,90,10,139,10,130,152,73,43,
-    40,91,139,10,65,131,37,35,75,0,79,0,84,227,12,143,151,68,25,15,80,9,23,95,169,11,34,128,2,128,112,186,5,130,6,83,161,19,76,50,6,130,37,65,145,44,110,83,5,32,16,67,99,6,71,67,15,76,
-    55,17,140,215,67,97,23,76,69,15,77,237,11,104,211,23,77,238,11,65,154,43,33,0,10,83,15,28,83,13,20,67,145,19,67,141,14,97,149,21,68,9,15,86,251,5,66,207,5,66,27,37,82,1,23,127,71,12,
-    94,235,10,110,175,24,98,243,15,132,154,132,4,24,66,69,10,32,4,67,156,43,130,198,35,2,1,0,4,75,27,9,69,85,9,95,240,7,32,128,130,35,32,28,66,43,40,24,82,63,23,83,123,12,72,231,15,127,
-    59,23,116,23,19,117,71,7,24,77,99,15,67,111,15,71,101,8,36,2,128,128,252,128,127,60,11,32,1,132,16,130,18,141,24,67,107,9,32,3,68,194,15,175,15,38,0,11,0,128,1,128,2,80,63,25,32,0,
-    24,65,73,11,69,185,15,83,243,16,32,0,24,81,165,8,130,86,77,35,6,155,163,88,203,5,24,66,195,30,70,19,19,24,80,133,15,32,1,75,211,8,32,254,108,133,8,79,87,20,65,32,9,41,0,0,7,0,128,0,
-    0,2,128,2,68,87,15,66,1,16,92,201,16,24,76,24,17,133,17,34,128,0,30,66,127,64,34,115,0,119,73,205,9,66,43,11,109,143,15,24,79,203,11,90,143,15,131,15,155,31,65,185,15,86,87,11,35,128,
-    128,253,0,69,7,6,130,213,33,1,0,119,178,15,142,17,66,141,74,83,28,6,36,7,0,0,4,128,82,39,18,76,149,12,67,69,21,32,128,79,118,15,32,0,130,0,32,8,131,206,32,2,79,83,9,100,223,14,102,
-    113,23,115,115,7,24,65,231,12,130,162,32,4,68,182,19,130,102,93,143,8,69,107,29,24,77,255,12,143,197,72,51,7,76,195,15,132,139,85,49,15,130,152,131,18,71,81,23,70,14,11,36,0,10,0,128,
-    2,69,59,9,89,151,15,66,241,11,76,165,12,71,43,15,75,49,13,65,12,23,132,37,32,0,179,115,130,231,95,181,16,132,77,32,254,67,224,8,65,126,20,79,171,8,32,2,89,81,5,75,143,6,80,41,8,34,
-    2,0,128,24,81,72,9,32,0,130,0,35,17,0,0,255,77,99,39,95,65,36,67,109,15,24,69,93,11,77,239,5,95,77,23,35,128,1,0,128,24,86,7,8,132,167,32,2,69,198,41,130,202,33,0,26,120,75,44,24,89,
-    51,15,71,243,12,70,239,11,24,84,3,11,66,7,11,71,255,10,32,21,69,155,35,88,151,12,32,128,74,38,10,65,210,8,74,251,5,65,226,5,75,201,13,32,3,65,9,41,146,41,40,0,0,0,9,1,0,1,0,2,91,99,
-    19,32,35,106,119,13,70,219,15,83,239,12,137,154,32,2,67,252,19,36,128,0,0,4,1,130,196,32,2,130,8,91,107,8,32,0,135,81,24,73,211,8,132,161,73,164,13,36,0,8,0,128,2,105,123,26,139,67,
-    76,99,15,34,1,0,128,135,76,83,156,20,92,104,8,67,251,30,24,86,47,27,123,207,12,24,86,7,15,71,227,8,32,4,65,20,20,131,127,32,0,130,123,32,0,71,223,26,32,19,90,195,22,71,223,15,84,200,
-    6,32,128,133,241,24,84,149,9,67,41,25,36,0,0,0,22,0,88,111,49,32,87,66,21,5,77,3,27,123,75,7,71,143,19,135,183,71,183,19,130,171,74,252,5,131,5,89,87,17,32,1,132,18,130,232,68,11,10,
-    33,1,128,70,208,16,66,230,18,147,18,130,254,223,255,75,27,23,65,59,15,135,39,155,255,34,128,128,254,104,92,8,33,0,128,65,32,11,65,1,58,33,26,0,130,0,72,71,18,78,55,17,76,11,19,86,101,
-    12,75,223,11,89,15,11,24,76,87,15,75,235,15,131,15,72,95,7,85,71,11,72,115,11,73,64,6,34,1,128,128,66,215,9,34,128,254,128,134,14,33,128,255,67,102,5,32,0,130,16,70,38,11,66,26,57,
-    88,11,8,24,76,215,34,78,139,7,95,245,7,32,7,24,73,75,23,32,128,131,167,130,170,101,158,9,82,49,22,118,139,6,32,18,67,155,44,116,187,9,108,55,14,80,155,23,66,131,15,93,77,10,131,168,
-    32,128,73,211,12,24,75,187,22,32,4,96,71,20,67,108,19,132,19,120,207,8,32,5,76,79,15,66,111,21,66,95,8,32,3,190,211,111,3,8,211,212,32,20,65,167,44,34,75,0,79,97,59,13,32,33,112,63,
-    10,65,147,19,69,39,19,143,39,24,66,71,9,130,224,65,185,43,94,176,12,65,183,24,71,38,8,24,72,167,7,65,191,38,136,235,24,96,167,12,65,203,62,115,131,13,65,208,42,175,235,67,127,6,32,
-    4,76,171,29,114,187,5,32,71,65,211,5,65,203,68,72,51,8,164,219,32,0,172,214,71,239,58,78,3,27,66,143,15,77,19,15,147,31,35,33,53,51,21,66,183,10,173,245,66,170,30,150,30,34,0,0,23,
-    80,123,54,76,1,16,73,125,15,82,245,11,167,253,24,76,85,12,70,184,5,32,254,131,185,37,254,0,128,1,0,128,133,16,117,158,18,92,27,38,65,3,17,130,251,35,17,0,128,254,24,69,83,39,140,243,
-    121,73,19,109,167,7,81,41,15,24,95,175,12,102,227,15,121,96,11,24,95,189,7,32,3,145,171,154,17,24,77,47,9,33,0,5,70,71,37,68,135,7,32,29,117,171,11,69,87,15,24,79,97,19,24,79,149,23,
-    131,59,32,1,75,235,5,72,115,11,72,143,7,132,188,71,27,46,131,51,32,0,69,95,6,175,215,32,21,131,167,81,15,19,151,191,151,23,131,215,71,43,5,32,254,24,79,164,24,74,109,8,77,166,13,65,
-    176,26,88,162,5,98,159,6,171,219,120,247,6,79,29,8,99,169,10,103,59,19,65,209,35,131,35,91,25,19,112,94,15,83,36,8,173,229,33,20,0,88,75,43,71,31,12,65,191,71,33,1,0,130,203,32,254,
-    131,4,68,66,7,67,130,6,104,61,13,173,215,38,13,1,0,0,0,2,128,67,111,28,74,129,16,104,35,19,79,161,16,87,14,7,138,143,132,10,67,62,36,114,115,5,162,151,67,33,16,108,181,15,143,151,67,
-    5,5,24,100,242,15,170,153,34,0,0,14,65,51,34,32,55,79,75,9,32,51,74,7,10,65,57,38,132,142,32,254,72,0,14,139,163,32,128,80,254,8,67,158,21,65,63,7,32,4,72,227,27,95,155,12,67,119,19,
-    124,91,24,149,154,72,177,34,97,223,8,155,151,24,108,227,15,88,147,16,72,117,19,68,35,11,92,253,15,70,199,15,24,87,209,17,32,2,87,233,7,32,1,24,88,195,10,119,24,8,32,3,81,227,24,65,
-    125,21,35,128,128,0,25,76,59,48,24,90,187,9,97,235,12,66,61,11,91,105,19,24,79,141,11,24,79,117,15,24,79,129,27,90,53,13,130,13,32,253,131,228,24,79,133,40,69,70,8,66,137,31,65,33,
-    19,96,107,8,68,119,29,66,7,5,68,125,16,65,253,19,65,241,27,24,90,179,13,24,79,143,18,33,128,128,130,246,32,254,130,168,68,154,36,77,51,9,97,47,5,167,195,32,21,131,183,78,239,27,155,
-    195,78,231,14,201,196,77,11,6,32,5,73,111,37,97,247,12,77,19,31,155,207,78,215,19,162,212,69,17,14,66,91,19,80,143,57,78,203,39,159,215,32,128,93,134,8,24,80,109,24,66,113,15,169,215,
-    66,115,6,32,4,69,63,33,32,0,101,113,7,86,227,35,143,211,36,49,53,51,21,1,77,185,14,65,159,28,69,251,34,67,56,8,33,9,0,24,107,175,25,90,111,12,110,251,11,119,189,24,119,187,34,87,15,
-    9,32,4,66,231,37,90,39,7,66,239,8,84,219,15,69,105,23,24,85,27,27,87,31,11,33,1,128,76,94,6,32,1,85,241,7,33,128,128,106,48,10,33,128,128,69,136,11,133,13,24,79,116,49,84,236,8,24,
-    91,87,9,32,5,165,255,69,115,12,66,27,15,159,15,24,72,247,12,74,178,5,24,80,64,15,33,0,128,143,17,77,89,51,130,214,24,81,43,7,170,215,74,49,8,159,199,143,31,139,215,69,143,5,32,254,
-    24,81,50,35,181,217,84,123,70,143,195,159,15,65,187,16,66,123,7,65,175,15,65,193,29,68,207,39,79,27,5,70,131,6,32,4,68,211,33,33,67,0,83,143,14,159,207,143,31,140,223,33,0,128,24,80,
-    82,14,24,93,16,23,32,253,65,195,5,68,227,40,133,214,107,31,7,32,5,67,115,27,87,9,8,107,31,43,66,125,6,32,0,103,177,23,131,127,72,203,36,32,0,110,103,8,155,163,73,135,6,32,19,24,112,
-    99,10,65,71,11,73,143,19,143,31,126,195,5,24,85,21,9,24,76,47,14,32,254,24,93,77,36,68,207,11,39,25,0,0,255,128,3,128,4,66,51,37,95,247,13,82,255,24,76,39,19,147,221,66,85,27,24,118,
-    7,8,24,74,249,12,76,74,8,91,234,8,67,80,17,131,222,33,253,0,121,30,44,73,0,16,69,15,6,32,0,65,23,38,69,231,12,65,179,6,98,131,16,86,31,27,24,108,157,14,80,160,8,24,65,46,17,33,4,0,
-    96,2,18,144,191,65,226,8,68,19,5,171,199,80,9,15,180,199,67,89,5,32,255,24,79,173,28,174,201,24,79,179,50,32,1,24,122,5,10,82,61,10,180,209,83,19,8,32,128,24,80,129,27,111,248,43,131,
-    71,24,115,103,8,67,127,41,78,213,24,100,247,19,66,115,39,75,107,5,32,254,165,219,78,170,40,24,112,163,49,32,1,97,203,6,65,173,64,32,0,83,54,7,133,217,88,37,12,32,254,131,28,33,128,
-    3,67,71,44,84,183,6,32,5,69,223,33,96,7,7,123,137,16,192,211,24,112,14,9,32,255,67,88,29,68,14,10,84,197,38,33,0,22,116,47,50,32,87,106,99,9,116,49,15,89,225,15,97,231,23,70,41,19,
-    82,85,8,93,167,6,32,253,132,236,108,190,7,89,251,5,116,49,58,33,128,128,131,234,32,15,24,74,67,38,70,227,24,24,83,45,23,89,219,12,70,187,12,89,216,19,32,2,69,185,24,141,24,70,143,66,
-    24,82,119,56,78,24,10,32,253,133,149,132,6,24,106,233,7,69,198,48,178,203,81,243,12,68,211,15,106,255,23,66,91,15,69,193,7,100,39,10,24,83,72,16,176,204,33,19,0,88,207,45,68,21,12,
-    68,17,10,65,157,53,68,17,6,32,254,92,67,10,65,161,25,69,182,43,24,118,91,47,69,183,18,181,209,111,253,12,89,159,8,66,112,12,69,184,45,35,0,0,0,9,24,80,227,26,73,185,16,118,195,15,131,
-    15,33,1,0,65,59,15,66,39,27,160,111,66,205,12,148,111,143,110,33,128,128,156,112,24,81,199,8,75,199,23,66,117,20,155,121,32,254,68,126,12,72,213,29,134,239,149,123,89,27,16,148,117,
-    65,245,8,24,71,159,14,141,134,134,28,73,51,55,109,77,15,105,131,11,68,67,11,76,169,27,107,209,12,102,174,8,32,128,72,100,18,116,163,56,79,203,11,75,183,44,85,119,19,71,119,23,151,227,
-    32,1,93,27,8,65,122,5,77,102,8,110,120,20,66,23,8,66,175,17,66,63,12,133,12,79,35,8,74,235,33,67,149,16,69,243,15,78,57,15,69,235,16,67,177,7,151,192,130,23,67,84,29,141,192,174,187,
-    77,67,15,69,11,12,159,187,77,59,10,199,189,24,70,235,50,96,83,19,66,53,23,105,65,19,77,47,12,163,199,66,67,37,78,207,50,67,23,23,174,205,67,228,6,71,107,13,67,22,14,66,85,11,83,187,
-    38,124,47,49,95,7,19,66,83,23,67,23,19,24,96,78,17,80,101,16,71,98,40,33,0,7,88,131,22,24,89,245,12,84,45,12,102,213,5,123,12,9,32,2,126,21,14,43,255,0,128,128,0,0,20,0,128,255,128,
-    3,126,19,39,32,75,106,51,7,113,129,15,24,110,135,19,126,47,15,115,117,11,69,47,11,32,2,109,76,9,102,109,9,32,128,75,2,10,130,21,32,254,69,47,6,32,3,94,217,47,32,0,65,247,10,69,15,46,
-    65,235,31,65,243,15,101,139,10,66,174,14,65,247,16,72,102,28,69,17,14,84,243,9,165,191,88,47,48,66,53,12,32,128,71,108,6,203,193,32,17,75,187,42,73,65,16,65,133,52,114,123,9,167,199,
-    69,21,37,86,127,44,75,171,11,180,197,78,213,12,148,200,81,97,46,24,95,243,9,32,4,66,75,33,113,103,9,87,243,36,143,225,24,84,27,31,90,145,8,148,216,67,49,5,24,84,34,14,75,155,27,67,
-    52,13,140,13,36,0,20,0,128,255,24,135,99,46,88,59,43,155,249,80,165,7,136,144,71,161,23,32,253,132,33,32,254,88,87,44,136,84,35,128,0,0,21,81,103,5,94,47,44,76,51,12,143,197,151,15,
-    65,215,31,24,64,77,13,65,220,20,65,214,14,71,4,40,65,213,13,32,0,130,0,35,21,1,2,0,135,0,34,36,0,72,134,10,36,1,0,26,0,130,134,11,36,2,0,14,0,108,134,11,32,3,138,23,32,4,138,11,34,
-    5,0,20,134,33,34,0,0,6,132,23,32,1,134,15,32,18,130,25,133,11,37,1,0,13,0,49,0,133,11,36,2,0,7,0,38,134,11,36,3,0,17,0,45,134,11,32,4,138,35,36,5,0,10,0,62,134,23,32,6,132,23,36,3,
-    0,1,4,9,130,87,131,167,133,11,133,167,133,11,133,167,133,11,37,3,0,34,0,122,0,133,11,133,167,133,11,133,167,133,11,133,167,34,50,0,48,130,1,34,52,0,47,134,5,8,49,49,0,53,98,121,32,
-    84,114,105,115,116,97,110,32,71,114,105,109,109,101,114,82,101,103,117,108,97,114,84,84,88,32,80,114,111,103,103,121,67,108,101,97,110,84,84,50,48,48,52,47,130,2,53,49,53,0,98,0,121,
-    0,32,0,84,0,114,0,105,0,115,0,116,0,97,0,110,130,15,32,71,132,15,36,109,0,109,0,101,130,9,32,82,130,5,36,103,0,117,0,108,130,29,32,114,130,43,34,84,0,88,130,35,32,80,130,25,34,111,
-    0,103,130,1,34,121,0,67,130,27,32,101,132,59,32,84,130,31,33,0,0,65,155,9,34,20,0,0,65,11,6,130,8,135,2,33,1,1,130,9,8,120,1,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,
-    1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,
-    22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,130,187,8,66,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,
-    57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,130,243,9,75,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,
-    92,0,93,0,94,0,95,0,96,0,97,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,
-    63,1,64,1,65,0,172,0,163,0,132,0,133,0,189,0,150,0,232,0,134,0,142,0,139,0,157,0,169,0,164,0,239,0,138,0,218,0,131,0,147,0,242,0,243,0,141,0,151,0,136,0,195,0,222,0,241,0,158,0,170,
-    0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,
-    212,0,213,0,104,0,235,0,237,0,137,0,106,0,105,0,107,0,109,0,108,0,110,0,160,0,111,0,113,0,112,0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,0,184,0,
-    161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,14,117,110,105,99,111,100,101,35,48,120,48,48,48,49,141,14,32,50,141,14,32,51,141,14,32,52,141,14,32,53,141,14,32,54,141,14,32,55,141,
-    14,32,56,141,14,32,57,141,14,32,97,141,14,32,98,141,14,32,99,141,14,32,100,141,14,32,101,141,14,32,102,140,14,33,49,48,141,14,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,
-    141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,45,49,102,6,100,101,108,101,116,101,4,69,117,114,
-    111,140,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,
-    32,56,141,236,32,56,141,236,32,56,65,220,13,32,57,65,220,13,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,
-    239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,35,57,102,0,0,5,250,72,249,98,247,
+// Exported using binary_to_compressed_c.exe -u8 -lz4 "ProggyClean.ttf" proggy_clean_ttf
+static const unsigned int proggy_clean_ttf_compressed_size = 7599;
+static const unsigned char proggy_clean_ttf_compressed_data[7599] =
+{
+    76,90,52,0,0,0,160,248,241,34,0,1,0,0,0,12,0,128,0,3,0,64,79,83,47,50,136,235,116,144,0,0,1,72,0,0,0,78,99,109,97,112,2,18,35,117,0,0,3,160,0,0,1,82,99,118,116,32,0,1,0,240,66,4,252,
+    0,0,0,2,103,108,121,102,18,175,137,86,0,0,7,4,0,0,146,128,104,101,97,100,215,145,102,211,0,0,0,204,0,0,0,54,104,104,101,97,8,66,1,195,0,0,1,4,0,0,0,36,104,109,116,120,138,0,126,128,
+    0,0,1,152,0,0,2,6,108,111,99,97,140,115,176,216,0,0,5,79,0,241,50,4,109,97,120,112,1,174,0,218,0,0,1,40,0,0,0,32,110,97,109,101,37,89,187,150,0,0,153,132,0,0,1,158,112,111,115,116,
+    166,172,131,239,0,0,155,36,0,0,5,210,112,114,101,112,105,2,1,18,0,0,4,244,0,0,0,8,204,0,225,1,0,0,60,85,233,213,95,15,60,245,0,3,8,174,0,64,183,103,119,132,8,0,160,189,146,166,215,
+    0,0,254,128,3,128,112,0,66,0,3,0,2,206,0,0,52,0,129,4,192,254,64,0,0,3,128,25,0,17,128,74,0,8,1,0,16,2,18,0,99,1,1,0,144,0,36,16,0,162,8,0,64,0,10,0,0,0,118,0,101,0,80,0,3,128,1,144,
+    201,0,130,2,188,2,138,0,0,0,143,8,0,66,1,197,0,50,103,0,63,4,9,0,1,0,2,162,65,108,116,115,0,64,0,0,32,172,73,0,66,5,0,1,128,138,0,47,3,128,2,0,47,33,1,128,203,0,0,216,0,1,12,0,16,1,
+    12,0,1,2,0,6,10,0,10,2,0,34,1,128,46,0,24,0,8,0,29,128,54,0,10,26,0,2,98,0,4,104,0,3,4,0,63,0,0,1,64,0,4,3,148,0,12,86,0,26,0,132,0,48,3,128,0,194,0,31,0,172,0,0,3,28,0,26,3,212,0,
+    21,0,68,0,1,32,0,1,148,1,4,26,0,0,86,1,7,120,0,20,3,176,0,4,112,0,1,102,0,28,1,212,0,15,16,0,4,0,116,0,1,120,0,15,68,1,4,9,140,0,15,64,0,9,31,128,2,0,12,2,168,2,2,1,0,19,28,150,2,49,
+    76,0,3,10,0,81,28,0,4,0,48,248,2,17,8,202,2,113,127,0,255,32,172,255,255,36,0,17,129,10,0,88,1,0,1,223,213,204,2,63,1,6,0,1,0,201,31,129,39,0,19,131,177,0,1,141,184,1,255,133,15,0,
+    31,198,2,0,48,241,204,244,1,28,1,158,2,20,2,136,2,252,3,20,3,88,3,156,3,222,4,20,4,50,4,80,4,98,4,162,5,22,5,102,5,188,6,18,6,116,6,214,7,56,7,126,7,236,8,78,8,108,8,150,8,208,9,16,
+    9,74,9,136,10,22,10,128,11,4,11,86,11,200,12,46,12,130,12,234,13,94,13,164,13,234,14,80,14,150,15,40,15,176,16,18,16,116,16,224,17,82,17,182,18,4,18,110,18,196,19,76,19,172,19,246,
+    20,88,20,174,20,234,21,64,21,128,21,166,21,184,22,18,22,126,22,198,23,52,23,142,23,224,24,86,24,186,24,238,25,54,25,150,25,212,26,72,26,156,26,240,27,92,27,200,28,4,28,76,28,150,28,
+    234,29,42,29,146,29,210,30,64,30,142,30,224,31,36,31,118,31,166,31,166,32,16,32,16,32,46,32,138,32,178,32,200,33,20,33,116,33,152,33,238,34,98,34,134,35,12,35,12,35,128,2,0,240,206,
+    152,35,176,35,216,36,0,36,74,36,104,36,144,36,174,37,6,37,96,37,130,37,248,37,248,38,88,38,170,38,170,38,216,39,64,39,154,40,10,40,104,40,168,41,14,41,32,41,184,41,248,42,54,42,96,
+    42,96,43,2,43,42,43,94,43,172,43,230,44,32,44,52,44,154,45,40,45,92,45,120,45,170,45,232,46,38,46,166,47,38,47,182,47,244,48,94,48,200,49,62,49,180,50,30,50,158,51,30,51,130,51,238,
+    52,92,52,206,53,58,53,134,53,212,54,38,54,114,54,230,55,118,55,216,56,58,56,166,57,18,57,116,57,174,58,46,58,154,59,6,59,124,59,232,60,58,60,150,61,34,61,134,61,236,62,86,62,198,63,
+    42,63,154,64,18,64,106,64,208,65,54,65,162,66,8,66,64,66,122,66,184,66,240,67,98,67,204,68,42,68,138,68,238,69,88,69,182,69,226,70,84,70,180,71,20,71,122,71,218,72,84,72,198,73,64,
+    212,5,3,22,6,255,63,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,107,0,111,0,115,0,119,0,123,0,127,
+    0,131,0,135,0,139,0,143,0,0,17,53,51,21,49,4,0,4,95,5,53,51,21,33,8,0,68,15,116,0,5,18,128,1,0,79,252,128,128,2,6,0,46,2,1,0,47,4,128,1,0,65,32,0,7,140,5,60,2,0,4,140,1,111,0,1,53,
+    51,21,7,4,0,0,90,3,53,51,21,1,69,0,30,3,88,0,112,255,0,128,128,0,6,1,245,7,57,128,4,128,92,0,1,90,0,19,51,64,1,8,8,0,116,1,0,128,128,128,254,128,5,0,43,4,0,171,0,34,0,24,248,7,31,4,
+    56,2,31,15,116,0,2,15,44,2,5,15,40,0,33,21,1,183,0,19,253,175,0,31,253,18,0,8,31,3,175,1,38,143,0,21,0,128,255,128,3,0,4,1,26,1,254,0,31,5,234,0,24,15,6,1,13,18,5,242,0,0,229,1,8,215,
+    0,1,16,0,42,255,0,248,0,47,255,0,239,0,34,0,235,1,31,20,240,1,30,39,0,19,156,3,27,51,198,0,8,12,0,31,7,28,0,8,23,51,228,3,118,128,128,1,128,128,253,0,192,1,52,128,128,254,152,2,25,
+    254,23,0,16,253,215,8,15,235,0,31,2,232,0,31,128,232,0,29,31,1,220,4,8,27,49,20,0,31,51,188,4,12,4,124,3,80,254,128,128,1,0,214,0,0,6,0,17,128,13,0,0,213,0,21,0,221,0,17,253,14,1,3,
+    247,0,15,234,0,32,48,3,1,128,5,12,5,16,4,9,100,4,3,84,4,6,246,3,110,0,0,11,1,0,255,64,4,6,24,1,5,216,2,23,7,8,0,7,4,0,39,29,1,8,0,39,2,0,160,2,6,1,0,12,102,4,15,184,0,1,15,136,0,17,
+    9,108,0,12,52,5,8,164,0,45,1,0,41,5,0,5,0,15,136,0,18,1,74,11,0,161,10,15,16,1,12,31,51,212,3,8,22,51,192,3,23,254,200,2,3,214,1,17,254,117,6,15,132,0,8,31,9,132,0,8,5,208,1,31,5,50,
+    5,4,25,7,42,5,3,7,0,15,112,0,5,48,0,0,4,179,1,1,82,13,4,108,0,43,0,37,86,1,3,78,1,11,213,1,1,215,13,18,128,110,2,7,168,0,1,30,4,15,170,7,3,8,210,6,33,0,2,217,14,4,120,0,5,116,0,7,186,
+    1,51,0,0,10,136,5,15,20,2,3,9,10,1,15,8,0,9,26,2,56,5,6,5,0,15,16,2,12,3,52,4,31,0,52,4,33,15,56,4,5,15,8,5,9,15,56,4,1,2,176,7,7,26,4,41,253,128,17,5,27,128,52,4,15,28,5,34,31,14,
+    232,0,18,9,226,6,8,228,5,12,134,3,12,254,1,3,198,6,24,254,119,0,47,254,128,225,4,23,47,0,15,136,1,20,15,126,1,2,4,150,0,8,4,0,31,7,166,0,1,6,106,1,1,176,0,5,3,0,15,170,0,24,15,172,
+    0,53,23,49,228,4,15,22,2,12,5,75,1,15,5,2,31,47,0,17,20,7,24,15,254,1,2,15,174,11,21,7,138,3,5,10,2,2,4,7,9,213,2,2,110,1,31,3,189,2,26,31,18,164,3,26,15,158,4,2,8,214,6,7,24,0,15,
+    130,1,10,9,134,3,15,129,1,37,4,197,0,31,17,196,0,24,9,150,8,15,204,2,1,15,74,13,17,18,1,55,2,4,221,2,11,96,4,15,198,0,32,2,112,21,15,196,0,11,15,124,1,2,15,184,5,9,12,191,7,15,32,2,
+    21,47,0,19,184,5,28,15,182,5,14,15,92,1,26,12,178,5,47,254,0,99,1,50,3,240,2,15,44,2,34,31,49,98,15,24,8,48,5,15,130,6,5,6,162,10,0,147,1,31,254,44,2,29,18,4,16,15,7,224,8,5,204,7,
+    26,3,170,10,5,186,8,3,229,4,50,0,0,6,176,8,11,28,9,13,64,0,15,10,10,0,43,255,0,77,0,5,84,1,0,244,22,15,244,9,7,9,114,3,27,49,162,5,7,8,0,0,254,10,1,23,1,4,27,1,31,2,200,1,9,16,12,255,
+    4,79,3,128,2,128,48,3,27,1,146,1,15,16,17,11,3,74,13,61,128,2,0,4,11,10,92,9,1,110,22,15,244,0,4,31,19,228,0,4,11,4,1,23,21,167,13,0,4,0,15,243,0,10,1,116,0,15,188,2,7,15,190,7,14,
+    5,26,17,14,170,7,15,162,7,10,1,40,17,31,26,216,16,38,0,16,19,15,74,3,10,31,49,212,9,0,15,16,0,5,26,33,72,0,47,29,1,134,8,7,4,24,14,6,159,18,8,9,0,2,51,14,47,128,128,235,16,42,9,68,
+    7,15,28,1,21,15,16,3,2,15,82,4,9,15,122,4,5,37,1,128,15,8,6,20,15,4,239,16,17,2,25,15,5,6,0,15,82,7,28,0,200,18,31,128,200,18,37,31,19,192,0,16,31,49,118,7,32,9,168,3,15,212,11,3,11,
+    246,0,47,253,0,224,1,43,5,220,11,31,128,220,11,17,15,204,0,1,12,234,15,15,74,8,1,6,176,2,21,128,233,13,15,222,6,23,15,156,17,35,31,19,128,22,48,15,148,1,7,14,135,1,2,6,0,5,172,1,15,
+    103,13,31,15,148,8,30,15,170,10,24,13,152,17,15,26,6,3,6,174,10,47,254,0,90,22,11,15,176,1,12,15,228,12,22,15,196,0,41,15,180,0,6,31,3,216,4,77,15,4,3,5,31,33,20,4,20,14,20,3,4,224,
+    19,47,2,0,38,12,40,15,40,3,38,31,33,170,13,28,15,56,3,9,15,163,4,5,15,48,3,3,47,2,0,145,16,34,16,12,28,18,31,2,232,0,9,13,172,1,31,7,140,16,12,29,1,151,20,15,76,12,20,1,216,12,15,140,
+    0,23,31,7,140,0,21,9,13,17,15,139,0,19,15,176,15,27,15,250,1,9,31,51,216,12,20,25,128,248,4,4,159,7,4,63,26,3,181,7,4,50,5,15,184,15,27,15,48,14,20,31,7,4,0,8,15,0,11,4,15,55,27,13,
+    14,88,3,15,28,10,44,23,17,16,24,27,49,32,24,31,49,24,10,24,31,33,12,0,4,9,40,25,1,5,10,31,1,22,10,8,41,1,0,9,0,5,229,28,15,37,10,44,15,80,9,48,15,60,25,1,31,51,12,0,4,12,84,25,12,64,
+    11,8,12,0,21,128,65,26,4,114,5,2,86,25,13,94,25,6,102,25,4,7,0,15,90,9,39,31,16,16,1,22,15,72,26,10,15,164,8,17,21,1,111,3,15,155,8,6,20,128,80,26,31,3,80,6,25,15,76,16,26,31,19,242,
+    10,36,28,5,212,7,14,76,16,24,253,225,7,15,71,4,27,0,228,7,47,255,128,188,12,35,15,140,1,33,23,51,160,16,15,148,1,21,15,101,9,31,15,20,11,79,15,40,0,17,15,174,1,13,15,0,6,39,3,230,0,
+    15,160,9,40,11,184,0,12,168,16,47,29,1,240,0,8,26,1,100,14,8,191,8,15,172,1,31,2,64,25,15,64,6,17,15,64,35,14,15,232,6,5,15,181,11,1,15,93,13,22,15,100,1,28,31,19,168,35,52,15,68,13,
+    7,14,39,3,15,115,1,30,15,112,1,24,15,180,0,13,12,130,33,1,112,1,5,52,7,13,147,31,31,254,166,24,27,31,0,80,35,42,31,17,20,8,8,31,33,88,8,20,4,180,4,15,232,3,1,3,232,0,14,52,8,11,88,
+    8,6,155,33,5,13,1,15,56,7,82,15,188,12,13,31,5,190,10,20,9,141,5,6,113,18,8,185,5,15,55,7,23,31,12,208,1,14,15,120,2,10,31,51,234,14,1,11,112,2,25,254,172,12,31,3,228,3,66,31,49,140,
+    25,8,15,46,29,17,9,112,11,8,46,29,6,100,13,15,212,3,27,31,15,0,34,12,15,56,29,6,31,7,4,0,16,10,94,21,15,130,0,3,15,29,34,15,5,172,0,15,152,32,12,31,19,26,35,0,15,8,0,0,31,21,130,0,
+    28,31,0,36,1,35,15,32,1,17,15,158,14,10,7,52,25,15,36,1,27,31,1,188,33,20,31,51,82,30,8,4,228,23,7,53,30,4,132,4,15,141,0,8,32,0,0,84,34,18,255,18,47,11,116,41,31,21,82,42,15,12,78,
+    0,17,2,170,25,4,204,0,5,138,36,0,42,1,3,133,0,19,0,216,4,15,56,36,7,15,16,12,0,8,168,8,15,112,22,25,2,162,1,5,42,23,11,147,27,31,2,184,8,23,4,148,20,31,128,148,20,25,31,7,192,19,8,
+    15,114,21,30,31,128,100,10,7,5,106,10,15,117,2,23,11,140,30,31,3,64,18,24,15,236,19,1,15,214,29,7,8,229,22,31,2,104,1,64,31,1,82,35,8,15,104,1,29,24,2,62,10,15,100,1,2,5,59,2,15,106,
+    1,31,15,248,2,37,15,76,25,14,15,132,1,19,31,253,137,1,24,13,20,25,15,144,1,13,15,106,6,2,31,5,184,11,16,4,0,22,4,197,7,31,254,101,6,29,0,88,1,16,21,175,8,15,88,1,18,11,132,44,15,44,
+    2,41,15,16,6,7,15,57,2,11,5,241,0,31,2,92,18,34,31,17,32,3,24,15,132,4,46,31,33,124,4,22,31,1,18,3,27,49,0,0,8,184,22,15,200,0,1,1,154,1,31,1,146,7,8,28,1,162,31,47,4,0,170,8,4,2,60,
+    21,15,8,8,12,15,112,0,14,12,230,1,44,2,0,224,41,2,209,1,15,135,0,6,8,145,0,31,16,192,1,22,13,190,1,15,154,22,29,7,99,28,15,146,22,9,15,169,8,24,0,152,32,15,184,1,6,9,152,32,15,70,9,
+    13,15,58,9,1,15,137,0,11,6,128,47,15,232,3,24,9,72,16,12,220,13,31,33,12,0,32,6,92,47,13,10,14,15,9,0,5,31,2,136,30,36,15,208,4,13,15,216,29,38,15,204,3,16,31,2,168,0,57,31,1,102,5,
+    36,15,78,37,4,31,253,199,6,26,3,84,8,15,32,6,26,15,90,1,34,15,200,21,31,12,206,21,31,2,40,31,32,15,216,0,27,15,244,6,53,31,7,236,6,24,15,216,0,32,31,10,88,2,10,1,158,1,31,51,64,26,
+    0,15,22,31,2,0,137,0,38,1,0,28,31,15,141,0,8,47,0,13,208,2,16,15,68,1,1,8,74,21,15,166,12,2,5,44,1,6,7,0,31,2,185,2,16,16,13,108,5,15,116,24,12,9,0,11,15,110,9,8,9,62,37,47,1,0,222,
+    32,1,15,133,16,16,15,156,4,26,15,12,21,35,31,1,85,2,13,15,245,3,19,15,68,2,16,15,224,20,18,15,213,20,6,31,2,108,25,13,15,172,6,25,15,192,20,34,15,212,6,1,15,168,20,12,9,159,20,15,152,
+    3,24,15,80,1,26,27,51,4,12,13,192,54,26,254,165,44,2,29,5,31,2,196,5,64,31,33,216,11,52,15,150,2,16,15,215,11,38,15,240,7,39,15,136,20,5,15,170,17,5,12,120,20,31,2,240,3,20,31,255,
+    0,14,24,31,5,56,11,3,12,134,54,10,8,44,11,233,50,15,100,20,27,16,0,16,55,0,228,11,31,0,152,55,11,31,7,4,0,20,31,1,243,20,37,15,44,1,22,31,19,20,1,12,15,68,1,4,31,21,20,52,0,2,9,0,15,
+    43,1,24,0,174,68,47,1,128,76,45,2,9,96,2,31,33,132,43,0,3,158,37,4,81,43,47,2,0,97,0,1,2,192,17,0,78,20,15,80,48,44,12,204,6,15,220,17,9,15,78,38,6,23,254,88,16,5,75,38,31,0,184,17,
+    29,17,4,76,22,31,0,248,55,10,31,128,248,55,4,31,16,20,2,18,13,252,32,15,64,17,21,8,40,0,5,76,3,13,75,17,15,39,2,27,1,186,0,104,6,1,0,255,128,2,236,56,1,60,48,31,37,44,63,19,14,69,1,
+    18,3,228,4,21,0,108,59,8,206,6,12,248,8,15,36,15,16,15,220,57,18,15,110,18,3,15,109,4,36,15,124,17,28,15,160,0,13,15,184,0,17,11,176,0,12,186,0,15,114,17,27,1,132,58,28,3,192,0,9,164,
+    59,7,74,24,7,154,7,10,103,0,15,40,45,27,12,96,9,8,180,52,31,51,184,36,4,26,2,225,46,6,85,3,7,152,36,31,3,28,20,24,0,172,0,31,5,28,20,30,31,51,120,4,15,15,74,33,31,5,125,7,15,82,33,
+    7,15,88,67,34,1,220,1,0,69,0,9,68,8,5,130,1,23,5,156,12,22,1,134,0,31,2,12,48,2,31,0,188,38,45,31,51,98,14,16,15,120,35,21,31,51,196,68,2,8,3,49,7,178,38,8,20,0,15,77,36,35,10,13,1,
+    15,60,2,62,15,62,30,37,4,60,2,31,254,71,30,12,15,60,2,36,2,8,65,29,128,8,65,4,48,2,11,7,65,33,0,3,72,69,15,56,65,0,23,5,134,28,7,50,0,1,120,69,13,56,5,15,120,69,16,15,122,62,2,1,216,
+    54,15,200,69,36,15,80,0,3,31,13,200,64,12,5,112,6,12,110,21,15,192,5,1,15,148,68,1,4,205,64,25,0,91,55,15,172,5,13,15,48,64,38,19,7,228,9,13,208,29,31,17,208,29,15,31,1,0,9,1,3,112,
+    1,11,132,56,14,100,1,11,237,35,2,244,26,0,190,56,15,196,34,18,15,172,21,1,31,49,52,4,8,12,60,6,14,38,6,9,8,0,31,3,116,35,24,15,176,9,22,5,190,66,15,22,18,37,8,18,6,6,7,0,5,164,2,47,
+    255,0,44,2,19,14,252,5,27,19,122,0,19,5,34,1,2,113,0,13,251,5,31,21,92,23,30,30,83,242,5,15,190,16,1,15,112,20,9,15,234,5,1,15,98,23,2,11,247,5,4,180,44,15,69,27,32,8,204,43,15,200,
+    9,22,15,230,1,5,15,130,15,21,13,192,5,12,188,5,15,240,1,23,2,176,4,2,164,7,15,32,11,14,19,51,180,0,15,98,37,21,4,41,57,15,101,37,8,2,170,0,31,255,171,25,13,15,200,75,11,31,3,124,15,
+    19,31,3,106,0,3,3,200,44,31,0,100,14,20,15,186,5,2,31,51,44,6,4,15,174,70,9,11,206,5,6,104,74,8,184,70,0,95,74,31,0,24,32,35,15,32,47,29,15,36,14,9,15,186,67,6,30,128,36,14,15,184,
+    67,29,9,140,27,31,128,140,27,27,15,20,58,49,8,236,20,15,112,41,0,10,40,58,1,235,4,31,3,173,33,31,31,16,8,11,22,15,196,40,18,15,238,13,9,15,111,3,5,8,239,13,15,172,48,26,31,10,16,19,
+    10,15,14,19,2,31,3,10,19,21,12,62,9,12,160,3,23,0,104,68,31,128,76,56,42,9,16,19,27,51,76,20,15,48,28,15,8,98,22,7,169,21,15,184,35,27,16,0,208,38,22,4,108,10,6,86,5,6,76,0,0,138,85,
+    15,20,53,41,0,64,82,15,254,57,6,15,60,63,9,15,12,52,5,31,49,32,40,0,15,230,58,4,22,0,48,24,4,198,44,25,1,8,0,5,25,0,6,108,3,15,29,53,42,1,49,1,16,11,164,1,15,40,56,8,47,0,1,242,39,
+    4,15,246,1,7,7,103,49,15,164,0,13,4,208,65,15,196,66,10,15,28,6,9,10,100,81,45,0,128,209,24,15,218,65,9,18,7,36,57,14,156,11,31,19,108,29,8,7,66,0,15,149,3,0,47,0,30,128,2,46,0,192,
+    84,15,132,2,14,31,51,144,54,0,12,72,7,15,32,0,9,15,140,2,20,5,102,22,8,91,47,11,18,0,15,142,2,56,6,4,43,31,4,4,86,1,15,52,13,17,31,4,104,23,2,63,128,2,128,120,36,2,15,44,81,14,15,252,
+    80,1,15,183,4,2,7,144,76,31,3,160,25,16,15,10,79,14,15,48,8,4,9,137,6,4,141,76,31,0,64,68,7,8,200,31,31,2,124,37,7,8,112,2,9,166,12,15,254,42,2,8,47,11,15,196,5,7,31,0,116,0,33,15,
+    106,4,1,7,241,0,15,54,6,11,1,14,94,2,82,25,8,36,6,21,5,40,38,5,246,44,0,120,12,47,0,255,100,13,21,15,192,28,18,31,49,158,3,0,8,114,8,15,184,28,7,8,20,33,47,253,0,149,16,17,13,8,60,
+    15,76,56,25,15,36,70,10,15,62,17,1,31,51,16,0,8,15,156,5,17,9,152,16,15,50,85,3,31,254,5,0,5,31,3,76,4,45,16,9,220,93,31,2,176,72,3,13,238,8,15,12,0,1,11,78,25,31,2,126,2,2,1,28,74,
+    16,254,102,0,7,152,17,27,5,150,14,31,1,165,9,0,1,156,4,15,124,41,8,31,5,226,42,11,22,255,206,74,15,25,3,5,31,0,136,3,14,31,1,248,11,20,13,12,5,15,18,5,11,6,64,36,31,128,64,36,15,15,
+    60,2,13,28,128,166,32,15,226,31,14,79,0,0,0,22,52,22,32,30,87,44,25,31,33,60,25,8,12,242,3,27,5,48,19,8,88,1,24,2,250,3,14,88,25,8,70,72,5,120,17,15,220,91,38,31,0,0,1,79,15,186,38,
+    21,7,210,47,15,0,1,6,8,151,39,25,0,33,0,15,2,1,40,3,32,65,31,5,24,5,40,15,218,5,1,31,5,8,5,0,31,5,236,11,4,15,24,2,21,25,0,115,79,3,109,4,47,254,0,27,2,66,12,220,39,15,216,76,9,31,
+    3,204,76,0,15,234,31,2,6,62,21,8,39,70,15,156,18,6,4,252,55,31,5,68,61,23,24,29,28,46,15,188,75,81,31,4,7,20,22,10,208,56,15,212,0,24,1,152,0,31,3,212,0,44,5,4,47,15,213,0,65,31,20,
+    68,4,30,13,80,6,15,180,1,49,21,254,9,59,15,229,0,24,15,190,1,27,31,0,236,0,37,9,228,8,15,236,0,48,6,195,14,15,236,0,72,4,124,59,15,24,18,24,15,204,1,50,31,0,200,1,26,31,0,215,0,26,
+    15,240,6,40,31,49,176,61,12,15,184,2,44,31,0,190,2,36,15,240,6,27,31,23,124,16,36,15,140,46,2,15,222,58,1,31,49,254,0,24,10,30,6,7,161,23,2,214,7,31,253,44,22,4,15,243,11,38,2,76,26,
+    47,254,128,24,90,25,15,58,80,33,28,5,210,11,15,70,80,5,4,175,10,15,67,69,30,4,192,93,15,136,4,28,9,32,7,15,186,78,29,15,38,27,1,24,254,6,29,11,161,46,15,71,6,28,2,218,0,15,216,0,35,
+    15,238,27,6,15,216,0,33,2,44,7,15,218,0,62,4,160,34,47,0,5,124,101,34,31,51,186,1,57,15,26,27,0,15,228,0,4,15,192,1,36,47,4,128,32,7,31,15,152,2,57,15,219,0,11,31,0,216,0,31,1,220,
+    49,31,2,56,6,11,15,98,3,2,31,5,148,64,13,13,215,27,4,171,15,15,127,1,17,15,152,0,22,13,34,3,31,5,54,57,18,12,243,100,15,154,0,24,63,0,0,14,156,0,16,31,55,226,2,7,15,58,1,16,47,255,
+    0,62,1,12,15,64,1,21,15,156,31,23,15,158,0,22,15,155,0,7,15,147,31,17,31,21,176,29,30,31,83,222,87,31,15,62,86,34,5,225,23,15,59,86,0,31,0,146,7,30,31,25,144,9,34,2,128,15,15,90,11,
+    6,15,130,79,57,10,54,26,15,134,79,30,15,123,11,32,12,144,46,15,32,1,20,15,0,15,18,15,140,79,13,15,67,72,3,12,105,72,15,0,7,24,31,0,196,0,30,15,240,14,14,15,196,0,9,11,232,14,15,197,
+    0,55,15,184,15,32,15,224,14,21,15,32,81,19,31,254,213,0,25,15,217,0,23,15,216,0,32,15,204,14,21,15,216,0,13,12,196,14,15,216,0,58,31,16,188,14,22,15,184,14,18,15,244,22,12,15,160,1,
+    23,31,0,116,2,24,15,44,107,10,31,19,182,34,4,15,190,55,6,15,188,55,16,6,16,22,31,4,32,15,36,15,232,72,1,15,106,5,1,15,154,5,9,8,8,21,5,26,14,5,242,21,9,105,5,10,137,5,7,38,27,31,3,
+    16,23,37,15,116,20,40,15,84,80,41,1,232,3,15,83,80,22,31,4,204,17,38,15,120,20,29,15,216,0,45,5,76,13,15,218,0,69,15,124,20,52,15,188,1,46,15,48,85,11,15,232,0,5,15,60,22,34,15,144,
+    19,33,15,224,0,42,31,0,220,0,28,15,146,19,27,5,32,43,15,196,12,23,15,32,43,21,3,126,2,31,0,33,43,10,15,205,12,19,15,244,41,24,31,19,194,71,24,15,96,40,2,15,192,71,4,31,128,92,95,29,
+    0,87,1,18,25,44,78,15,144,15,24,11,96,11,31,49,226,20,44,15,26,42,13,15,6,112,4,15,176,98,8,3,221,26,15,210,75,29,15,92,26,1,15,244,40,25,12,218,15,15,224,78,35,5,147,35,15,228,78,
+    5,47,4,0,22,4,25,15,188,41,33,31,5,200,0,48,7,30,16,15,202,0,53,15,76,78,36,15,58,16,0,15,154,1,37,6,78,16,15,212,0,13,15,214,0,23,15,16,19,40,15,218,0,56,8,14,67,15,220,0,15,15,180,
+    1,25,15,164,112,28,31,1,212,0,53,15,207,0,15,31,3,168,1,33,15,120,22,33,31,51,84,3,52,22,1,16,24,15,89,3,12,31,128,62,8,30,47,0,22,48,52,32,31,87,50,52,7,15,100,101,21,15,68,42,11,
+    22,254,192,11,15,50,52,55,2,248,6,31,15,128,68,20,15,46,83,30,13,140,121,15,58,83,2,31,255,59,56,20,15,144,6,56,15,120,82,38,31,255,124,82,11,15,199,5,30,15,148,6,37,31,3,204,0,45,
+    5,165,0,15,205,0,56,15,148,6,53,15,210,0,42,31,254,213,0,18,15,164,1,34,15,184,5,39,15,232,84,40,15,207,0,11,31,3,204,0,29,31,9,228,80,8,13,42,3,15,222,80,5,14,163,82,15,133,0,5,15,
+    112,0,14,9,206,2,15,18,83,18,15,113,0,12,5,200,81,15,160,41,10,12,118,2,15,122,0,9,31,254,37,52,3,15,240,0,9,31,128,240,0,7,31,51,96,1,16,15,115,0,2,31,254,52,9,57,31,49,10,19,0,15,
+    102,88,29,10,114,77,6,241,57,15,99,88,5,15,164,52,32,8,204,15,15,36,5,26,31,51,10,30,8,15,220,15,21,6,28,29,31,254,99,14,1,15,35,86,7,15,233,58,17,15,140,61,27,15,192,6,10,15,160,1,
+    17,31,255,112,82,14,15,238,5,23,15,72,62,29,31,5,188,0,40,7,60,13,15,190,0,53,15,36,61,32,15,164,6,13,15,104,123,16,15,188,94,3,15,31,3,7,15,202,0,17,15,24,3,56,15,206,0,28,8,24,3,
+    15,208,0,19,15,156,1,21,15,48,60,28,31,51,24,3,44,15,195,0,16,15,99,7,22,1,0,55,15,72,11,1,31,0,74,36,5,26,1,28,132,2,193,11,8,106,0,1,179,120,0,228,5,15,20,62,24,9,112,13,15,104,66,
+    1,15,128,130,9,31,49,198,11,4,23,2,192,124,31,0,126,130,0,6,131,89,31,0,218,30,31,8,40,62,15,16,5,28,15,164,21,36,3,52,77,15,7,95,18,15,184,2,27,15,20,5,28,15,68,23,36,2,20,5,15,194,
+    0,57,15,20,5,42,15,198,0,39,15,86,7,13,15,74,18,31,15,68,4,39,15,76,2,37,15,195,0,18,15,70,4,23,5,244,95,15,136,22,26,15,86,2,46,15,216,36,7,31,254,35,84,25,15,53,14,27,9,200,10,31,
+    255,100,135,28,31,19,130,100,52,15,76,24,13,15,88,24,42,8,217,1,4,216,1,15,116,75,34,15,216,1,57,15,182,2,22,11,240,0,31,255,25,100,32,52,0,21,1,140,152,85,0,0,36,0,72,152,152,53,26,
+    0,130,130,152,51,14,0,108,12,0,23,3,24,0,23,4,12,0,18,5,150,67,1,1,0,17,6,24,0,4,252,149,51,18,0,20,12,0,83,1,0,13,0,49,12,0,83,2,0,7,0,38,12,0,83,3,0,17,0,45,12,0,23,4,36,0,83,5,0,
+    10,0,62,12,0,17,6,24,0,49,3,0,1,204,152,0,168,0,2,12,0,2,168,0,2,12,0,2,168,0,2,12,0,83,3,0,34,0,122,12,0,23,4,36,0,2,168,0,2,12,0,2,168,0,147,50,0,48,0,48,0,52,0,47,6,0,241,64,49,
+    0,53,98,121,32,84,114,105,115,116,97,110,32,71,114,105,109,109,101,114,82,101,103,117,108,97,114,84,84,88,32,80,114,111,103,103,121,67,108,101,97,110,84,84,50,48,48,52,47,48,52,47,
+    49,53,0,98,0,121,0,32,0,84,0,114,0,105,0,115,0,116,0,97,0,110,0,32,0,71,16,0,241,32,109,0,109,0,101,0,114,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,84,0,84,0,88,0,32,0,80,0,114,0,111,
+    0,103,0,103,0,121,0,67,0,108,0,101,60,0,0,30,0,21,0,40,154,2,246,68,12,28,154,0,24,154,0,5,0,241,46,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,
+    1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,215,3,241,68,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,
+    0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,82,1,250,255,100,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,
+    0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,0,96,0,97,
+    1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,0,172,0,163,0,132,
+    0,133,0,189,0,150,0,232,0,134,0,142,0,139,0,157,0,169,0,164,0,239,0,138,0,218,0,131,0,147,0,242,0,243,0,141,0,151,0,136,0,195,0,222,0,241,0,158,0,170,0,245,0,244,0,246,0,162,0,173,
+    0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,212,0,213,0,104,0,235,0,237,0,
+    137,0,106,0,105,0,107,0,109,0,108,0,110,0,160,0,111,0,113,0,112,0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,0,184,0,161,0,127,0,126,0,128,0,129,0,
+    236,0,238,0,186,14,117,110,105,99,111,100,101,35,48,120,48,48,48,49,15,0,26,50,15,0,26,51,15,0,26,52,15,0,26,53,15,0,26,54,15,0,26,55,15,0,26,56,15,0,26,57,15,0,26,97,15,0,26,98,15,
+    0,26,99,15,0,26,100,15,0,26,101,15,0,25,102,15,0,42,49,48,15,0,10,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,
+    26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,233,49,102,6,100,101,108,101,116,101,4,69,117,114,111,27,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,
+    56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,221,1,26,57,221,1,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,
+    57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,25,57,240,0,80,48,57,102,0,0,
 };
 
 static const char* GetDefaultCompressedFontDataTTF(int* out_size)
@@ -69,9 +69,16 @@ Index of this file:
 #endif
 #endif
 // Emscripten has partial SSE 4.2 support where _mm_crc32_u32 is not available. See https://emscripten.org/docs/porting/simd.html#id11 and #8213
-#if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(__EMSCRIPTEN__)
+#if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(IMGUI_USE_FAST_HASH) && !defined(__EMSCRIPTEN__)
 #define IMGUI_ENABLE_SSE4_2_CRC
 #endif
+// Enable atomic intrinsics if available (used by lock-free queues)
+#if defined(_MSC_VER) && !defined(__clang__)
+#define IMGUI_ENABLE_ATOMICS
+#include <intrin.h>
+#elif defined(__GNUC__) || defined(__clang__)
+#define IMGUI_ENABLE_ATOMICS
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -140,10 +147,15 @@ struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
 
 // ImDrawList/ImFontAtlas
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
+struct ImDrawDataDamageEntry;       // Draw list rendered by previous frame, to compute ImDrawData::DamageRects[]
+struct ImGuiDrawDataBuffer;         // Draw data published by Render() for a render thread, see io.ConfigDrawDataBuffers
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
 struct ImFontAtlasBuilder;          // Internal storage for incrementally packing and building a ImFontAtlas
 struct ImFontAtlasPostProcessData;  // Data available to potential texture post-processing functions
 struct ImFontAtlasRectEntry;        // Packed rectangle lookup entry
+struct ImFontAtlasPreloadRequest;   // Pending request submitted by ImFontAtlas::AddPreloadRequest()
+struct ImFontAtlasDeferredTexChange;// Texture change waiting to be applied by a context running on another thread
+struct ImFontAtlasBoundBaked;       // ImFontBaked currently bound by a context sharing the atlas
 
 // ImGui
 struct ImGuiBoxSelectState;         // Box-selection state (currently used by multi-selection, could potentially be used by others)
@@ -184,6 +196,7 @@ struct ImGuiTreeNodeStackData;      // Temporary storage for TreeNode().
 struct ImGuiTypingSelectState;      // Storage for GetTypingSelectRequest()
 struct ImGuiTypingSelectRequest;    // Storage for GetTypingSelectRequest() (aimed to be public)
 struct ImGuiWindow;                 // Storage for one window
+struct ImGuiWindowHitGrid;          // Uniform grid over windows hit-test rectangles, used by FindHoveredWindowEx()
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame, in practice we currently keep it for each window)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
 
@@ -221,8 +234,14 @@ typedef ImU16 ImGuiTableDrawChannelIdx;
 // See implementation of this variable in imgui.cpp for comments and details.
 //-----------------------------------------------------------------------------
 
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+#define IM_THREAD_LOCAL     thread_local    // Also used by the few remaining static variables which are written to
+#else
+#define IM_THREAD_LOCAL
+#endif
+
 #ifndef GImGui
-extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
+extern IMGUI_API IM_THREAD_LOCAL ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
 
 //-----------------------------------------------------------------------------
@@ -263,6 +282,22 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #define IM_ASSERT_PARANOID(_EXPR)
 #endif
 
+// Profiler Zones (when IMGUI_ENABLE_PROFILER is defined, see imconfig.h)
+// - IMGUI_PROFILER_ZONE() records a zone until the end of the current C++ scope (one per scope). _NAME must be a literal or a persistent string (it is not copied).
+// - IMGUI_PROFILER_ZONE_BEGIN()/IMGUI_PROFILER_ZONE_END() are for zones which can't be expressed as a C++ scope. Calls must be balanced.
+// - Optional _ID is stored with the zone, e.g. window ID for "Window" zones. Recorded zones are displayed in 'Metrics->Profiler'.
+#ifdef IMGUI_ENABLE_PROFILER
+#define IMGUI_PROFILER_ZONE(_NAME)              ImGuiProfilerZoneScope profiler_zone(_NAME, 0)
+#define IMGUI_PROFILER_ZONE_ID(_NAME,_ID)       ImGuiProfilerZoneScope profiler_zone(_NAME, _ID)
+#define IMGUI_PROFILER_ZONE_BEGIN(_NAME,_ID)    ImGui::ProfilerZoneBegin(_NAME, _ID)
+#define IMGUI_PROFILER_ZONE_END()               ImGui::ProfilerZoneEnd()
+#else
+#define IMGUI_PROFILER_ZONE(_NAME)              ((void)0)
+#define IMGUI_PROFILER_ZONE_ID(_NAME,_ID)       ((void)0)
+#define IMGUI_PROFILER_ZONE_BEGIN(_NAME,_ID)    ((void)0)
+#define IMGUI_PROFILER_ZONE_END()               ((void)0)
+#endif
+
 // Misc Macros
 #define IM_PI                           3.14159265358979323846f
 #ifdef _WIN32
@@ -383,6 +418,21 @@ inline bool             ImIsPowerOfTwo(ImU64 v)             { return v != 0 && (
 inline int              ImUpperPowerOfTwo(int v)            { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
 inline unsigned int     ImCountSetBits(unsigned int v)      { unsigned int count = 0; while (v > 0) { v = v & (v - 1); count++; } return count; }
 
+// Helpers: Atomics (Load = acquire, Store = release, others = full barrier)
+#if defined(IMGUI_ENABLE_ATOMICS) && defined(_MSC_VER) && !defined(__clang__)
+inline ImU32            ImAtomicLoad(volatile ImU32* p)                                     { return (ImU32)_InterlockedOr((volatile long*)p, 0); }
+inline void             ImAtomicStore(volatile ImU32* p, ImU32 v)                           { _InterlockedExchange((volatile long*)p, (long)v); }
+inline ImU32            ImAtomicFetchAdd(volatile ImU32* p, ImU32 v)                        { return (ImU32)_InterlockedExchangeAdd((volatile long*)p, (long)v); }
+inline ImU32            ImAtomicExchange(volatile ImU32* p, ImU32 v)                        { return (ImU32)_InterlockedExchange((volatile long*)p, (long)v); }
+inline bool             ImAtomicCompareExchange(volatile ImU32* p, ImU32 expected, ImU32 v) { return (ImU32)_InterlockedCompareExchange((volatile long*)p, (long)v, (long)expected) == expected; }
+#elif defined(IMGUI_ENABLE_ATOMICS)
+inline ImU32            ImAtomicLoad(volatile ImU32* p)                                     { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+inline void             ImAtomicStore(volatile ImU32* p, ImU32 v)                           { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+inline ImU32            ImAtomicFetchAdd(volatile ImU32* p, ImU32 v)                        { return __atomic_fetch_add(p, v, __ATOMIC_SEQ_CST); }
+inline ImU32            ImAtomicExchange(volatile ImU32* p, ImU32 v)                        { return __atomic_exchange_n(p, v, __ATOMIC_SEQ_CST); }
+inline bool             ImAtomicCompareExchange(volatile ImU32* p, ImU32 expected, ImU32 v) { return __atomic_compare_exchange_n(p, &expected, v, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED); }
+#endif
+
 // Helpers: String
 #define ImStrlen strlen
 #define ImMemchr memchr
@@ -463,6 +513,8 @@ IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 coun
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
+IMGUI_API const void*       ImFileMapToMemory(const char* filename, size_t* out_file_size, bool* out_mapped);  // Read-only. Falls back to ImFileLoadToMemory() when mapping is not available.
+IMGUI_API void              ImFileUnmapFromMemory(const void* data, size_t data_size, bool mapped);
 
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
@@ -866,6 +918,8 @@ struct IMGUI_API ImDrawListSharedData
     ImVector<ImVec2> TempBuffer;                // Temporary write buffer
     ImVector<ImDrawList*> DrawLists;            // All draw lists associated to this ImDrawListSharedData
     ImGuiContext*   Context;                    // [OPTIONAL] Link to Dear ImGui context. 99% of ImDrawList/ImFontAtlas can function without an ImGui context, but this facilitate handling one legacy edge case.
+    ImVector<ImTextureData*> TexturesInUse;     // Font atlas textures which may be referenced by draw lists until the next NewFrame(). Holds a ImTextureData::UseCount reference.
+    ImVec4          TexUvLinesCopy[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1]; // Copy of FontAtlas->TexUvLines[] when the atlas is shared with other threads (see ImFontAtlas::ThreadLockFunc)
 
     // Lookup tables
     ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
@@ -877,14 +931,67 @@ struct IMGUI_API ImDrawListSharedData
     void SetCircleTessellationMaxError(float max_error);
 };
 
+// Draw list rendered by previous frame, to compute ImDrawData::DamageRects[] (see io.ConfigDrawDataDamageRects)
+struct ImDrawDataDamageEntry
+{
+    ImDrawList*             DrawList;
+    ImGuiID                 Hash;           // Hash of vertices, indices and commands
+    ImRect                  Bounds;         // Union of vertices extents clipped by their command clip rectangle, clipped by display rectangle
+};
+
 struct ImDrawDataBuilder
 {
     ImVector<ImDrawList*>*  Layers[2];      // Pointers to global layers for: regular, tooltip. LayersP[0] is owned by DrawData.
     ImVector<ImDrawList*>   LayerData1;
 
+    // Damage tracking (when io.ConfigDrawDataDamageRects is set)
+    ImVector<ImDrawDataDamageEntry> DamageEntries;      // Draw lists rendered by previous frame, in display order
+    ImVector<ImDrawDataDamageEntry> DamageEntriesTemp;  // Draw lists rendered by current frame, swapped with DamageEntries[]
+    ImGuiStorage            DamageEntriesMap;       // Hash of ImDrawList* -> index in DamageEntries[]
+    ImVector<ImRect>        DamageRectsTemp;
+    ImRect                  DamageDisplayRect;      // Display rectangle of previous frame
+    ImVec2                  DamageFramebufferScale; // Framebuffer scale of previous frame
+    bool                    DamageEntriesValid;     // DamageEntries[] may be compared against (false on first use)
+
     ImDrawDataBuilder()                     { memset(this, 0, sizeof(*this)); }
 };
 
+// State of a ImGuiDrawDataBuffer. Transitions are done with atomic compare-exchange.
+enum ImGuiDrawDataBufferState
+{
+    ImGuiDrawDataBufferState_Free,
+    ImGuiDrawDataBufferState_Writing,       // Being written by Render()
+    ImGuiDrawDataBufferState_Published,     // Latest draw data published by Render(), not acquired yet
+    ImGuiDrawDataBufferState_Held,          // Held by render thread, see AcquireDrawData()
+};
+
+// Font atlas texture held by a ImGuiDrawDataBuffer, with its atlas (whose lock protects ImTextureData::UseCount).
+// The atlas may have been unregistered from the context by the time the buffer releases it.
+struct ImGuiDrawDataBufferTexture
+{
+    ImFontAtlas*            Atlas;
+    ImTextureData*          Tex;
+};
+
+// Draw data published by Render() when io.ConfigDrawDataBuffers >= 2, for a render thread to use while next frame is being built.
+// Draw lists buffers are swapped with the live ImDrawList buffers (no copy): a live ImDrawList receives back the buffers it published N frames ago,
+// which are cleared when it is next used, keeping their capacity.
+// Font atlas textures are held (ImTextureData::UseCount) until the buffer is reused or freed, so draw commands never reference a destroyed texture.
+struct ImGuiDrawDataBuffer
+{
+    ImDrawData              DrawData;
+    ImVector<ImTextureData*> Textures;              // Copy of PlatformIO.Textures[] when published. DrawData.Textures points to it.
+    ImVector<ImGuiDrawDataBufferTexture> TexturesInUse; // Font atlas textures held by this buffer. Only accessed by main thread, while buffer is not Held/Published.
+    ImVector<ImDrawList*>   DrawLists;              // Owned draw lists, holding buffers swapped with live draw lists
+    ImVector<int>           DrawListsLastFrame;     // Last frame each draw list was published
+    ImGuiStorage            DrawListsMap;           // Hash of live ImDrawList* -> index in DrawLists[]
+    ImU32                   State;                  // [Atomic] ImGuiDrawDataBufferState
+    int                     FrameCount;             // Frame count when published
+
+    ImGuiDrawDataBuffer()   { State = ImGuiDrawDataBufferState_Free; FrameCount = -1; }
+    ~ImGuiDrawDataBuffer()  { DrawLists.clear_delete(); }
+};
+
 struct ImFontStackData
 {
     ImFont*     Font;
@@ -1420,6 +1527,28 @@ struct ImGuiWindowStackData
     ImGuiErrorRecoveryState StackSizesInBegin;          // Store size of various stacks for asserting
     bool                    DisabledOverrideReenable;   // Non-child window override disabled flag
     float                   DisabledOverrideReenableAlphaBackup;
+#ifdef IMGUI_ENABLE_PROFILER
+    bool                    ProfilerWindowZone;         // Begin() opened a "Window" profiler zone, to be ended by End()
+#endif
+};
+
+// Uniform grid over the hit-test rectangles of windows that were active in the previous frame (g.WindowsHitGrid).
+// Allows FindHoveredWindowEx() to only test the windows overlapping the cell under the mouse, instead of every window.
+// Updated by NewFrame(): a window only touches cells when the range of cells it covers changes.
+// Cells may contain stale entries (windows which moved away), which are rejected by the hit-test and flushed by resetting the grid.
+struct ImGuiWindowHitGrid
+{
+    ImRect                  Rect;               // Area covered by the cells (main viewport). Positions outside are clamped to border cells.
+    ImVec2                  Padding;            // Padding added around windows rectangles, >= padding used by FindHoveredWindowEx().
+    int                     CellsX, CellsY;
+    int                     Generation;         // Incremented on reset. A window is registered in cells when its HitGridGeneration matches.
+    int                     EntriesCount;       // Total number of entries in Cells[]
+    int                     EntriesStaleCount;  // Number of entries left in cells not covered anymore by their window
+    ImVector<ImVector<ImGuiWindow*> > Cells;    // [CellsX * CellsY] Windows overlapping each cell, unordered.
+
+    ImGuiWindowHitGrid()    { CellsX = CellsY = 0; Generation = EntriesCount = EntriesStaleCount = 0; }
+    ~ImGuiWindowHitGrid()   { Clear(); }
+    void Clear()            { for (ImVector<ImGuiWindow*>& cell : Cells) cell.clear(); Cells.clear(); CellsX = CellsY = 0; EntriesCount = EntriesStaleCount = 0; }
 };
 
 struct ImGuiShrinkWidthItem
@@ -1551,6 +1680,29 @@ struct ImGuiInputEvent
     ImGuiInputEvent() { memset(this, 0, sizeof(*this)); }
 };
 
+// Lock-free bounded multi-producer single-consumer queue of input events submitted from any thread, see io.SetInputEventsThreaded()
+// - Producers claim a slot by advancing WriteIdx, write the event then publish it by writing the slot Sequence.
+// - NewFrame() reads published slots in order and forwards them to g.InputEventsQueue, applying the same filtering as when not threaded.
+struct ImGuiInputEventThreadedSlot
+{
+    ImU32                   Sequence;       // == Index + 1 when published, == Index + Capacity when free for next round
+    ImGuiInputEvent         Event;
+};
+
+struct ImGuiInputEventsThreadedQueue
+{
+    ImVector<ImGuiInputEventThreadedSlot> Slots;    // Power of two size. Empty when disabled.
+    ImU32                   WriteIdx;               // [Atomic] Next slot to be claimed by a producer.
+    ImU32                   ReadIdx;                // Next slot to be read by NewFrame().
+    ImU32                   NextMouseSource;        // [Atomic] Latched by io.AddMouseSourceEvent() and stored in mouse events.
+    ImU32                   DroppedCount;           // [Atomic] Number of events lost because the queue was full.
+    ImU32                   DroppedCountReported;
+    ImU32                   AppAcceptingEvents;     // [Atomic] Replaces io.AppAcceptingEvents while enabled.
+    ImU32                   InputQueueSurrogate;    // [Atomic] Replaces io.InputQueueSurrogate while enabled.
+
+    ImGuiInputEventsThreadedQueue() { WriteIdx = ReadIdx = NextMouseSource = DroppedCount = DroppedCountReported = InputQueueSurrogate = 0; AppAcceptingEvents = 1; }
+};
+
 // Input function taking an 'ImGuiID owner_id' argument defaults to (ImGuiKeyOwner_Any == 0) aka don't test ownership, which matches legacy behavior.
 #define ImGuiKeyOwner_Any           ((ImGuiID)0)    // Accept key that have an owner, UNLESS a call to SetKeyOwner() explicitly used ImGuiInputFlags_LockThisFrame or ImGuiInputFlags_LockUntilRelease.
 #define ImGuiKeyOwner_NoOwner       ((ImGuiID)-1)   // Require key to have no owner.
@@ -1998,6 +2150,27 @@ struct ImGuiWindowSettings
     char* GetName()             { return (char*)(this + 1); }
 };
 
+// Binary settings file write, which may run on another thread (see SaveBinarySettingsToDisk(), platform_io.Platform_RunSettingsWriteFn)
+// It only accesses its own data: the context applies the result once State is Done or Failed.
+enum ImGuiSettingsWriteState_
+{
+    ImGuiSettingsWriteState_Idle,
+    ImGuiSettingsWriteState_Pending,
+    ImGuiSettingsWriteState_Done,
+    ImGuiSettingsWriteState_Failed,
+};
+
+struct ImGuiSettingsWriteTask
+{
+    volatile ImU32      State;              // ImGuiSettingsWriteState_
+    ImVector<char>      Filename;           // Zero-terminated
+    ImVector<char>      Data;               // New contents of the file
+    ImVector<int>       Ranges;             // { offset, size } pairs of Data to rewrite in place
+    int                 InPlaceFileSize;    // Expected size of the file to rewrite Ranges in place. 0 (or a file of another size) to rewrite the whole file.
+
+    ImGuiSettingsWriteTask() { State = ImGuiSettingsWriteState_Idle; InPlaceFileSize = 0; }
+};
+
 struct ImGuiSettingsHandler
 {
     const char* TypeName;       // Short description stored in .ini file. Disallowed characters: '[' ']'
@@ -2008,6 +2181,8 @@ struct ImGuiSettingsHandler
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order)
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*ReadBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, const void* data, size_t data_size); // Read: Optional. Called for each record appended by WriteBinaryFn with a valid checksum. 'data' is not aligned and may be memory-mapped: copy fields out and validate them.
+    void        (*WriteBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImVector<char>* out_buf);     // Write: Optional. Append every entries to 'out_buf' as records starting with their int size, a multiple of 4 (e.g. ImChunkStream chunks). Handlers without it are stored as text in binary settings.
     void*       UserData;
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
@@ -2115,6 +2290,7 @@ struct ImGuiMetricsConfig
     int         HighlightMonitorIdx = -1;
     ImGuiID     HighlightViewportID = 0;
     bool        ShowFontPreview = true;
+    char        TextEncodingViewerBuf[64] = "";
 };
 
 struct ImGuiStackLevelInfo
@@ -2145,6 +2321,50 @@ struct ImGuiIDStackTool
     ImGuiIDStackTool()      { memset(this, 0, sizeof(*this)); LastActiveFrame = -1; OptHexEncodeNonAsciiChars = true; CopyToClipboardLastTime = -FLT_MAX; }
 };
 
+#ifdef IMGUI_ENABLE_PROFILER
+
+// A timed zone, see IMGUI_PROFILER_ZONE() macros.
+struct ImGuiProfilerZone
+{
+    const char*             Name;                       // Not copied: literal or persistent string
+    ImGuiID                 ID;                         // Optional (e.g. window ID for "Window" zones)
+    int                     Depth;                      // Nesting level, 0 for top-level zones
+    ImU64                   TimeBegin;                  // In nanoseconds, see ProfilerGetTime()
+    ImU64                   TimeEnd;
+};
+
+// Zones recorded between two calls to NewFrame()
+struct ImGuiProfilerFrame
+{
+    int                     FrameCount;
+    ImU64                   TimeBegin;
+    ImU64                   TimeEnd;
+    ImVector<ImGuiProfilerZone> Zones;                  // In order of ProfilerZoneBegin() calls, so sorted by TimeBegin
+
+    ImGuiProfilerFrame()    { Clear(); }
+    void                    Clear()                     { FrameCount = 0; TimeBegin = TimeEnd = 0; Zones.resize(0); }
+    void                    Swap(ImGuiProfilerFrame& rhs) { ImSwap(FrameCount, rhs.FrameCount); ImSwap(TimeBegin, rhs.TimeBegin); ImSwap(TimeEnd, rhs.TimeEnd); Zones.swap(rhs.Zones); }
+};
+
+// State for the built-in CPU profiler. Frames are swapped on NewFrame(): recording never copies or allocates in steady state.
+struct ImGuiProfiler
+{
+    bool                    Enabled;                    // Record zones. Changes are applied on next NewFrame().
+    bool                    Recording;                  // Copy of Enabled latched on NewFrame()
+    bool                    DisplaySlowestFrame;        // Metrics window: display SlowestFrame instead of LastFrame
+    float                   DisplayZoom;                // Metrics window: horizontal zoom of flame graph
+    ImGuiProfilerFrame      CurrFrame;                  // Frame being recorded
+    ImGuiProfilerFrame      LastFrame;                  // Last complete frame
+    ImGuiProfilerFrame      SlowestFrame;               // Copy of slowest complete frame since last reset
+    ImVector<int>           ZoneStack;                  // Index of open zones in CurrFrame.Zones[]
+    float                   FrameTimes[120];            // Duration of last frames in milliseconds, for display
+    int                     FrameTimesIdx;
+
+    ImGuiProfiler()         { Enabled = true; Recording = DisplaySlowestFrame = false; DisplayZoom = 1.0f; memset(FrameTimes, 0, sizeof(FrameTimes)); FrameTimesIdx = 0; }
+};
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic context hooks
 //-----------------------------------------------------------------------------
@@ -2198,6 +2418,7 @@ struct ImGuiContext
     ImVector<ImGuiInputEvent> InputEventsTrail;                 // Past input events processed in NewFrame(). This is to allow domain-specific application to access e.g mouse/pen trail.
     ImGuiMouseSource        InputEventsNextMouseSource;
     ImU32                   InputEventsNextEventId;
+    ImGuiInputEventsThreadedQueue InputEventsThreaded;          // Events submitted from other threads, see io.SetInputEventsThreaded()
 
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
@@ -2205,6 +2426,7 @@ struct ImGuiContext
     ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
+    ImGuiWindowHitGrid      WindowsHitGrid;                     // Spatial index over windows hit-test rectangles, for FindHoveredWindowEx()
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
     float                   WindowsBorderHoverPadding;          // Padding around resizable windows for which hovering on counts as hovering the window == ImMax(style.TouchExtraPadding, style.WindowBorderHoverPadding). This isn't so multi-dpi friendly.
     ImGuiID                 DebugBreakInWindow;                 // Set to break in Begin() call.
@@ -2333,6 +2555,7 @@ struct ImGuiContext
     ImGuiDir                NavMoveDirForDebug;
     ImGuiDir                NavMoveClipDir;                     // FIXME-NAV: Describe the purpose of this better. Might want to rename?
     ImRect                  NavScoringRect;                     // Rectangle used for scoring, in screen space. Based of window->NavRectRel[], modified for directional navigation scoring.
+    ImRect                  NavScoringCullRect;                 // Items of NavWindow whose nav rectangle doesn't overlap this can't beat current move result, and are not scored. Shrinks as better results are found.
     ImRect                  NavScoringNoClipRect;               // Some nav operations (such as PageUp/PageDown) enforce a region which clipper will attempt to always keep submitted
     int                     NavScoringDebugCount;               // Metrics for debugging
     int                     NavTabbingDir;                      // Generally -1 or +1, 0 when tabbing without a nav id
@@ -2367,6 +2590,10 @@ struct ImGuiContext
 
     // Render
     float                   DimBgRatio;                         // 0.0..1.0 animation when fading in a dimming background (for modal window and CTRL+TAB list)
+    ImVector<ImGuiDrawDataBuffer*> DrawDataBuffers;             // See io.ConfigDrawDataBuffers
+    ImU32                   DrawDataBuffersCount;               // [Atomic] == DrawDataBuffers.Size once created, so AcquireDrawData() may be called before first Render().
+    ImGuiDrawDataBuffer*    DrawDataBufferPublished;            // Last buffer published by Render(). Only accessed by main thread.
+    ImGuiDrawDataBuffer*    DrawDataBufferHeld;                 // Buffer held by render thread. Only accessed by AcquireDrawData()/ReleaseDrawData().
 
     // Drag and Drop
     bool                    DragDropActive;
@@ -2432,8 +2659,11 @@ struct ImGuiContext
     ImGuiInputTextState     InputTextState;
     ImGuiTextIndex          InputTextLineIndex;                 // Temporary storage
     ImGuiInputTextDeactivatedState InputTextDeactivatedState;
-    ImFontBaked             InputTextPasswordFontBackupBaked;
-    ImFontFlags             InputTextPasswordFontBackupFlags;
+    ImFont                  InputTextPasswordFont;              // Font with a single glyph, owned by the context (see PushPasswordFont())
+    ImFontBaked             InputTextPasswordFontBaked;
+    ImFont*                 InputTextPasswordFontBackupFont;
+    ImFontBaked*            InputTextPasswordFontBackupBaked;
+    float                   InputTextPasswordFontBackupBakedScale;
     ImGuiID                 TempInputId;                        // Temporary text input when CTRL+clicking on a slider, etc.
     ImGuiDataTypeStorage    DataTypeZeroValue;                  // 0 for all data types
     int                     BeginMenuDepth;
@@ -2479,6 +2709,13 @@ struct ImGuiContext
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImGuiStorage                        SettingsWindowsMap;     // (hashed) Map ImGuiWindowSettings::ID to offset into SettingsWindows
+    ImGuiStorage                        SettingsTablesMap;      // (hashed) Map ImGuiTableSettings::ID to offset into SettingsTables
+    ImVector<char>                      SettingsBinaryData;     // In memory binary settings (output of SaveBinarySettingsToMemory())
+    ImVector<char>                      SettingsBinaryRecords;  // Temporary buffer for records output by ImGuiSettingsHandler::WriteBinaryFn
+    ImVector<char>                      SettingsBinaryDiskData; // Copy of binary settings last saved to/loaded from disk, so we only rewrite what changed
+    ImGuiID                             SettingsBinaryDiskFilenameHash; // Hash of the filename SettingsBinaryDiskData corresponds to
+    ImGuiSettingsWriteTask              SettingsBinaryWriteTask;// Last binary settings file write, possibly still running on another thread
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -2529,6 +2766,9 @@ struct ImGuiContext
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiProfiler           Profiler;
+#endif
 #if defined(IMGUI_DEBUG_HIGHLIGHT_ALL_ID_CONFLICTS) && !defined(IMGUI_DISABLE_DEBUG_TOOLS)
     ImGuiStorage            DebugDrawIdConflictsAliveCount;
     ImGuiStorage            DebugDrawIdConflictsHighlightSet;
@@ -2542,6 +2782,7 @@ struct ImGuiContext
     int                     WantCaptureMouseNextFrame;          // Explicit capture override via SetNextFrameWantCaptureMouse()/SetNextFrameWantCaptureKeyboard(). Default to -1.
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;             // Copied in EndFrame() from g.PlatformImeData.WantTextInput. Needs to be set for some backends (SDL3) to emit character inputs.
+    float                   WantRenderNextFrameDelay;           // Lowest delay requested via SetNextFrameWantRender() during the frame, used by EndFrame() to compute io.WantRenderTimeout. Default to FLT_MAX.
     ImVector<char>          TempBuffer;                         // Temporary text buffer
     char                    TempKeychordName[64];
 
@@ -2689,6 +2930,9 @@ struct IMGUI_API ImGuiWindow
     ImRect                  ContentRegionRect;                  // FIXME: This is currently confusing/misleading. It is essentially WorkRect but not handling of scrolling. We currently rely on it as right/bottom aligned sizing operation need some size to rely on.
     ImVec2ih                HitTestHoleSize;                    // Define an optional rectangular hole where mouse will pass-through the window.
     ImVec2ih                HitTestHoleOffset;
+    int                     HitGridGeneration;                  // == g.WindowsHitGrid.Generation when registered in g.WindowsHitGrid cells.
+    ImVec2ih                HitGridCellMin, HitGridCellMax;     // Cells covered in g.WindowsHitGrid (inclusive).
+    int                     DisplayIndexCached;                 // Index in g.Windows[], validated and refreshed by FindWindowDisplayIndex().
 
     int                     LastFrameActive;                    // Last frame number the window was Active.
     float                   LastTimeActive;                     // Last timestamp the window was Active (using float as we don't need high precision there)
@@ -3709,6 +3953,16 @@ namespace ImGui
     IMGUI_API void          DebugRenderKeyboardPreview(ImDrawList* draw_list);
     IMGUI_API void          DebugRenderViewportThumbnail(ImDrawList* draw_list, ImGuiViewportP* viewport, const ImRect& bb);
 
+    // Profiler (when IMGUI_ENABLE_PROFILER is defined, prefer using the IMGUI_PROFILER_ZONE() macros)
+#ifdef IMGUI_ENABLE_PROFILER
+    IMGUI_API void          ProfilerNewFrame();
+    IMGUI_API void          ProfilerZoneBegin(const char* name, ImGuiID id = 0);
+    IMGUI_API void          ProfilerZoneEnd();
+    IMGUI_API void          ProfilerZoneEndEx(ImGuiContext* ctx);
+    IMGUI_API ImU64         ProfilerGetTime();                                      // Monotonic time in nanoseconds
+    IMGUI_API void          DebugNodeProfiler(ImGuiProfiler* profiler);
+#endif
+
     // Obsolete functions
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     //inline void   SetItemUsingMouseWheel()                                            { SetItemKeyOwner(ImGuiKey_MouseWheelY); }      // Changed in 1.89
@@ -3725,6 +3979,16 @@ namespace ImGui
 
 } // namespace ImGui
 
+#ifdef IMGUI_ENABLE_PROFILER
+// Helper: scoped profiler zone, see IMGUI_PROFILER_ZONE() macro.
+struct ImGuiProfilerZoneScope
+{
+    ImGuiContext*   Ctx;
+    ImGuiProfilerZoneScope(const char* name, ImGuiID id) { Ctx = GImGui; ImGui::ProfilerZoneBegin(name, id); }
+    ~ImGuiProfilerZoneScope()                            { ImGui::ProfilerZoneEndEx(Ctx); }
+};
+#endif
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] ImFontLoader
@@ -3741,9 +4005,13 @@ struct ImFontLoader
     bool            (*FontSrcInit)(ImFontAtlas* atlas, ImFontConfig* src);
     void            (*FontSrcDestroy)(ImFontAtlas* atlas, ImFontConfig* src);
     bool            (*FontSrcContainsGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImWchar codepoint);
+    void            (*FontSrcGetCodepointRanges)(ImFontAtlas* atlas, ImFontConfig* src, ImVector<ImWchar>* out_ranges); // Optional. Append sorted, non-overlapping [first, last] pairs of all codepoints provided by the source (e.g. from cmap). Used to build ImFont::SourcesIndex[].
     bool            (*FontBakedInit)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
     void            (*FontBakedDestroy)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
     bool            (*FontBakedLoadGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x);
+    int             (*FontBakedLoadGlyphs)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, const ImWchar* codepoints, int codepoints_count, ImVector<ImFontGlyph>* out_glyphs); // Optional. Load many glyphs at once (amortize per-call setup). Append glyphs found in this source to out_glyphs, return number of glyphs appended.
+    void            (*FontSrcCompactCache)(ImFontAtlas* atlas, ImFontConfig* src); // Optional. Release per-source caches which can be rebuilt on demand. Called by ImFontAtlas::CompactCache().
+    size_t          (*FontSrcGetCacheSize)(ImFontAtlas* atlas, ImFontConfig* src); // Optional. Return memory used by per-source caches, for Metrics/Debugger.
 
     // Size of backend data, Per Baked * Per Source. Buffers are managed by core to avoid excessive allocations.
     // FIXME: At this point the two other types of buffers may be managed by core to be consistent?
@@ -3791,6 +4059,42 @@ struct ImFontAtlasRectEntry
     unsigned int        IsUsed : 1;
 };
 
+// Pending request submitted by ImFontAtlas::AddPreloadRequest()
+// Font is referenced by its FontId so requests for a removed font are simply ignored.
+struct ImFontAtlasPreloadRequest
+{
+    ImGuiID             FontId;
+    float               Size;
+    float               RasterizerDensity;  // -1.0f: use font->CurrentRasterizerDensity at the time of processing.
+    int                 RangesOffset;       // Offset into builder->PreloadRanges[]: zero-terminated list of inclusive pairs.
+    int                 RangesCursor;       // Current range (offset from RangesOffset, in ImWchar units).
+    unsigned int        NextCodepoint;      // Next codepoint to process within current range.
+};
+
+// Tracking of a font size which is not baked, for ImFontAtlas::BakedSizeExactAfterFrames
+struct ImFontAtlasBakedSizeRequest
+{
+    ImGuiID             BakedId;            // Identifier of the bake at requested size.
+    int                 FirstFrame;         // First frame of current streak of consecutive requests.
+    int                 LastFrame;
+};
+
+// Texture change waiting to be applied by a context running on another thread, see ImFontAtlasSyncDrawListSharedData()
+// (OldTex == NewTex when only UV coordinates of the current texture have changed, e.g. after a repack)
+struct ImFontAtlasDeferredTexChange
+{
+    ImDrawListSharedData* SharedData;
+    ImTextureRef        OldTex;
+    ImTextureRef        NewTex;
+};
+
+// ImFontBaked currently bound by a context sharing the atlas, see ImFontAtlasSetBoundBaked()
+struct ImFontAtlasBoundBaked
+{
+    ImDrawListSharedData* SharedData;
+    ImFontBaked*        Baked;
+};
+
 // Data available to potential texture post-processing functions
 struct ImFontAtlasPostProcessData
 {
@@ -3826,6 +4130,11 @@ struct ImFontAtlasBuilder
     ImVector<ImTextureRect>     Rects;
     ImVector<ImFontAtlasRectEntry> RectsIndex;          // ImFontAtlasRectId -> index into Rects[]
     ImVector<unsigned char>     TempBuffer;             // Misc scratch buffer
+    ImVector<ImWchar>           TempCodepoints;         // Scratch buffers for ImFontAtlasBakedLoadGlyphs()
+    ImVector<ImWchar>           TempCodepointsForSrc;
+    ImVector<ImFontGlyph>       TempGlyphs;
+    ImVector<ImFontAtlasPreloadRequest> PreloadRequests; // Pending requests submitted by ImFontAtlas::AddPreloadRequest()
+    ImVector<ImWchar>           PreloadRanges;          // Glyph ranges storage for PreloadRequests[]
     int                         RectsIndexFreeListStart;// First unused entry
     int                         RectsPackedCount;       // Number of packed rectangles.
     int                         RectsPackedSurface;     // Number of packed pixels. Used when compacting to heuristically find the ideal texture size.
@@ -3841,11 +4150,16 @@ struct ImFontAtlasBuilder
     ImStableVector<ImFontBaked,32> BakedPool;
     ImGuiStorage                BakedMap;               // BakedId --> ImFontBaked*
     int                         BakedDiscardedCount;
+    ImVector<ImFontAtlasBakedSizeRequest> BakedSizeRequests; // Recently requested sizes which are not baked (when using size buckets)
 
     // Custom rectangle identifiers
     ImFontAtlasRectId           PackIdMouseCursors;     // White pixel + mouse cursors. Also happen to be fallback in case of packing failure.
     ImFontAtlasRectId           PackIdLinesTexData;
 
+    // Sharing with other contexts (see ImFontAtlasSyncDrawListSharedData(), ImFontAtlasSetBoundBaked())
+    ImVector<ImFontAtlasDeferredTexChange> DeferredTexChanges; // Texture changes waiting to be applied by contexts running on other threads
+    ImVector<ImFontAtlasBoundBaked> BoundBakeds;            // ImFontBaked bound by contexts until their EndFrame(): not discarded for being unused
+
     ImFontAtlasBuilder()        { memset(this, 0, sizeof(*this)); FrameCount = -1; RectsIndexFreeListStart = -1; PackIdMouseCursors = PackIdLinesTexData = -1; }
 };
 
@@ -3868,22 +4182,28 @@ IMGUI_API void              ImFontAtlasBuildSetupFontSpecialGlyphs(ImFontAtlas*
 IMGUI_API void              ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas); // Legacy
 IMGUI_API void              ImFontAtlasBuildGetOversampleFactors(ImFontConfig* src, ImFontBaked* baked, int* out_oversample_h, int* out_oversample_v);
 IMGUI_API void              ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames);
+IMGUI_API int               ImFontAtlasBuildProcessPreloadRequests(ImFontAtlas* atlas, int max_glyphs);
 
 IMGUI_API bool              ImFontAtlasFontSourceInit(ImFontAtlas* atlas, ImFontConfig* src);
 IMGUI_API void              ImFontAtlasFontSourceAddToFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* src);
 IMGUI_API void              ImFontAtlasFontDestroySourceData(ImFontAtlas* atlas, ImFontConfig* src);
 IMGUI_API bool              ImFontAtlasFontInitOutput(ImFontAtlas* atlas, ImFont* font); // Using FontDestroyOutput/FontInitOutput sequence useful notably if font loader params have changed
 IMGUI_API void              ImFontAtlasFontDestroyOutput(ImFontAtlas* atlas, ImFont* font);
+IMGUI_API void              ImFontAtlasFontBuildSourcesIndex(ImFontAtlas* atlas, ImFont* font);
+IMGUI_API int               ImFontAtlasFontFindSourceForCodepoint(ImFont* font, ImWchar codepoint); // Requires SourcesIndex[] to be built. Return -1 if no source provide the codepoint.
 IMGUI_API void              ImFontAtlasFontDiscardBakes(ImFontAtlas* atlas, ImFont* font, int unused_frames);
 
 IMGUI_API ImGuiID           ImFontAtlasBakedGetId(ImGuiID font_id, float baked_size, float rasterizer_density);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density);
+IMGUI_API ImFontBaked*      ImFontAtlasBakedGetOrAddBucketed(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density); // Apply ImFontAtlas::BakedSizeBucketsPerOctave policy.
+IMGUI_API float             ImFontAtlasBakedGetBucketSize(ImFontAtlas* atlas, float font_size);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedGetClosestMatch(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id);
 IMGUI_API void              ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked);
 IMGUI_API ImFontGlyph*      ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, const ImFontGlyph* in_glyph);
 IMGUI_API void              ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImWchar codepoint, float advance_x);
 IMGUI_API void              ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, ImFontGlyph* glyph);
+IMGUI_API void              ImFontAtlasBakedLoadGlyphs(ImFontAtlas* atlas, ImFontBaked* baked, const ImWchar* codepoints, int codepoints_count);
 IMGUI_API void              ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch);
 
 IMGUI_API void              ImFontAtlasPackInit(ImFontAtlas* atlas);
@@ -3893,10 +4213,27 @@ IMGUI_API ImTextureRect*    ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFon
 IMGUI_API void              ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
 
 IMGUI_API void              ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures);
+inline void                 ImFontAtlasThreadLock(ImFontAtlas* atlas)   { if (atlas->ThreadLockFunc) atlas->ThreadLockFunc(atlas); }
+inline void                 ImFontAtlasThreadUnlock(ImFontAtlas* atlas) { if (atlas->ThreadUnlockFunc) atlas->ThreadUnlockFunc(atlas); }
+IMGUI_API void              ImFontAtlasSyncDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* shared_data); // Apply texture changes made by other threads. Lock must be held.
+IMGUI_API void              ImFontAtlasAddTextureInUse(ImDrawListSharedData* shared_data, ImTextureData* tex);
+IMGUI_API void              ImFontAtlasAcquireTexturesInUse(ImFontAtlas* atlas, ImDrawListSharedData* shared_data);
+IMGUI_API void              ImFontAtlasReleaseTexturesInUse(ImFontAtlas* atlas, ImDrawListSharedData* shared_data);
+IMGUI_API void              ImFontAtlasSetBoundBaked(ImFontAtlas* atlas, ImDrawListSharedData* shared_data, ImFontBaked* baked);
+
+// Hold the atlas lock (see ImFontAtlas::ThreadLockFunc) until the end of the current C++ scope.
+// When 'shared_data' is provided, texture changes made by other threads are applied to its draw lists.
+struct ImFontAtlasThreadLockScope
+{
+    ImFontAtlas*    Atlas;
+    ImFontAtlasThreadLockScope(ImFontAtlas* atlas, ImDrawListSharedData* shared_data = NULL) { Atlas = atlas; if (atlas->ThreadLockFunc) { atlas->ThreadLockFunc(atlas); if (shared_data) ImFontAtlasSyncDrawListSharedData(atlas, shared_data); } }
+    ~ImFontAtlasThreadLockScope() { ImFontAtlasThreadUnlock(Atlas); }
+};
 IMGUI_API void              ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data);
 IMGUI_API void              ImFontAtlasRemoveDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data);
 IMGUI_API void              ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atlas, ImTextureRef old_tex, ImTextureRef new_tex);
 IMGUI_API void              ImFontAtlasUpdateDrawListsSharedData(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasUpdateDrawListSharedDataUvs(ImFontAtlas* atlas, ImDrawListSharedData* shared_data);
 
 IMGUI_API void              ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h);
 IMGUI_API void              ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data);
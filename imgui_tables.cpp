@@ -805,6 +805,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(table->IsLayoutLocked == false);
+    IMGUI_PROFILER_ZONE_ID("TableUpdateLayout", table->ID);
 
     const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
     table->IsDefaultDisplayOrder = true;
@@ -1181,6 +1182,8 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         {
             column->AutoFitQueue >>= 1;
             column->CannotSkipItemsQueue >>= 1;
+            if (column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0)
+                SetNextFrameWantRender();
         }
 
         if (visible_n < table->FreezeColumnsCount)
@@ -1336,6 +1339,8 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
             table->ResizedColumn = (ImGuiTableColumnIdx)column_n;
             table->InstanceInteracted = table->InstanceCurrent;
         }
+        if (hovered && g.HoveredIdTimer <= TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER)
+            SetNextFrameWantRender(TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER - g.HoveredIdTimer);
         if ((hovered && g.HoveredIdTimer > TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER) || held)
         {
             table->HoveredColumnBorder = (ImGuiTableColumnIdx)column_n;
@@ -1353,6 +1358,7 @@ void    ImGui::EndTable()
         IM_ASSERT_USER_ERROR(table != NULL, "EndTable() call should only be done while in BeginTable() scope!");
         return;
     }
+    IMGUI_PROFILER_ZONE_BEGIN("EndTable", table->ID); // Ended before EndChild(), which closes the inner window zone
 
     // This assert would be very useful to catch a common error... unfortunately it would probably trigger in some
     // cases, and for consistency user may sometimes output empty tables (and still benefit from e.g. outer border)
@@ -1498,6 +1504,8 @@ void    ImGui::EndTable()
     outer_window->DC.ItemWidthStack.Size = temp_data->HostBackupItemWidthStackSize;
     outer_window->DC.ColumnsOffset = temp_data->HostBackupColumnsOffset;
 
+    IMGUI_PROFILER_ZONE_END(); // "EndTable"
+
     // Layout in outer window
     // (FIXME: To allow auto-fit and allow desirable effect of SameLine() we dissociate 'used' vs 'ideal' size by overriding
     // CursorPosPrevLine and CursorMaxPos manually. That should be a more general layout feature, see same problem e.g. #3414)
@@ -3616,6 +3624,7 @@ void ImGui::TableDrawDefaultContextMenu(ImGuiTable* table, ImGuiTableFlags flags
 //-------------------------------------------------------------------------
 // - TableSettingsInit() [Internal]
 // - TableSettingsCalcChunkSize() [Internal]
+// - TableSettingsAddToMap() [Internal]
 // - TableSettingsCreate() [Internal]
 // - TableSettingsFindByID() [Internal]
 // - TableGetBoundSettings() [Internal]
@@ -3627,6 +3636,8 @@ void ImGui::TableDrawDefaultContextMenu(ImGuiTable* table, ImGuiTableFlags flags
 // - TableSettingsHandler_ReadOpen() [Internal]
 // - TableSettingsHandler_ReadLine() [Internal]
 // - TableSettingsHandler_WriteAll() [Internal]
+// - TableSettingsHandler_ReadBinary() [Internal]
+// - TableSettingsHandler_WriteBinary() [Internal]
 // - TableSettingsInstallHandler() [Internal]
 //-------------------------------------------------------------------------
 // [Init] 1: TableSettingsHandler_ReadXXXX()   Load and parse .ini file into TableSettings.
@@ -3653,23 +3664,33 @@ static size_t TableSettingsCalcChunkSize(int columns_count)
     return sizeof(ImGuiTableSettings) + (size_t)columns_count * sizeof(ImGuiTableColumnSettings);
 }
 
+// Add to index, unless it already refers to a valid entry for this ID (entries are invalidated by setting their ID to 0)
+static void TableSettingsAddToMap(ImGuiTableSettings* settings)
+{
+    ImGuiContext& g = *GImGui;
+    int* p_offset = g.SettingsTablesMap.GetIntRef(settings->ID, -1);
+    if (*p_offset == -1 || g.SettingsTables.ptr_from_offset(*p_offset)->ID != settings->ID)
+        *p_offset = g.SettingsTables.offset_from_ptr(settings);
+}
+
 ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
 {
     ImGuiContext& g = *GImGui;
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
+    TableSettingsAddToMap(settings);
     return settings;
 }
 
 // Find existing settings
 ImGuiTableSettings* ImGui::TableSettingsFindByID(ImGuiID id)
 {
-    // FIXME-OPT: Might want to store a lookup map for this?
     ImGuiContext& g = *GImGui;
-    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset = g.SettingsTablesMap.GetInt(id, -1);
+    if (offset == -1)
+        return NULL;
+    ImGuiTableSettings* settings = g.SettingsTables.ptr_from_offset(offset);
+    return (settings->ID == id) ? settings : NULL;
 }
 
 // Get settings for a given table, NULL if none
@@ -3829,6 +3850,7 @@ static void TableSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandle
         if (ImGuiTable* table = g.Tables.TryGetMapData(i))
             table->SettingsOffset = -1;
     g.SettingsTables.clear();
+    g.SettingsTablesMap.Clear();
 }
 
 // Apply to existing windows (if any)
@@ -3928,6 +3950,72 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
     }
 }
 
+// Read a chunk stored in its in-memory layout by TableSettingsHandler_WriteBinary().
+// 'data' is not aligned and may point to a memory-mapped file: fields are copied out and validated, including those TableLoadSettings() uses as indices.
+static void TableSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, const void* data, size_t data_size)
+{
+    const char* src = (const char*)data + sizeof(int); // Skip ImChunkStream chunk size
+    if (data_size < sizeof(int) + sizeof(ImGuiTableSettings))
+        return;
+    ImGuiID id;
+    ImGuiTableFlags save_flags;
+    float ref_scale;
+    ImGuiTableColumnIdx columns_count, columns_count_max;
+    memcpy(&id, src + offsetof(ImGuiTableSettings, ID), sizeof(id));
+    memcpy(&save_flags, src + offsetof(ImGuiTableSettings, SaveFlags), sizeof(save_flags));
+    memcpy(&ref_scale, src + offsetof(ImGuiTableSettings, RefScale), sizeof(ref_scale));
+    memcpy(&columns_count, src + offsetof(ImGuiTableSettings, ColumnsCount), sizeof(columns_count));
+    memcpy(&columns_count_max, src + offsetof(ImGuiTableSettings, ColumnsCountMax), sizeof(columns_count_max));
+    if (id == 0 || columns_count_max <= 0 || columns_count < 0 || columns_count > columns_count_max || columns_count_max > IMGUI_TABLE_MAX_COLUMNS)
+        return;
+    if (data_size != IM_MEMALIGN(sizeof(int) + TableSettingsCalcChunkSize(columns_count_max), 4))
+        return;
+    if (!(ref_scale >= 0.0f && ref_scale < FLT_MAX)) // Also rejects NaN
+        return;
+    const char* src_columns = src + sizeof(ImGuiTableSettings);
+    for (int n = 0; n < columns_count; n++)
+    {
+        ImGuiTableColumnSettings column;
+        memcpy(&column, src_columns + n * sizeof(ImGuiTableColumnSettings), sizeof(column));
+        if (!(column.WidthOrWeight >= 0.0f && column.WidthOrWeight < FLT_MAX))
+            return;
+        if (column.Index < 0 || column.Index >= columns_count_max || column.DisplayOrder < -1 || column.DisplayOrder >= columns_count_max || column.SortOrder < -1 || column.SortOrder >= columns_count_max)
+            return;
+        if (column.SortDirection > ImGuiSortDirection_Descending || column.IsEnabled < -1)
+            return;
+    }
+
+    ImGuiTableSettings* settings = ImGui::TableSettingsFindByID(id);
+    if (settings && settings->ColumnsCountMax < columns_count)
+    {
+        settings->ID = 0; // Invalidate storage, we won't fit because of a count change
+        settings = NULL;
+    }
+    if (settings == NULL)
+        settings = ImGui::TableSettingsCreate(id, columns_count);
+    settings->SaveFlags = save_flags;
+    settings->RefScale = ref_scale;
+    settings->ColumnsCount = columns_count;
+    settings->WantApply = true;
+    memcpy(settings->GetColumnSettings(), src_columns, (size_t)columns_count * sizeof(ImGuiTableColumnSettings));
+}
+
+static void TableSettingsHandler_WriteBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImVector<char>* buf)
+{
+    // Copy chunks (including their size header) in their in-memory layout
+    ImGuiContext& g = *ctx;
+    buf->reserve(buf->Size + g.SettingsTables.size());
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+    {
+        if (settings->ID == 0) // Skip ditched settings
+            continue;
+        const int chunk_size = g.SettingsTables.chunk_size(settings);
+        const int offset = buf->Size;
+        buf->resize(offset + chunk_size);
+        memcpy(buf->Data + offset, (const char*)settings - sizeof(int), (size_t)chunk_size);
+    }
+}
+
 void ImGui::TableSettingsAddSettingsHandler()
 {
     ImGuiSettingsHandler ini_handler;
@@ -3938,6 +4026,8 @@ void ImGui::TableSettingsAddSettingsHandler()
     ini_handler.ReadLineFn = TableSettingsHandler_ReadLine;
     ini_handler.ApplyAllFn = TableSettingsHandler_ApplyAll;
     ini_handler.WriteAllFn = TableSettingsHandler_WriteAll;
+    ini_handler.ReadBinaryFn = TableSettingsHandler_ReadBinary;
+    ini_handler.WriteBinaryFn = TableSettingsHandler_WriteBinary;
     AddSettingsHandler(&ini_handler);
 }
 
@@ -3999,6 +4089,11 @@ void ImGui::TableGcCompactSettings()
         if (settings->ID != 0)
             memcpy(new_chunk_stream.alloc_chunk(TableSettingsCalcChunkSize(settings->ColumnsCount)), settings, TableSettingsCalcChunkSize(settings->ColumnsCount));
     g.SettingsTables.swap(new_chunk_stream);
+
+    // Rebuild index
+    g.SettingsTablesMap.Clear();
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+        TableSettingsAddToMap(settings);
 }
 
 
@@ -1425,6 +1425,7 @@ void ImGui::ProgressBar(float fraction, const ImVec2& size_arg, const char* over
 
     if (is_indeterminate)
     {
+        SetNextFrameWantRender(); // Animated by caller
         const float fill_width_n = 0.2f;
         fill_n0 = ImFmod(-fraction, 1.0f) * (1.0f + fill_width_n) - fill_width_n;
         fill_n1 = ImSaturate(fill_n0 + fill_width_n);
@@ -1787,6 +1788,8 @@ bool ImGui::SplitterBehavior(const ImRect& bb, ImGuiID id, ImGuiAxis axis, float
     if (hovered)
         g.LastItemData.StatusFlags |= ImGuiItemStatusFlags_HoveredRect; // for IsItemHovered(), because bb_interact is larger than bb
 
+    if (hovered && g.HoveredIdTimer < hover_visibility_delay)
+        SetNextFrameWantRender(hover_visibility_delay - g.HoveredIdTimer);
     if (held || (hovered && g.HoveredIdPreviousFrame == id && g.HoveredIdTimer >= hover_visibility_delay))
         SetMouseCursor(axis == ImGuiAxis_Y ? ImGuiMouseCursor_ResizeNS : ImGuiMouseCursor_ResizeEW);
 
@@ -3958,7 +3961,7 @@ namespace ImStb
 {
 static int     STB_TEXTEDIT_STRINGLEN(const ImGuiInputTextState* obj)                             { return obj->TextLen; }
 static char    STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { IM_ASSERT(idx >= 0 && idx <= obj->TextLen); return obj->TextSrc[idx]; }
-static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { unsigned int c; ImTextCharFromUtf8(&c, obj->TextSrc + line_start_idx + char_idx, obj->TextSrc + obj->TextLen); if ((ImWchar)c == '\n') return IMSTB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *obj->Ctx; return g.FontBaked->GetCharAdvance((ImWchar)c) * g.FontBakedScale; }
+static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { unsigned int c; ImTextCharFromUtf8(&c, obj->TextSrc + line_start_idx + char_idx, obj->TextSrc + obj->TextLen); if ((ImWchar)c == '\n') return IMSTB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *obj->Ctx; ImFontAtlasThreadLockScope lock(g.Font->ContainerAtlas); return g.FontBaked->GetCharAdvance((ImWchar)c) * g.FontBakedScale; }
 static char    STB_TEXTEDIT_NEWLINE = '\n';
 static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* obj, int line_start_idx)
 {
@@ -4342,32 +4345,58 @@ void ImGuiInputTextCallbackData::InsertChars(int pos, const char* new_text, cons
     SelectionStart = SelectionEnd = CursorPos;
 }
 
+// Password fields use a font owned by the context, with a single glyph used as fallback for every character.
+// The current baked font may be shared with contexts on other threads (see ImFontAtlas::ThreadLockFunc), so we only read it here, under a short lock.
 void ImGui::PushPasswordFont()
 {
     ImGuiContext& g = *GImGui;
-    ImFontBaked* backup = &g.InputTextPasswordFontBackupBaked;
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
-    ImFontGlyph* glyph = g.FontBaked->FindGlyph('*');
-    g.InputTextPasswordFontBackupFlags = g.Font->Flags;
-    backup->FallbackGlyphIndex = g.FontBaked->FallbackGlyphIndex;
-    backup->FallbackAdvanceX = g.FontBaked->FallbackAdvanceX;
-    backup->IndexLookup.swap(g.FontBaked->IndexLookup);
-    backup->IndexAdvanceX.swap(g.FontBaked->IndexAdvanceX);
-    g.Font->Flags |= ImFontFlags_NoLoadGlyphs;
-    g.FontBaked->FallbackGlyphIndex = g.FontBaked->Glyphs.index_from_ptr(glyph);
-    g.FontBaked->FallbackAdvanceX = glyph->AdvanceX;
+    ImFont* font = &g.InputTextPasswordFont;
+    ImFontBaked* baked = &g.InputTextPasswordFontBaked;
+    IM_ASSERT(g.InputTextPasswordFontBackupFont == NULL && "PushPasswordFont() calls cannot be nested!");
+    {
+        ImFontAtlasThreadLockScope lock(g.Font->ContainerAtlas);
+        ImFontGlyph glyph = *g.FontBaked->FindGlyph('*');
+        const float scale = g.FontBakedScale; // Current baked may have another size (see ImFontAtlas::BakedSizeBucketsPerOctave): store metrics at current size.
+        glyph.AdvanceX *= scale;
+        glyph.X0 *= scale; glyph.Y0 *= scale;
+        glyph.X1 *= scale; glyph.Y1 *= scale;
+        baked->Glyphs.resize(0);
+        baked->Glyphs.push_back(glyph);
+        baked->Ascent = g.FontBaked->Ascent * scale;
+        baked->Descent = g.FontBaked->Descent * scale;
+        baked->RasterizerDensity = font->CurrentRasterizerDensity = g.Font->CurrentRasterizerDensity;
+        font->EllipsisChar = g.Font->EllipsisChar;
+        font->FallbackChar = g.Font->FallbackChar;
+        font->LegacySize = g.Font->LegacySize;
+    }
+    baked->Size = g.FontSize;
+    baked->FallbackGlyphIndex = 0;
+    baked->FallbackAdvanceX = baked->Glyphs[0].AdvanceX;
+    baked->ContainerFont = font;
+    font->ContainerAtlas = g.Font->ContainerAtlas; // For locking, no glyph will be loaded into it.
+    font->Flags = ImFontFlags_NoLoadGlyphs;
+    font->LastBaked = baked;
+    font->LastBakedRequestedSize = g.FontSize;
+
+    g.InputTextPasswordFontBackupFont = g.Font;
+    g.InputTextPasswordFontBackupBaked = g.FontBaked;
+    g.InputTextPasswordFontBackupBakedScale = g.FontBakedScale;
+    g.Font = font;
+    g.FontBaked = baked;
+    g.FontBakedScale = 1.0f;
 }
 
 void ImGui::PopPasswordFont()
 {
     ImGuiContext& g = *GImGui;
-    ImFontBaked* backup = &g.InputTextPasswordFontBackupBaked;
-    g.Font->Flags = g.InputTextPasswordFontBackupFlags;
-    g.FontBaked->FallbackGlyphIndex = backup->FallbackGlyphIndex;
-    g.FontBaked->FallbackAdvanceX = backup->FallbackAdvanceX;
-    g.FontBaked->IndexLookup.swap(backup->IndexLookup);
-    g.FontBaked->IndexAdvanceX.swap(backup->IndexAdvanceX);
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
+    IM_ASSERT(g.InputTextPasswordFontBackupFont != NULL && g.Font == &g.InputTextPasswordFont);
+    g.Font = g.InputTextPasswordFontBackupFont;
+    g.FontBaked = g.InputTextPasswordFontBackupBaked;
+    g.FontBakedScale = g.InputTextPasswordFontBackupBakedScale;
+    g.InputTextPasswordFontBackupFont = NULL;
+    g.InputTextPasswordFontBackupBaked = NULL;
+    g.InputTextPasswordFont.ContainerAtlas = NULL; // Atlas may be destroyed before us: don't let ~ImFont() access it.
+    g.InputTextPasswordFont.LastBaked = NULL;
 }
 
 // Return false to discard a character.
@@ -5499,7 +5528,11 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             const ImU32 bg_color = GetColorU32(ImGuiCol_TextSelectedBg, render_cursor ? 1.0f : 0.6f); // FIXME: current code flow mandate that render_cursor is always true here, we are leaving the transparent one for tests.
             const float bg_offy_up = is_multiline ? 0.0f : -1.0f;    // FIXME: those offsets should be part of the style? they don't play so well with multi-line selection.
             const float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
-            const float bg_eol_width = IM_TRUNC(g.FontBaked->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
+            float bg_eol_width; // So we can see selected empty lines
+            {
+                ImFontAtlasThreadLockScope lock(g.Font->ContainerAtlas);
+                bg_eol_width = IM_TRUNC(g.FontBaked->GetCharAdvance((ImWchar)' ') * 0.50f);
+            }
 
             const char* text_selected_begin = buf_display + ImMin(state->Stb->select_start, state->Stb->select_end);
             const char* text_selected_end = buf_display + ImMax(state->Stb->select_start, state->Stb->select_end);
@@ -5556,6 +5589,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         ImRect cursor_screen_rect(cursor_screen_pos.x, cursor_screen_pos.y - g.FontSize + 0.5f, cursor_screen_pos.x + 1.0f, cursor_screen_pos.y - 1.5f);
         if (cursor_is_visible && cursor_screen_rect.Overlaps(clip_rect))
             draw_window->DrawList->AddLine(cursor_screen_rect.Min, cursor_screen_rect.GetBL(), GetColorU32(ImGuiCol_InputTextCursor), 1.0f); // FIXME-DPI: Cursor thickness (#7031)
+        if (g.IO.ConfigInputTextCursorBlink && cursor_screen_rect.Overlaps(clip_rect))
+        {
+            // Request a frame for the next blink (see io.WantRender)
+            const float cursor_anim_mod = ImFmod(state->CursorAnim, 1.20f);
+            SetNextFrameWantRender((state->CursorAnim <= 0.0f) ? 0.80f - state->CursorAnim : (cursor_anim_mod <= 0.80f) ? 0.80f - cursor_anim_mod : 1.20f - cursor_anim_mod);
+        }
 
         // Notify OS of text input position for advanced IME (-1 x offset so that Windows IME can cover our cursor. Bit of an extra nicety.)
         // This is required for some backends (SDL3) to start emitting character/text inputs.
@@ -8393,6 +8432,7 @@ ImGuiSelectionBasicStorage::ImGuiSelectionBasicStorage()
     UserData = NULL;
     AdapterIndexToStorageId = [](ImGuiSelectionBasicStorage*, int idx) { return (ImGuiID)idx; };
     _SelectionOrder = 1; // Always >0
+    _Storage.SetHashed(false); // We rely on pairs being sorted by key (batch operations use ImLowerBound() on Data[])
 }
 
 void ImGuiSelectionBasicStorage::Clear()
@@ -9279,6 +9319,8 @@ bool ImGui::BeginMenuEx(const char* label, const char* icon, bool enabled)
             want_open = true;
         else if (!menu_is_open && hovered && g.HoveredIdTimer >= 0.30f && g.MouseStationaryTimer >= 0.30f) // Hover to open (timer fallback)
             want_open = true;
+        else if (!menu_is_open && hovered) // Timer fallback may elapse without new inputs
+            SetNextFrameWantRender(ImMax(0.30f - g.HoveredIdTimer, 0.30f - g.MouseStationaryTimer));
         if (g.NavId == id && g.NavMoveDir == ImGuiDir_Right) // Nav-Right to open
         {
             want_open = want_open_nav_init = true;
@@ -9686,6 +9728,14 @@ void    ImGui::EndTabBar()
     if (tab_bar->BeginCount > 1)
         window->DC.CursorPos = tab_bar->BackupCursorPos;
 
+    // Added or removed tabs, queued selection/reorder and scrolling animation are processed by next frame's TabBarLayout()
+    bool want_layout_next_frame = tab_bar->TabsAddedNew || tab_bar->NextSelectedTabId != 0 || tab_bar->ReorderRequestTabId != 0 || tab_bar->ScrollingAnim != tab_bar->ScrollingTarget;
+    for (int tab_n = 0; tab_n < tab_bar->Tabs.Size && !want_layout_next_frame; tab_n++)
+        if (tab_bar->Tabs[tab_n].LastFrameVisible != g.FrameCount)
+            want_layout_next_frame = true;
+    if (want_layout_next_frame)
+        SetNextFrameWantRender();
+
     tab_bar->LastTabItemIdx = -1;
     if ((tab_bar->Flags & ImGuiTabBarFlags_DockNode) == 0)
         PopID();
@@ -3,6 +3,7 @@
 // Helper tool to turn a file into a C array, if you want to embed font data in your source code.
 
 // The data is first compressed with stb_compress() to reduce source code size.
+// With -lz4, the data is instead compressed in LZ4 block format, which decompresses several times faster (and is often smaller for fonts).
 // Then stored in a C array:
 // - Base85:   ~5 bytes of source code for 4 bytes of input data. 5 bytes stored in binary (suggested by @mmalex).
 // - As int:  ~11 bytes of source code for 4 bytes of input data. 4 bytes stored in binary. Endianness dependent, need swapping on big-endian CPU.
@@ -16,10 +17,11 @@
 // You can also find a precompiled Windows binary in the binary/demo package available from https://github.com/ocornut/imgui
 
 // Usage:
-//   binary_to_compressed_c.exe [-nocompress] [-nostatic] [-base85] <inputfile> <symbolname>
+//   binary_to_compressed_c.exe [-nocompress] [-lz4] [-nostatic] [-base85] <inputfile> <symbolname>
 // Usage example:
 //   # binary_to_compressed_c.exe myfont.ttf MyFont > myfont.cpp
 //   # binary_to_compressed_c.exe -base85 myfont.ttf MyFont > myfont.cpp
+//   # binary_to_compressed_c.exe -lz4 myfont.ttf MyFont > myfont.cpp
 // Note:
 //   Base85 encoding will be obsoleted by future version of Dear ImGui!
 
@@ -33,6 +35,7 @@
 typedef unsigned int stb_uint;
 typedef unsigned char stb_uchar;
 stb_uint stb_compress(stb_uchar* out, stb_uchar* in, stb_uint len);
+static int lz4_compress(unsigned char* out, const unsigned char* in, int len);
 
 enum SourceEncoding
 {
@@ -41,22 +44,33 @@ enum SourceEncoding
     SourceEncoding_Base85,
 };
 
-static bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, bool use_compression, bool use_static);
+enum Compression
+{
+    Compression_None,
+    Compression_Stb,        // stb_compress(): default
+    Compression_Lz4,        // LZ4 block format: faster to decompress
+};
+
+static bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, Compression compression, bool use_static);
 
 int main(int argc, char** argv)
 {
     if (argc < 3)
     {
-        printf("Syntax: %s [-u8|-u32|-base85] [-nocompress] [-nostatic] <inputfile> <symbolname>\n", argv[0]);
+        printf("Syntax: %s [-u8|-u32|-base85] [-nocompress|-lz4] [-nostatic] <inputfile> <symbolname>\n", argv[0]);
         printf("Source encoding types:\n");
         printf(" -u8     = ~12 bytes of source per 4 bytes of data. 4 bytes in binary.\n");
         printf(" -u32    = ~11 bytes of source per 4 bytes of data. 4 bytes in binary. Need endianness swapping on big-endian.\n");
         printf(" -base85 =  ~5 bytes of source per 4 bytes of data. 5 bytes in binary. Need decoder.\n");
+        printf("Compression types:\n");
+        printf(" (default)   = stb_compress().\n");
+        printf(" -lz4        = LZ4 block format. Decompresses several times faster. Requires Dear ImGui 1.92.5+.\n");
+        printf(" -nocompress = no compression.\n");
         return 0;
     }
 
     int argn = 1;
-    bool use_compression = true;
+    Compression compression = Compression_Stb;
     bool use_static = true;
     SourceEncoding source_encoding = SourceEncoding_U8; // New default
     while (argn < (argc - 2) && argv[argn][0] == '-')
@@ -64,7 +78,8 @@ int main(int argc, char** argv)
         if (strcmp(argv[argn], "-u8") == 0) { source_encoding = SourceEncoding_U8; argn++; }
         else if (strcmp(argv[argn], "-u32") == 0) { source_encoding = SourceEncoding_U32; argn++; }
         else if (strcmp(argv[argn], "-base85") == 0) { source_encoding = SourceEncoding_Base85; argn++; }
-        else if (strcmp(argv[argn], "-nocompress") == 0) { use_compression = false; argn++; }
+        else if (strcmp(argv[argn], "-nocompress") == 0) { compression = Compression_None; argn++; }
+        else if (strcmp(argv[argn], "-lz4") == 0) { compression = Compression_Lz4; argn++; }
         else if (strcmp(argv[argn], "-nostatic") == 0) { use_static = false; argn++; }
         else
         {
@@ -73,7 +88,7 @@ int main(int argc, char** argv)
         }
     }
 
-    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], source_encoding, use_compression, use_static);
+    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], source_encoding, compression, use_static);
     if (!ret)
         fprintf(stderr, "Error opening or reading file: '%s'\n", argv[argn]);
     return ret ? 0 : 1;
@@ -85,8 +100,9 @@ char Encode85Byte(unsigned int x)
     return (char)((x >= '\\') ? x + 1 : x);
 }
 
-bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, bool use_compression, bool use_static)
+bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, Compression compression, bool use_static)
 {
+    const bool use_compression = (compression != Compression_None);
     // Read file
     FILE* f = fopen(filename, "rb");
     if (!f) return false;
@@ -100,7 +116,11 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
     // Compress
     int maxlen = data_sz + 512 + (data_sz >> 2) + sizeof(int); // total guess
     char* compressed = use_compression ? new char[maxlen] : data;
-    int compressed_sz = use_compression ? stb_compress((stb_uchar*)compressed, (stb_uchar*)data, data_sz) : data_sz;
+    int compressed_sz = data_sz;
+    if (compression == Compression_Stb)
+        compressed_sz = stb_compress((stb_uchar*)compressed, (stb_uchar*)data, data_sz);
+    else if (compression == Compression_Lz4)
+        compressed_sz = lz4_compress((unsigned char*)compressed, (const unsigned char*)data, data_sz);
     if (use_compression)
         memset(compressed + compressed_sz, 0, maxlen - compressed_sz);
 
@@ -109,9 +129,10 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
     fprintf(out, "// File: '%s' (%d bytes)\n", filename, (int)data_sz);
     const char* static_str = use_static ? "static " : "";
     const char* compressed_str = use_compression ? "compressed_" : "";
+    const char* compression_arg = (compression == Compression_Lz4) ? "-lz4 " : (compression == Compression_None) ? "-nocompress " : "";
     if (source_encoding == SourceEncoding_Base85)
     {
-        fprintf(out, "// Exported using binary_to_compressed_c.exe -base85 \"%s\" %s\n", filename, symbol);
+        fprintf(out, "// Exported using binary_to_compressed_c.exe -base85 %s\"%s\" %s\n", compression_arg, filename, symbol);
         fprintf(out, "%sconst char %s_%sdata_base85[%d+1] =\n    \"", static_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*5);
         char prev_c = 0;
         for (int src_i = 0; src_i < compressed_sz; src_i += 4)
@@ -132,7 +153,7 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
     else if (source_encoding == SourceEncoding_U8)
     {
         // As individual bytes, not subject to endianness issues.
-        fprintf(out, "// Exported using binary_to_compressed_c.exe -u8 \"%s\" %s\n", filename, symbol);
+        fprintf(out, "// Exported using binary_to_compressed_c.exe -u8 %s\"%s\" %s\n", compression_arg, filename, symbol);
         fprintf(out, "%sconst unsigned int %s_%ssize = %d;\n", static_str, symbol, compressed_str, (int)compressed_sz);
         fprintf(out, "%sconst unsigned char %s_%sdata[%d] =\n{", static_str, symbol, compressed_str, (int)compressed_sz);
         int column = 0;
@@ -150,7 +171,7 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
     else if (source_encoding == SourceEncoding_U32)
     {
         // As integers
-        fprintf(out, "// Exported using binary_to_compressed_c.exe -u32 \"%s\" %s\n", filename, symbol);
+        fprintf(out, "// Exported using binary_to_compressed_c.exe -u32 %s\"%s\" %s\n", compression_arg, filename, symbol);
         fprintf(out, "%sconst unsigned int %s_%ssize = %d;\n", static_str, symbol, compressed_str, (int)compressed_sz);
         fprintf(out, "%sconst unsigned int %s_%sdata[%d/4] =\n{", static_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*4);
         int column = 0;
@@ -422,3 +443,131 @@ stb_uint stb_compress(stb_uchar *out, stb_uchar *input, stb_uint length)
 
     return (stb_uint)(stb__out - out);
 }
+
+// LZ4 block format compressor
+// See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+// Output is prefixed with an 8 bytes header: 'L','Z','4',0 followed by the big-endian decompressed size.
+// This is an offline tool, so we use long hash chains + lazy matching to get a good ratio out of the format.
+// The decoder is ImFontAtlas::AddFontFromMemoryCompressedTTF() in imgui_draw.cpp.
+
+#define LZ4_MIN_MATCH       4
+#define LZ4_LAST_LITERALS   5       // The last 5 bytes are always literals
+#define LZ4_MF_LIMIT        12      // The last match must start at least 12 bytes before end of block
+#define LZ4_MAX_DISTANCE    65535
+#define LZ4_HASH_BITS       16
+#define LZ4_MAX_ATTEMPTS    4096    // Maximum candidates visited per position (bounds time spent on highly repetitive data)
+
+static unsigned int lz4_hash(const unsigned char* p)
+{
+    unsigned int v = p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+    return (v * 2654435761u) >> (32 - LZ4_HASH_BITS);
+}
+
+static unsigned char* lz4_write_length(unsigned char* op, int len)
+{
+    for (; len >= 255; len -= 255)
+        *op++ = 255;
+    *op++ = (unsigned char)len;
+    return op;
+}
+
+static unsigned char* lz4_write_sequence(unsigned char* op, const unsigned char* literals, int literals_len, int match_offset, int match_len)
+{
+    unsigned char* token = op++;
+    *token = (unsigned char)((literals_len >= 15 ? 15 : literals_len) << 4);
+    if (literals_len >= 15)
+        op = lz4_write_length(op, literals_len - 15);
+    memcpy(op, literals, literals_len);
+    op += literals_len;
+    if (match_len == 0) // Last sequence
+        return op;
+    *op++ = (unsigned char)(match_offset & 0xFF);
+    *op++ = (unsigned char)(match_offset >> 8);
+    match_len -= LZ4_MIN_MATCH;
+    *token |= (unsigned char)(match_len >= 15 ? 15 : match_len);
+    if (match_len >= 15)
+        op = lz4_write_length(op, match_len - 15);
+    return op;
+}
+
+static int lz4_find_match(const unsigned char* in, int pos, int match_end, const int* head, const int* chain, int* out_offset)
+{
+    int best_len = 0;
+    int attempts = 0;
+    for (int cand = head[lz4_hash(in + pos)]; cand >= 0 && pos - cand <= LZ4_MAX_DISTANCE && attempts < LZ4_MAX_ATTEMPTS; cand = chain[cand], attempts++)
+    {
+        if (in[cand + best_len] != in[pos + best_len])
+            continue;
+        int len = 0;
+        while (pos + len < match_end && in[cand + len] == in[pos + len])
+            len++;
+        if (len > best_len)
+        {
+            best_len = len;
+            *out_offset = pos - cand;
+            if (pos + len == match_end)
+                break;
+        }
+    }
+    return best_len >= LZ4_MIN_MATCH ? best_len : 0;
+}
+
+static int lz4_compress(unsigned char* out, const unsigned char* in, int len)
+{
+    int* head = new int[1 << LZ4_HASH_BITS];
+    int* chain = new int[len > 0 ? len : 1];
+    for (int n = 0; n < (1 << LZ4_HASH_BITS); n++)
+        head[n] = -1;
+
+    // Header
+    unsigned char* op = out;
+    *op++ = 'L'; *op++ = 'Z'; *op++ = '4'; *op++ = 0;
+    *op++ = (unsigned char)(len >> 24); *op++ = (unsigned char)(len >> 16); *op++ = (unsigned char)(len >> 8); *op++ = (unsigned char)len;
+
+    const int match_start_limit = len - LZ4_MF_LIMIT;
+    const int match_end = len - LZ4_LAST_LITERALS;
+    int anchor = 0;
+    int inserted = 0;
+    int pos = 0;
+    while (pos < match_start_limit)
+    {
+        for (; inserted < pos; inserted++)
+        {
+            unsigned int h = lz4_hash(in + inserted);
+            chain[inserted] = head[h];
+            head[h] = inserted;
+        }
+        int offset = 0;
+        int match_len = lz4_find_match(in, pos, match_end, head, chain, &offset);
+        if (match_len == 0)
+        {
+            pos++;
+            continue;
+        }
+
+        // Lazy matching: emit a literal instead if the next position has a longer match
+        if (pos + 1 < match_start_limit)
+        {
+            unsigned int h = lz4_hash(in + pos);
+            chain[pos] = head[h];
+            head[h] = pos;
+            inserted = pos + 1;
+            int next_offset = 0;
+            int next_match_len = lz4_find_match(in, pos + 1, match_end, head, chain, &next_offset);
+            if (next_match_len > match_len + 1)
+            {
+                pos++;
+                continue;
+            }
+        }
+
+        op = lz4_write_sequence(op, in + anchor, pos - anchor, offset, match_len);
+        pos += match_len;
+        anchor = pos;
+    }
+    op = lz4_write_sequence(op, in + anchor, len - anchor, 0, 0);
+
+    delete[] head;
+    delete[] chain;
+    return (int)(op - out);
+}
@@ -7,6 +7,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026/10/19: added FontSrcGetCodepointRanges() to build codepoint -> source index of merged fonts.
+//  2026/10/19: added FontBakedLoadGlyphs() batch entry point.
+//  2026/10/19: render glyphs directly into atlas texture without an intermediate buffer. only re-activate FT_Size when switching baked size.
 //  2025/06/11: refactored for the new ImFontLoader architecture, and ImGuiBackendFlags_RendererHasTextures support.
 //  2024/10/17: added plutosvg support for SVG Fonts (seems faster/better than lunasvg). Enable by using '#define IMGUI_ENABLE_FREETYPE_PLUTOSVG'. (#7927)
 //  2023/11/13: added support for ImFontConfig::RasterizationDensity field for scaling render density without scaling metrics.
@@ -162,7 +165,6 @@ struct ImGui_ImplFreeType_FontSrcData
     FT_Face                         FtFace;
     ImGuiFreeTypeLoaderFlags        UserFlags;          // = ImFontConfig::FontLoaderFlags
     FT_Int32                        LoadFlags;
-    ImFontBaked*                    BakedLastActivated;
 };
 
 // Stored in ImFontBaked::FontLoaderDatas: pointer to SourcesCount instances of this. ALLOCATED BY CORE.
@@ -219,12 +221,8 @@ void ImGui_ImplFreeType_FontSrcData::CloseFont()
     }
 }
 
-static const FT_Glyph_Metrics* ImGui_ImplFreeType_LoadGlyph(ImGui_ImplFreeType_FontSrcData* src_data, uint32_t codepoint)
+static const FT_Glyph_Metrics* ImGui_ImplFreeType_LoadGlyph(ImGui_ImplFreeType_FontSrcData* src_data, uint32_t glyph_index)
 {
-    uint32_t glyph_index = FT_Get_Char_Index(src_data->FtFace, codepoint);
-    if (glyph_index == 0)
-        return nullptr;
-
     // If this crash for you: FreeType 2.11.0 has a crash bug on some bitmap/colored fonts.
     // - https://gitlab.freedesktop.org/freetype/freetype/-/issues/1076
     // - https://github.com/ocornut/imgui/issues/4567
@@ -260,21 +258,33 @@ static const FT_Glyph_Metrics* ImGui_ImplFreeType_LoadGlyph(ImGui_ImplFreeType_F
     return &slot->metrics;
 }
 
-static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, uint32_t* dst, uint32_t dst_pitch)
+// Blit directly into atlas texture (no intermediate buffer).
+static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, unsigned char* dst, int dst_pitch, ImTextureFormat dst_fmt)
 {
     IM_ASSERT(ft_bitmap != nullptr);
     const uint32_t w = ft_bitmap->width;
     const uint32_t h = ft_bitmap->rows;
     const uint8_t* src = ft_bitmap->buffer;
-    const uint32_t src_pitch = ft_bitmap->pitch;
+    const int src_pitch = ft_bitmap->pitch;
 
     switch (ft_bitmap->pixel_mode)
     {
     case FT_PIXEL_MODE_GRAY: // Grayscale image, 1 byte per pixel.
         {
-            for (uint32_t y = 0; y < h; y++, src += src_pitch, dst += dst_pitch)
-                for (uint32_t x = 0; x < w; x++)
-                    dst[x] = IM_COL32(255, 255, 255, src[x]);
+            if (dst_fmt == ImTextureFormat_Alpha8)
+            {
+                for (uint32_t y = 0; y < h; y++, src += src_pitch, dst += dst_pitch)
+                    memcpy(dst, src, w);
+            }
+            else
+            {
+                for (uint32_t y = 0; y < h; y++, src += src_pitch, dst += dst_pitch)
+                {
+                    ImU32* dst_p = (ImU32*)(void*)dst;
+                    for (uint32_t x = 0; x < w; x++)
+                        dst_p[x] = IM_COL32(255, 255, 255, src[x]);
+                }
+            }
             break;
         }
     case FT_PIXEL_MODE_MONO: // Monochrome image, 1 bit per pixel. The bits in each byte are ordered from MSB to LSB.
@@ -287,7 +297,11 @@ static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, uint32_t* d
                 {
                     if ((x & 7) == 0)
                         bits = *bits_ptr++;
-                    dst[x] = IM_COL32(255, 255, 255, (bits & 0x80) ? 255 : 0);
+                    const uint8_t a = (bits & 0x80) ? 255 : 0;
+                    if (dst_fmt == ImTextureFormat_Alpha8)
+                        dst[x] = a;
+                    else
+                        ((ImU32*)(void*)dst)[x] = IM_COL32(255, 255, 255, a);
                 }
             }
             break;
@@ -300,7 +314,10 @@ static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, uint32_t* d
                 for (uint32_t x = 0; x < w; x++)
                 {
                     uint8_t r = src[x * 4 + 2], g = src[x * 4 + 1], b = src[x * 4], a = src[x * 4 + 3];
-                    dst[x] = IM_COL32(DE_MULTIPLY(r, a), DE_MULTIPLY(g, a), DE_MULTIPLY(b, a), a);
+                    if (dst_fmt == ImTextureFormat_Alpha8)
+                        dst[x] = a;
+                    else
+                        ((ImU32*)(void*)dst)[x] = IM_COL32(DE_MULTIPLY(r, a), DE_MULTIPLY(g, a), DE_MULTIPLY(b, a), a);
                 }
             #undef DE_MULTIPLY
             break;
@@ -426,9 +443,9 @@ static bool ImGui_ImplFreeType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig* s
         size *= (src->SizePixels / baked->ContainerFont->Sources[0]->SizePixels);
 
     ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
-    bd_font_data->BakedLastActivated = baked;
 
     // We use one FT_Size per (source + baked) combination.
+    // Size is requested once here, FontBakedLoadGlyph() only needs to re-activate it when switching between baked sizes.
     ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
     IM_ASSERT(bd_baked_data != nullptr);
     IM_PLACEMENT_NEW(bd_baked_data) ImGui_ImplFreeType_FontSrcBakedData();
@@ -475,28 +492,50 @@ static void ImGui_ImplFreeType_FontBakedDestroy(ImFontAtlas* atlas, ImFontConfig
     bd_baked_data->~ImGui_ImplFreeType_FontSrcBakedData(); // ~IM_PLACEMENT_DELETE()
 }
 
-static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+// Per-call setup, shared by all glyphs loaded by a FontBakedLoadGlyph()/FontBakedLoadGlyphs() call.
+struct ImGui_ImplFreeType_GlyphLoadParams
+{
+    float           RasterizerDensity;
+    float           FontOffX, FontOffY;
+    FT_Render_Mode  RenderMode;
+};
+
+static void ImGui_ImplFreeType_InitGlyphLoadParams(ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImGui_ImplFreeType_GlyphLoadParams* p)
+{
+    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+
+    // Activate current size (comparing FT_Size is cheap and robust to ImFontBaked being recycled at the same address)
+    ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
+    if (bd_font_data->FtFace->size != bd_baked_data->FtSize)
+        FT_Activate_Size(bd_baked_data->FtSize);
+
+    p->RasterizerDensity = src->RasterizerDensity * baked->RasterizerDensity;
+    p->RenderMode = (bd_font_data->UserFlags & ImGuiFreeTypeLoaderFlags_Monochrome) ? FT_RENDER_MODE_MONO : FT_RENDER_MODE_NORMAL;
+
+    const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
+    const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
+    p->FontOffX = (src->GlyphOffset.x * offsets_scale);
+    p->FontOffY = (src->GlyphOffset.y * offsets_scale) + baked->Ascent;
+    if (src->PixelSnapH) // Snap scaled offset. This is to mitigate backward compatibility issues for GlyphOffset, but a better design would be welcome.
+        p->FontOffX = IM_ROUND(p->FontOffX);
+    if (src->PixelSnapV)
+        p->FontOffY = IM_ROUND(p->FontOffY);
+}
+
+static bool ImGui_ImplFreeType_LoadGlyphEx(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, const ImGui_ImplFreeType_GlyphLoadParams* p, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
 {
     ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
     uint32_t glyph_index = FT_Get_Char_Index(bd_font_data->FtFace, codepoint);
     if (glyph_index == 0)
         return false;
 
-    if (bd_font_data->BakedLastActivated != baked) // <-- could use id
-    {
-        // Activate current size
-        ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
-        FT_Activate_Size(bd_baked_data->FtSize);
-        bd_font_data->BakedLastActivated = baked;
-    }
-
-    const FT_Glyph_Metrics* metrics = ImGui_ImplFreeType_LoadGlyph(bd_font_data, codepoint);
+    const FT_Glyph_Metrics* metrics = ImGui_ImplFreeType_LoadGlyph(bd_font_data, glyph_index);
     if (metrics == nullptr)
         return false;
 
     FT_Face face = bd_font_data->FtFace;
     FT_GlyphSlot slot = face->glyph;
-    const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+    const float rasterizer_density = p->RasterizerDensity;
 
     // Load metrics only mode
     const float advance_x = (slot->advance.x / FT_SCALEFACTOR) / rasterizer_density;
@@ -508,8 +547,7 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
     }
 
     // Render glyph into a bitmap (currently held by FreeType)
-    FT_Render_Mode render_mode = (bd_font_data->UserFlags & ImGuiFreeTypeLoaderFlags_Monochrome) ? FT_RENDER_MODE_MONO : FT_RENDER_MODE_NORMAL;
-    FT_Error error = FT_Render_Glyph(slot, render_mode);
+    FT_Error error = FT_Render_Glyph(slot, p->RenderMode);
     const FT_Bitmap* ft_bitmap = &slot->bitmap;
     if (error != 0 || ft_bitmap == nullptr)
         return false;
@@ -534,19 +572,12 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
         }
         ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
 
-        // Render pixels to our temporary buffer
-        atlas->Builder->TempBuffer.resize(w * h * 4);
-        uint32_t* temp_buffer = (uint32_t*)atlas->Builder->TempBuffer.Data;
-        ImGui_ImplFreeType_BlitGlyph(ft_bitmap, temp_buffer, w);
-
-        const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
-        const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
-        float font_off_x = (src->GlyphOffset.x * offsets_scale);
-        float font_off_y = (src->GlyphOffset.y * offsets_scale) + baked->Ascent;
-        if (src->PixelSnapH) // Snap scaled offset. This is to mitigate backward compatibility issues for GlyphOffset, but a better design would be welcome.
-            font_off_x = IM_ROUND(font_off_x);
-        if (src->PixelSnapV)
-            font_off_y = IM_ROUND(font_off_y);
+        // Render pixels directly into the texture
+        ImTextureData* tex = atlas->TexData;
+        ImGui_ImplFreeType_BlitGlyph(ft_bitmap, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->GetPitch(), tex->Format);
+
+        const float font_off_x = p->FontOffX;
+        const float font_off_y = p->FontOffY;
         float recip_h = 1.0f / rasterizer_density;
         float recip_v = 1.0f / rasterizer_density;
 
@@ -560,12 +591,36 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
         out_glyph->Visible = true;
         out_glyph->Colored = (ft_bitmap->pixel_mode == FT_PIXEL_MODE_BGRA);
         out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, (const unsigned char*)temp_buffer, ImTextureFormat_RGBA32, w * 4);
+        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, nullptr, tex->Format, tex->GetPitch()); // Pixels already written in place
     }
 
     return true;
 }
 
+static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+{
+    ImGui_ImplFreeType_GlyphLoadParams params;
+    ImGui_ImplFreeType_InitGlyphLoadParams(src, baked, loader_data_for_baked_src, &params);
+    return ImGui_ImplFreeType_LoadGlyphEx(atlas, src, baked, &params, codepoint, out_glyph, out_advance_x);
+}
+
+static int ImGui_ImplFreeType_FontBakedLoadGlyphs(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, const ImWchar* codepoints, int codepoints_count, ImVector<ImFontGlyph>* out_glyphs)
+{
+    ImGui_ImplFreeType_GlyphLoadParams params;
+    ImGui_ImplFreeType_InitGlyphLoadParams(src, baked, loader_data_for_baked_src, &params);
+    int loaded_count = 0;
+    for (int n = 0; n < codepoints_count; n++)
+    {
+        ImFontGlyph glyph;
+        if (ImGui_ImplFreeType_LoadGlyphEx(atlas, src, baked, &params, codepoints[n], &glyph, nullptr))
+        {
+            out_glyphs->push_back(glyph);
+            loaded_count++;
+        }
+    }
+    return loaded_count;
+}
+
 static bool ImGui_ImplFreetype_FontSrcContainsGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImWchar codepoint)
 {
     IM_UNUSED(atlas);
@@ -574,19 +629,45 @@ static bool ImGui_ImplFreetype_FontSrcContainsGlyph(ImFontAtlas* atlas, ImFontCo
     return glyph_index != 0;
 }
 
-const ImFontLoader* ImGuiFreeType::GetFontLoader()
+static void ImGui_ImplFreeType_FontSrcGetCodepointRanges(ImFontAtlas* atlas, ImFontConfig* src, ImVector<ImWchar>* out_ranges)
 {
-    static ImFontLoader loader;
+    IM_UNUSED(atlas);
+    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+    const int ranges_start = out_ranges->Size;
+    FT_UInt glyph_index = 0;
+    for (FT_ULong c = FT_Get_First_Char(bd_font_data->FtFace, &glyph_index); glyph_index != 0 && c <= IM_UNICODE_CODEPOINT_MAX; c = FT_Get_Next_Char(bd_font_data->FtFace, c, &glyph_index))
+    {
+        if (out_ranges->Size > ranges_start && (FT_ULong)out_ranges->back() + 1 == c)
+            out_ranges->back() = (ImWchar)c;
+        else
+        {
+            out_ranges->push_back((ImWchar)c);
+            out_ranges->push_back((ImWchar)c);
+        }
+    }
+}
+
+static ImFontLoader ImGui_ImplFreeType_CreateFontLoader()
+{
+    ImFontLoader loader;
     loader.Name = "FreeType";
     loader.LoaderInit = ImGui_ImplFreeType_LoaderInit;
     loader.LoaderShutdown = ImGui_ImplFreeType_LoaderShutdown;
     loader.FontSrcInit = ImGui_ImplFreeType_FontSrcInit;
     loader.FontSrcDestroy = ImGui_ImplFreeType_FontSrcDestroy;
     loader.FontSrcContainsGlyph = ImGui_ImplFreetype_FontSrcContainsGlyph;
+    loader.FontSrcGetCodepointRanges = ImGui_ImplFreeType_FontSrcGetCodepointRanges;
     loader.FontBakedInit = ImGui_ImplFreeType_FontBakedInit;
     loader.FontBakedDestroy = ImGui_ImplFreeType_FontBakedDestroy;
     loader.FontBakedLoadGlyph = ImGui_ImplFreeType_FontBakedLoadGlyph;
+    loader.FontBakedLoadGlyphs = ImGui_ImplFreeType_FontBakedLoadGlyphs;
     loader.FontBakedSrcLoaderDataSize = sizeof(ImGui_ImplFreeType_FontSrcBakedData);
+    return loader;
+}
+
+const ImFontLoader* ImGuiFreeType::GetFontLoader()
+{
+    static const ImFontLoader loader = ImGui_ImplFreeType_CreateFontLoader(); // Initialized once (thread-safe since C++11)
     return &loader;
 }
 
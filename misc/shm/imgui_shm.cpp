@@ -0,0 +1,984 @@
+// dear imgui: shared memory transport for ImDrawData (out-of-process rendering)
+// (code)
+
+// CHANGELOG
+//  2026/10/19: initial version.
+
+// About the design:
+// - The shared memory region holds a header followed by 'SlotCount' slots of 'SlotSize' bytes. A slot holds one frame.
+// - Each slot has a state (Free/Writing/Published/Held) which is only modified with atomic operations.
+//   The writer takes a Free slot (or takes back an unconsumed Published slot), fills it, then marks it Published.
+//   The reader moves the most recent Published slot to Held, and back to Free when acquiring the next one.
+//   With 3 slots the writer always finds a Free slot. With 2 slots, the writer may need to wait for the reader to release a slot.
+// - Vertices/indices/commands are referenced in place by the reader: its ImDrawList instances have their ImVector<> pointing into the slot.
+// - Textures are replicated: the writer acts as the producer's renderer backend (honoring ImTextureData requests),
+//   the reader owns a copy of each texture and emits requests for its own renderer backend. As the reader may skip frames,
+//   the writer keeps resending texture data until 'AcquiredSeq' tells that a frame containing it has been acquired.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_shm.h"
+#include "imgui_internal.h"     // ImHashData, ImAtomicXXX, ImFormatString
+
+#ifndef IMGUI_ENABLE_ATOMICS
+#error "imgui_shm requires atomic operations support (see IMGUI_ENABLE_ATOMICS in imgui_internal.h)"
+#endif
+
+#if !defined(_WIN32)
+#include <fcntl.h>              // O_CREAT, O_RDWR
+#include <sys/mman.h>           // shm_open, mmap
+#include <sys/stat.h>           // fstat
+#include <unistd.h>             // ftruncate, close
+#endif
+#include <stddef.h>             // offsetof
+#include <stdint.h>             // intptr_t
+
+// Visual Studio warnings
+#ifdef _MSC_VER
+#pragma warning (push)
+#pragma warning (disable: 4127)     // condition expression is constant
+#endif
+
+// Clang/GCC warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wold-style-cast"         // warning: use of old-style cast
+#pragma clang diagnostic ignored "-Wsign-conversion"        // warning: implicit conversion changes signedness
+#elif defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wclass-memaccess"          // [__GNUC__ >= 8] warning: 'memset/memcpy' clearing/writing an object of type 'xxxx' with no trivial copy-assignment; use assignment or value-initialization instead
+#endif
+
+//-------------------------------------------------------------------------
+// Shared memory layout
+//-------------------------------------------------------------------------
+
+#define IMGUI_SHM_MAGIC         0x4D485349  // "ISHM"
+#define IMGUI_SHM_VERSION       1
+#define IMGUI_SHM_SLOTS_MAX     4
+#define IMGUI_SHM_ALIGN         16
+
+enum ImGuiShmSlotState
+{
+    ImGuiShmSlotState_Free,
+    ImGuiShmSlotState_Writing,
+    ImGuiShmSlotState_Published,
+    ImGuiShmSlotState_Held,
+};
+
+enum ImGuiShmTextureOp
+{
+    ImGuiShmTextureOp_Create,                   // Full pixels follow
+    ImGuiShmTextureOp_Update,                   // Rectangles + their pixels follow
+    ImGuiShmTextureOp_Destroy,
+};
+
+struct ImGuiShmHeader
+{
+    ImU32           Magic;                      // Written last by the writer: reader won't use the region until this is valid
+    ImU32           Version;
+    ImU32           LayoutHash;                 // Hash of relevant structures sizes/offsets, to verify both processes were built with compatible settings
+    ImU32           SlotCount;
+    ImU32           SlotSize;
+    ImU32           SlotsOffset;
+    volatile ImU32  PublishedSeq;               // Sequence number of last published frame (0: none). Written by writer.
+    volatile ImU32  AcquiredSeq;                // Sequence number of last acquired frame (0: none). Written by reader.
+    volatile ImU32  SlotState[IMGUI_SHM_SLOTS_MAX];
+    volatile ImU32  SlotSeq[IMGUI_SHM_SLOTS_MAX];
+};
+
+// All offsets are relative to the start of the slot
+struct ImGuiShmFrame
+{
+    ImU32           Seq;
+    ImU32           Size;                       // Used bytes
+    ImVec2          DisplayPos;
+    ImVec2          DisplaySize;
+    ImVec2          FramebufferScale;
+    int             TotalVtxCount;
+    int             TotalIdxCount;
+    int             ListsCount;
+    ImU32           ListsOffset;                // ImGuiShmList[ListsCount]
+    int             TexturesCount;
+    ImU32           TexturesOffset;             // ImGuiShmTexture[TexturesCount]
+};
+
+struct ImGuiShmList
+{
+    ImDrawListFlags Flags;
+    int             CmdCount;
+    int             VtxCount;
+    int             IdxCount;
+    ImU32           CmdOffset;                  // ImDrawCmd[CmdCount]
+    ImU32           CmdTexOffset;               // ImU32[CmdCount]: texture identifier for ImDrawCmd with a ImTextureData reference (TexRef._TexData), 0 otherwise.
+    ImU32           VtxOffset;                  // ImDrawVert[VtxCount]
+    ImU32           IdxOffset;                  // ImDrawIdx[IdxCount]
+};
+
+struct ImGuiShmTexture
+{
+    ImU32           ID;                         // Identifier allocated by the writer (not ImTextureData::UniqueID which is only unique per atlas)
+    int             Op;                         // ImGuiShmTextureOp
+    int             Format;                     // ImTextureFormat
+    int             Width;
+    int             Height;
+    int             RectsCount;                 // For _Update
+    ImU32           RectsOffset;                // ImTextureRect[RectsCount]
+    ImU32           PixelsOffset;               // For _Create: Width*Height pixels. For _Update: pixels for each rectangle, packed.
+};
+
+static ImU32 ImGuiShm_GetLayoutHash()
+{
+    const ImU32 layout[] =
+    {
+        IMGUI_SHM_VERSION, (ImU32)sizeof(void*), (ImU32)sizeof(ImDrawVert), (ImU32)sizeof(ImDrawIdx), (ImU32)sizeof(ImDrawCmd), (ImU32)sizeof(ImTextureID),
+        (ImU32)offsetof(ImDrawVert, uv), (ImU32)offsetof(ImDrawVert, col), (ImU32)sizeof(ImGuiShmFrame), (ImU32)sizeof(ImGuiShmList), (ImU32)sizeof(ImGuiShmTexture),
+    };
+    return ImHashData(layout, sizeof(layout));
+}
+
+static inline ImU32 ImGuiShm_AlignOffset(size_t offset)     { return (ImU32)((offset + IMGUI_SHM_ALIGN - 1) & ~(size_t)(IMGUI_SHM_ALIGN - 1)); }
+static inline bool  ImGuiShm_SeqIsNewer(ImU32 a, ImU32 b)   { return (int)(a - b) > 0; } // Handle wrapping
+static inline char* ImGuiShm_GetSlot(ImGuiShmHeader* header, int slot_n) { return (char*)header + header->SlotsOffset + (size_t)slot_n * header->SlotSize; }
+
+size_t ImGuiShm::GetMemorySize(size_t slot_size, int slot_count)
+{
+    return ImGuiShm_AlignOffset(sizeof(ImGuiShmHeader)) + ImGuiShm_AlignOffset(slot_size) * slot_count;
+}
+
+//-------------------------------------------------------------------------
+// Platform: named shared memory
+//-------------------------------------------------------------------------
+// - Only implemented with POSIX shm_open()/mmap().
+// - Windows is not supported yet: CreateWriter()/CreateReader() return NULL. Map memory yourself (e.g. CreateFileMapping()/MapViewOfFile())
+//   and use CreateWriterInMemory()/CreateReaderInMemory().
+
+struct ImGuiShmMapping
+{
+    void*           Memory;
+    size_t          Size;
+    bool            IsOwner;                    // Created by us: unlink name on destruction
+    char            Name[64];
+};
+
+static bool ImGuiShm_PlatformCreate(ImGuiShmMapping* mapping, const char* name, size_t size)
+{
+    memset(mapping, 0, sizeof(*mapping));
+#if defined(_WIN32)
+    IM_UNUSED(name);
+    IM_UNUSED(size);
+    return false;
+#else
+    ImFormatString(mapping->Name, IM_ARRAYSIZE(mapping->Name), "/%s", name);
+    ::shm_unlink(mapping->Name); // Remove stale region, e.g. left by a crashed producer
+    int fd = ::shm_open(mapping->Name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+        return false;
+    if (::ftruncate(fd, (off_t)size) != 0)
+    {
+        ::close(fd);
+        ::shm_unlink(mapping->Name);
+        return false;
+    }
+    void* memory = ::mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED)
+    {
+        ::shm_unlink(mapping->Name);
+        return false;
+    }
+    mapping->Memory = memory;
+    mapping->Size = size;
+    mapping->IsOwner = true;
+    return true;
+#endif
+}
+
+static bool ImGuiShm_PlatformOpen(ImGuiShmMapping* mapping, const char* name)
+{
+    memset(mapping, 0, sizeof(*mapping));
+#if defined(_WIN32)
+    IM_UNUSED(name);
+    return false;
+#else
+    ImFormatString(mapping->Name, IM_ARRAYSIZE(mapping->Name), "/%s", name);
+    int fd = ::shm_open(mapping->Name, O_RDWR, 0600);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(ImGuiShmHeader)) // Size is 0 until the writer is done creating it
+    {
+        ::close(fd);
+        return false;
+    }
+    size_t size = (size_t)st.st_size;
+    void* memory = ::mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED)
+        return false;
+    mapping->Memory = memory;
+    mapping->Size = size;
+    return true;
+#endif
+}
+
+static void ImGuiShm_PlatformClose(ImGuiShmMapping* mapping)
+{
+    if (mapping->Name[0] == 0) // Memory provided by user
+        return;
+#if !defined(_WIN32)
+    ::munmap(mapping->Memory, mapping->Size);
+    if (mapping->IsOwner)
+        ::shm_unlink(mapping->Name);
+#endif
+    memset(mapping, 0, sizeof(*mapping));
+}
+
+//-------------------------------------------------------------------------
+// Writer
+//-------------------------------------------------------------------------
+
+struct ImGuiShmWriterTexture
+{
+    ImU32                   ID;
+    ImTextureData*          Tex;                // NULL once destroyed
+    ImU32                   CreateSeq;          // != 0: creation not acknowledged by reader yet
+    ImU32                   DestroySeq;         // != 0: destruction not acknowledged by reader yet
+    ImVector<ImTextureRect> PendingRects;       // Updates not acknowledged by reader yet
+    ImVector<ImU32>         PendingRectsSeq;
+
+    ImGuiShmWriterTexture() { ID = 0; Tex = NULL; CreateSeq = DestroySeq = 0; }
+};
+
+struct ImGuiShmWriter
+{
+    ImGuiShmMapping         Mapping;
+    ImGuiShmHeader*         Header;
+    ImU32                   Seq;                // Sequence number of last published frame
+    int                     PublishedSlot;      // Slot we last published, may have been acquired by reader since.
+    ImU32                   NextTextureID;
+    ImVector<ImGuiShmWriterTexture*> Textures;
+    ImGuiStorage            TexturesMap;        // ImTextureData* -> ImGuiShmWriterTexture*
+
+    ImGuiShmWriter()        { memset(&Mapping, 0, sizeof(Mapping)); Header = NULL; Seq = 0; PublishedSlot = -1; NextTextureID = 1; }
+    ~ImGuiShmWriter()       { for (ImGuiShmWriterTexture* entry : Textures) IM_DELETE(entry); }
+};
+
+static ImGuiShmWriter* ImGuiShm_CreateWriter(const ImGuiShmMapping& mapping, int slot_count)
+{
+    IM_ASSERT(slot_count >= 2 && slot_count <= IMGUI_SHM_SLOTS_MAX);
+    const ImU32 slots_offset = ImGuiShm_AlignOffset(sizeof(ImGuiShmHeader));
+    const size_t slot_size = ((mapping.Size - slots_offset) / slot_count) & ~(size_t)(IMGUI_SHM_ALIGN - 1);
+    IM_ASSERT(mapping.Size > slots_offset && slot_size >= sizeof(ImGuiShmFrame) && slot_size <= 0x7FFFFFFF);
+
+    ImGuiShmWriter* writer = IM_NEW(ImGuiShmWriter)();
+    writer->Mapping = mapping;
+    ImGuiShmHeader* header = writer->Header = (ImGuiShmHeader*)mapping.Memory;
+    memset((void*)header, 0, sizeof(*header));
+    header->Version = IMGUI_SHM_VERSION;
+    header->LayoutHash = ImGuiShm_GetLayoutHash();
+    header->SlotCount = (ImU32)slot_count;
+    header->SlotSize = (ImU32)slot_size;
+    header->SlotsOffset = slots_offset;
+    for (int slot_n = 0; slot_n < IMGUI_SHM_SLOTS_MAX; slot_n++)
+        ImAtomicStore(&header->SlotState[slot_n], ImGuiShmSlotState_Free);
+    ImAtomicStore(&header->Magic, IMGUI_SHM_MAGIC);
+    return writer;
+}
+
+ImGuiShmWriter* ImGuiShm::CreateWriter(const char* name, size_t slot_size, int slot_count)
+{
+    ImGuiShmMapping mapping;
+    if (!ImGuiShm_PlatformCreate(&mapping, name, GetMemorySize(slot_size, slot_count)))
+        return NULL;
+    return ImGuiShm_CreateWriter(mapping, slot_count);
+}
+
+ImGuiShmWriter* ImGuiShm::CreateWriterInMemory(void* memory, size_t memory_size, int slot_count)
+{
+    IM_ASSERT(((size_t)memory & (IMGUI_SHM_ALIGN - 1)) == 0 && "Memory needs to be aligned.");
+    ImGuiShmMapping mapping;
+    memset(&mapping, 0, sizeof(mapping));
+    mapping.Memory = memory;
+    mapping.Size = memory_size;
+    return ImGuiShm_CreateWriter(mapping, slot_count);
+}
+
+void ImGuiShm::DestroyWriter(ImGuiShmWriter* writer)
+{
+    ImGuiShm_PlatformClose(&writer->Mapping);
+    IM_DELETE(writer);
+}
+
+// Honor texture requests, in the same way a renderer backend would.
+static void ImGuiShm_WriterUpdateTexture(ImGuiShmWriter* writer, ImTextureData* tex, ImU32 seq)
+{
+    const ImGuiID key = ImHashData(&tex, sizeof(tex));
+    ImGuiShmWriterTexture* entry = (ImGuiShmWriterTexture*)writer->TexturesMap.GetVoidPtr(key);
+    if (tex->Status == ImTextureStatus_WantCreate || (tex->Status == ImTextureStatus_WantUpdates && entry == NULL))
+    {
+        if (entry == NULL)
+        {
+            entry = IM_NEW(ImGuiShmWriterTexture)();
+            entry->ID = writer->NextTextureID++;
+            entry->Tex = tex;
+            writer->Textures.push_back(entry);
+            writer->TexturesMap.SetVoidPtr(key, entry);
+        }
+        entry->CreateSeq = seq;
+        entry->PendingRects.resize(0);
+        entry->PendingRectsSeq.resize(0);
+        tex->SetTexID((ImTextureID)(intptr_t)entry->ID);
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantUpdates)
+    {
+        for (const ImTextureRect& r : tex->Updates)
+        {
+            entry->PendingRects.push_back(r);
+            entry->PendingRectsSeq.push_back(seq);
+        }
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantDestroy)
+    {
+        if (entry != NULL)
+        {
+            entry->Tex = NULL;
+            entry->CreateSeq = 0;
+            entry->DestroySeq = seq;
+            entry->PendingRects.resize(0);
+            entry->PendingRectsSeq.resize(0);
+            writer->TexturesMap.SetVoidPtr(key, NULL);
+        }
+        tex->SetTexID(ImTextureID_Invalid);
+        tex->SetStatus(ImTextureStatus_Destroyed);
+    }
+}
+
+// Forget about texture data which reached the reader.
+static void ImGuiShm_WriterGarbageCollectTextures(ImGuiShmWriter* writer, ImU32 acquired_seq)
+{
+    for (int n = 0; n < writer->Textures.Size; n++)
+    {
+        ImGuiShmWriterTexture* entry = writer->Textures[n];
+        if (entry->DestroySeq != 0 && !ImGuiShm_SeqIsNewer(entry->DestroySeq, acquired_seq))
+        {
+            IM_DELETE(entry);
+            writer->Textures.erase(writer->Textures.Data + n);
+            n--;
+            continue;
+        }
+        if (entry->CreateSeq != 0 && !ImGuiShm_SeqIsNewer(entry->CreateSeq, acquired_seq))
+            entry->CreateSeq = 0;
+        int keep_n = 0;
+        for (int rect_n = 0; rect_n < entry->PendingRects.Size; rect_n++)
+            if (ImGuiShm_SeqIsNewer(entry->PendingRectsSeq[rect_n], acquired_seq))
+            {
+                entry->PendingRects[keep_n] = entry->PendingRects[rect_n];
+                entry->PendingRectsSeq[keep_n] = entry->PendingRectsSeq[rect_n];
+                keep_n++;
+            }
+        entry->PendingRects.resize(keep_n);
+        entry->PendingRectsSeq.resize(keep_n);
+    }
+}
+
+struct ImGuiShmSlotWriter
+{
+    char*   Slot;
+    ImU32   Size;
+    ImU32   Capacity;
+
+    // Return offset in slot, or 0 if full (offset 0 is always used by ImGuiShmFrame)
+    ImU32   Alloc(size_t sz)    { ImU32 offset = ImGuiShm_AlignOffset(Size); if ((size_t)offset + sz > Capacity) return 0; Size = offset + (ImU32)sz; return offset; }
+    void*   GetPtr(ImU32 offset){ return Slot + offset; }
+};
+
+static bool ImGuiShm_WriterWriteFrame(ImGuiShmWriter* writer, ImDrawData* draw_data, char* slot, ImU32 seq)
+{
+    ImGuiShmSlotWriter w = { slot, 0, writer->Header->SlotSize };
+    w.Alloc(sizeof(ImGuiShmFrame));
+    ImGuiShmFrame* frame = (ImGuiShmFrame*)slot;
+    frame->Seq = seq;
+    frame->DisplayPos = draw_data->DisplayPos;
+    frame->DisplaySize = draw_data->DisplaySize;
+    frame->FramebufferScale = draw_data->FramebufferScale;
+    frame->TotalVtxCount = draw_data->TotalVtxCount;
+    frame->TotalIdxCount = draw_data->TotalIdxCount;
+
+    // Texture data, for every texture with data not acknowledged by the reader
+    int textures_count = 0;
+    for (ImGuiShmWriterTexture* entry : writer->Textures)
+        if (entry->DestroySeq != 0 || entry->CreateSeq != 0 || entry->PendingRects.Size > 0)
+            textures_count++;
+    frame->TexturesCount = textures_count;
+    if (textures_count > 0 && (frame->TexturesOffset = w.Alloc(sizeof(ImGuiShmTexture) * textures_count)) == 0)
+        return false;
+    int texture_n = 0;
+    for (ImGuiShmWriterTexture* entry : writer->Textures)
+    {
+        if (entry->DestroySeq == 0 && entry->CreateSeq == 0 && entry->PendingRects.Size == 0)
+            continue;
+        ImGuiShmTexture* dst = (ImGuiShmTexture*)w.GetPtr(frame->TexturesOffset) + texture_n++;
+        memset(dst, 0, sizeof(*dst));
+        dst->ID = entry->ID;
+        if (entry->DestroySeq != 0)
+        {
+            dst->Op = ImGuiShmTextureOp_Destroy;
+            continue;
+        }
+        ImTextureData* tex = entry->Tex;
+        dst->Format = tex->Format;
+        dst->Width = tex->Width;
+        dst->Height = tex->Height;
+        if (entry->CreateSeq != 0)
+        {
+            dst->Op = ImGuiShmTextureOp_Create;
+            if ((dst->PixelsOffset = w.Alloc((size_t)tex->GetSizeInBytes())) == 0)
+                return false;
+            memcpy(w.GetPtr(dst->PixelsOffset), tex->GetPixels(), (size_t)tex->GetSizeInBytes());
+            continue;
+        }
+        dst->Op = ImGuiShmTextureOp_Update;
+        dst->RectsCount = entry->PendingRects.Size;
+        size_t pixels_size = 0;
+        for (const ImTextureRect& r : entry->PendingRects)
+            pixels_size += (size_t)r.w * r.h * tex->BytesPerPixel;
+        if ((dst->RectsOffset = w.Alloc(entry->PendingRects.size_in_bytes())) == 0 || (dst->PixelsOffset = w.Alloc(pixels_size)) == 0)
+            return false;
+        memcpy(w.GetPtr(dst->RectsOffset), entry->PendingRects.Data, entry->PendingRects.size_in_bytes());
+        unsigned char* dst_pixels = (unsigned char*)w.GetPtr(dst->PixelsOffset);
+        for (const ImTextureRect& r : entry->PendingRects)
+        {
+            const size_t row_size = (size_t)r.w * tex->BytesPerPixel;
+            for (int y = 0; y < r.h; y++, dst_pixels += row_size)
+                memcpy(dst_pixels, tex->GetPixelsAt(r.x, r.y + y), row_size);
+        }
+    }
+
+    // Draw lists
+    frame->ListsCount = draw_data->CmdLists.Size;
+    if (frame->ListsCount > 0 && (frame->ListsOffset = w.Alloc(sizeof(ImGuiShmList) * frame->ListsCount)) == 0)
+        return false;
+    ImTextureData* last_tex = NULL;
+    ImU32 last_tex_id = 0;
+    for (int list_n = 0; list_n < draw_data->CmdLists.Size; list_n++)
+    {
+        ImDrawList* src = draw_data->CmdLists[list_n];
+        ImGuiShmList* dst = (ImGuiShmList*)w.GetPtr(frame->ListsOffset) + list_n;
+        dst->Flags = src->Flags;
+        dst->VtxCount = src->VtxBuffer.Size;
+        dst->IdxCount = src->IdxBuffer.Size;
+        dst->CmdCount = 0;
+        if ((dst->VtxOffset = w.Alloc(src->VtxBuffer.size_in_bytes())) == 0 || (dst->IdxOffset = w.Alloc(src->IdxBuffer.size_in_bytes())) == 0)
+            return false;
+        if ((dst->CmdOffset = w.Alloc(src->CmdBuffer.size_in_bytes())) == 0 || (dst->CmdTexOffset = w.Alloc(sizeof(ImU32) * src->CmdBuffer.Size)) == 0)
+            return false;
+        memcpy(w.GetPtr(dst->VtxOffset), src->VtxBuffer.Data, src->VtxBuffer.size_in_bytes());
+        memcpy(w.GetPtr(dst->IdxOffset), src->IdxBuffer.Data, src->IdxBuffer.size_in_bytes());
+
+        // Commands: strip pointers which are meaningless in the other process
+        ImDrawCmd* dst_cmds = (ImDrawCmd*)w.GetPtr(dst->CmdOffset);
+        ImU32* dst_cmds_tex = (ImU32*)w.GetPtr(dst->CmdTexOffset);
+        for (const ImDrawCmd& src_cmd : src->CmdBuffer)
+        {
+            if (src_cmd.UserCallback != NULL && src_cmd.UserCallback != ImDrawCallback_ResetRenderState)
+                continue;
+            ImDrawCmd* dst_cmd = &dst_cmds[dst->CmdCount];
+            ImU32* dst_cmd_tex = &dst_cmds_tex[dst->CmdCount];
+            dst->CmdCount++;
+            *dst_cmd = src_cmd;
+            dst_cmd->UserCallbackData = NULL;
+            dst_cmd->UserCallbackDataSize = dst_cmd->UserCallbackDataOffset = 0;
+            *dst_cmd_tex = 0;
+            if (ImTextureData* tex = src_cmd.TexRef._TexData)
+            {
+                if (tex != last_tex)
+                {
+                    ImGuiShmWriterTexture* entry = (ImGuiShmWriterTexture*)writer->TexturesMap.GetVoidPtr(ImHashData(&tex, sizeof(tex)));
+                    last_tex = tex;
+                    last_tex_id = entry ? entry->ID : 0;
+                }
+                dst_cmd->TexRef._TexData = NULL;
+                *dst_cmd_tex = last_tex_id;
+            }
+        }
+    }
+    frame->Size = w.Size;
+    return true;
+}
+
+bool ImGuiShm::WriteDrawData(ImGuiShmWriter* writer, ImDrawData* draw_data)
+{
+    ImGuiShmHeader* header = writer->Header;
+    const ImU32 seq = writer->Seq + 1;
+
+    // Act as the renderer backend for texture requests
+    if (draw_data->Textures != NULL)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                ImGuiShm_WriterUpdateTexture(writer, tex, seq);
+    ImGuiShm_WriterGarbageCollectTextures(writer, ImAtomicLoad(&header->AcquiredSeq));
+
+    // Find a slot. Prefer a free one, otherwise take back the one we previously published if it wasn't acquired yet.
+    // The reader holds at most one slot, so this only loops when using 2 slots and the reader is in the middle of switching slots.
+    int slot_n = -1;
+    while (slot_n == -1)
+    {
+        for (int n = 0; n < (int)header->SlotCount && slot_n == -1; n++)
+            if (ImAtomicCompareExchange(&header->SlotState[n], ImGuiShmSlotState_Free, ImGuiShmSlotState_Writing))
+                slot_n = n;
+        if (slot_n == -1 && writer->PublishedSlot != -1 && ImAtomicCompareExchange(&header->SlotState[writer->PublishedSlot], ImGuiShmSlotState_Published, ImGuiShmSlotState_Writing))
+            slot_n = writer->PublishedSlot;
+    }
+    if (slot_n == writer->PublishedSlot)
+        writer->PublishedSlot = -1;
+
+    // Fill. If the frame doesn't fit, pending texture data stays pending and will be sent with next frame.
+    if (!ImGuiShm_WriterWriteFrame(writer, draw_data, ImGuiShm_GetSlot(header, slot_n), seq))
+    {
+        ImAtomicStore(&header->SlotState[slot_n], ImGuiShmSlotState_Free);
+        return false;
+    }
+
+    // Publish, then retire the previously published frame if the reader didn't acquire it
+    writer->Seq = seq;
+    ImAtomicStore(&header->SlotSeq[slot_n], seq);
+    ImAtomicStore(&header->SlotState[slot_n], ImGuiShmSlotState_Published);
+    if (writer->PublishedSlot != -1)
+        ImAtomicCompareExchange(&header->SlotState[writer->PublishedSlot], ImGuiShmSlotState_Published, ImGuiShmSlotState_Free);
+    writer->PublishedSlot = slot_n;
+    ImAtomicStore(&header->PublishedSeq, seq);
+    return true;
+}
+
+unsigned int ImGuiShm::GetPublishedFrameSeq(ImGuiShmWriter* writer)
+{
+    return writer->Seq;
+}
+
+unsigned int ImGuiShm::GetReaderAcquiredFrameSeq(ImGuiShmWriter* writer)
+{
+    return ImAtomicLoad(&writer->Header->AcquiredSeq);
+}
+
+//-------------------------------------------------------------------------
+// Reader
+//-------------------------------------------------------------------------
+
+struct ImGuiShmReader
+{
+    ImGuiShmMapping         Mapping;
+    ImGuiShmHeader*         Header;
+    int                     HeldSlot;
+    ImU32                   HeldSeq;
+    ImDrawData              DrawData;
+    ImDrawData              DrawDataDestroyTextures;    // Returned by RequestDestroyTextures()
+    ImVector<ImDrawList*>   DrawLists;          // Their ImVector<> point into shared memory!
+    ImVector<ImTextureData*> Textures;          // Replicated textures, owned by reader
+    ImGuiStorage            TexturesMap;        // ImGuiShmTexture::ID -> ImTextureData*
+    int                     InvalidFrameCount;  // Frames dropped by ImGuiShm_ReaderValidateFrame()
+
+    ImGuiShmReader()        { memset(&Mapping, 0, sizeof(Mapping)); Header = NULL; HeldSlot = -1; HeldSeq = 0; InvalidFrameCount = 0; }
+};
+
+template<typename T>
+static void ImGuiShm_SetVectorView(ImVector<T>& v, void* data, int size) { v.Data = (T*)data; v.Size = v.Capacity = size; }
+
+static ImGuiShmReader* ImGuiShm_CreateReader(const ImGuiShmMapping& mapping)
+{
+    ImGuiShmHeader* header = (ImGuiShmHeader*)mapping.Memory;
+    if (ImAtomicLoad(&header->Magic) != IMGUI_SHM_MAGIC)
+        return NULL;
+    IM_ASSERT(header->Version == IMGUI_SHM_VERSION && "Producer was built with a different version of imgui_shm.");
+    IM_ASSERT(header->LayoutHash == ImGuiShm_GetLayoutHash() && "Producer was built with different settings (e.g. ImDrawIdx, ImTextureID).");
+    if (header->Version != IMGUI_SHM_VERSION || header->LayoutHash != ImGuiShm_GetLayoutHash())
+        return NULL;
+    if (header->SlotCount < 2 || header->SlotCount > IMGUI_SHM_SLOTS_MAX || header->SlotSize < sizeof(ImGuiShmFrame) || (header->SlotSize & (IMGUI_SHM_ALIGN - 1)) != 0)
+        return NULL;
+    if (header->SlotsOffset < sizeof(ImGuiShmHeader) || (header->SlotsOffset & (IMGUI_SHM_ALIGN - 1)) != 0 || (ImU64)header->SlotsOffset + (ImU64)header->SlotCount * header->SlotSize > (ImU64)mapping.Size)
+        return NULL;
+
+    ImGuiShmReader* reader = IM_NEW(ImGuiShmReader)();
+    reader->Mapping = mapping;
+    reader->Header = header;
+    return reader;
+}
+
+ImGuiShmReader* ImGuiShm::CreateReader(const char* name)
+{
+    ImGuiShmMapping mapping;
+    if (!ImGuiShm_PlatformOpen(&mapping, name))
+        return NULL;
+    ImGuiShmReader* reader = ImGuiShm_CreateReader(mapping);
+    if (reader == NULL)
+        ImGuiShm_PlatformClose(&mapping);
+    return reader;
+}
+
+ImGuiShmReader* ImGuiShm::CreateReaderInMemory(void* memory)
+{
+    ImGuiShmMapping mapping;
+    memset(&mapping, 0, sizeof(mapping));
+    mapping.Memory = memory;
+    mapping.Size = (size_t)-1;
+    return ImGuiShm_CreateReader(mapping);
+}
+
+void ImGuiShm::DestroyReader(ImGuiShmReader* reader)
+{
+    ReleaseDrawData(reader);
+    for (ImDrawList* draw_list : reader->DrawLists)
+    {
+        ImGuiShm_SetVectorView(draw_list->CmdBuffer, NULL, 0);
+        ImGuiShm_SetVectorView(draw_list->IdxBuffer, NULL, 0);
+        ImGuiShm_SetVectorView(draw_list->VtxBuffer, NULL, 0);
+        IM_DELETE(draw_list);
+    }
+    for (ImTextureData* tex : reader->Textures)
+        IM_DELETE(tex);
+    ImGuiShm_PlatformClose(&reader->Mapping);
+    IM_DELETE(reader);
+}
+
+static void ImGuiShm_ReaderQueueTextureUpdate(ImTextureData* tex, const ImTextureRect& r)
+{
+    int new_x1 = ImMax(tex->UpdateRect.w == 0 ? 0 : tex->UpdateRect.x + tex->UpdateRect.w, r.x + r.w);
+    int new_y1 = ImMax(tex->UpdateRect.h == 0 ? 0 : tex->UpdateRect.y + tex->UpdateRect.h, r.y + r.h);
+    tex->UpdateRect.x = ImMin(tex->UpdateRect.x, r.x);
+    tex->UpdateRect.y = ImMin(tex->UpdateRect.y, r.y);
+    tex->UpdateRect.w = (unsigned short)(new_x1 - tex->UpdateRect.x);
+    tex->UpdateRect.h = (unsigned short)(new_y1 - tex->UpdateRect.y);
+    tex->UsedRect.x = ImMin(tex->UsedRect.x, r.x);
+    tex->UsedRect.y = ImMin(tex->UsedRect.y, r.y);
+    tex->UsedRect.w = (unsigned short)(ImMax(tex->UsedRect.x + tex->UsedRect.w, r.x + r.w) - tex->UsedRect.x);
+    tex->UsedRect.h = (unsigned short)(ImMax(tex->UsedRect.y + tex->UsedRect.h, r.y + r.h) - tex->UsedRect.y);
+    if (tex->Status == ImTextureStatus_OK || tex->Status == ImTextureStatus_WantUpdates)
+    {
+        tex->Status = ImTextureStatus_WantUpdates;
+        tex->Updates.push_back(r);
+    }
+}
+
+static void ImGuiShm_ReaderDestroyTexture(ImGuiShmReader* reader, ImTextureData* tex)
+{
+    reader->TexturesMap.SetVoidPtr(tex->UniqueID, NULL);
+    tex->WantDestroyNextFrame = true;
+    if (tex->TexID == ImTextureID_Invalid && tex->BackendUserData == NULL)
+        tex->Status = ImTextureStatus_Destroyed; // Never reached the backend
+    else
+        tex->Status = ImTextureStatus_WantDestroy;
+}
+
+// Check that an array of 'count' elements at 'offset' is within the used part of the slot.
+static bool ImGuiShm_IsArrayValid(const ImGuiShmFrame* frame, ImU32 offset, int count, size_t elem_size)
+{
+    if (count == 0)
+        return true; // Offset is not written by writer
+    if (count < 0 || offset < sizeof(ImGuiShmFrame) || (offset & (IMGUI_SHM_ALIGN - 1)) != 0)
+        return false;
+    return (ImU64)offset + (ImU64)count * elem_size <= (ImU64)frame->Size;
+}
+
+static bool ImGuiShm_IsTextureFormatValid(int format)
+{
+    return format == ImTextureFormat_RGBA32 || format == ImTextureFormat_Alpha8;
+}
+
+// Shared memory may be written by a buggy or mismatching producer: validate every offset, count and texture rectangle
+// before using them, as renderer backends and our texture replication trust them. Frames which don't pass are dropped.
+// (This runs once the slot is held, when a well-behaved writer doesn't touch it anymore.)
+static bool ImGuiShm_ReaderValidateFrame(const ImGuiShmHeader* header, const char* slot)
+{
+    const ImGuiShmFrame* frame = (const ImGuiShmFrame*)slot;
+    if (frame->Size < sizeof(ImGuiShmFrame) || frame->Size > header->SlotSize)
+        return false;
+
+    // Textures
+    if (!ImGuiShm_IsArrayValid(frame, frame->TexturesOffset, frame->TexturesCount, sizeof(ImGuiShmTexture)))
+        return false;
+    for (int texture_n = 0; texture_n < frame->TexturesCount; texture_n++)
+    {
+        const ImGuiShmTexture* tex = (const ImGuiShmTexture*)(slot + frame->TexturesOffset) + texture_n;
+        if (tex->Op == ImGuiShmTextureOp_Destroy)
+            continue;
+        if ((tex->Op != ImGuiShmTextureOp_Create && tex->Op != ImGuiShmTextureOp_Update) || !ImGuiShm_IsTextureFormatValid(tex->Format))
+            return false;
+        if (tex->Width <= 0 || tex->Height <= 0 || tex->Width > 0xFFFF || tex->Height > 0xFFFF) // ImTextureRect coordinates are 16-bit
+            return false;
+        const int bytes_per_pixel = (tex->Format == ImTextureFormat_RGBA32) ? 4 : 1;
+        if (tex->Op == ImGuiShmTextureOp_Create)
+        {
+            if (!ImGuiShm_IsArrayValid(frame, tex->PixelsOffset, 1, (size_t)tex->Width * tex->Height * bytes_per_pixel))
+                return false;
+            continue;
+        }
+        if (!ImGuiShm_IsArrayValid(frame, tex->RectsOffset, tex->RectsCount, sizeof(ImTextureRect)))
+            return false;
+        const ImTextureRect* rects = (const ImTextureRect*)(slot + tex->RectsOffset);
+        ImU64 pixels_size = 0;
+        for (int rect_n = 0; rect_n < tex->RectsCount; rect_n++)
+        {
+            const ImTextureRect& r = rects[rect_n];
+            if (r.x + r.w > tex->Width || r.y + r.h > tex->Height)
+                return false;
+            pixels_size += (ImU64)r.w * r.h * bytes_per_pixel;
+        }
+        if (pixels_size > 0 && ((tex->PixelsOffset & (IMGUI_SHM_ALIGN - 1)) != 0 || tex->PixelsOffset < sizeof(ImGuiShmFrame) || (ImU64)tex->PixelsOffset + pixels_size > (ImU64)frame->Size))
+            return false;
+    }
+
+    // Draw lists
+    if (!ImGuiShm_IsArrayValid(frame, frame->ListsOffset, frame->ListsCount, sizeof(ImGuiShmList)))
+        return false;
+    ImU64 total_vtx_count = 0;
+    ImU64 total_idx_count = 0;
+    for (int list_n = 0; list_n < frame->ListsCount; list_n++)
+    {
+        const ImGuiShmList* list = (const ImGuiShmList*)(slot + frame->ListsOffset) + list_n;
+        if (!ImGuiShm_IsArrayValid(frame, list->CmdOffset, list->CmdCount, sizeof(ImDrawCmd)) || !ImGuiShm_IsArrayValid(frame, list->CmdTexOffset, list->CmdCount, sizeof(ImU32)))
+            return false;
+        if (!ImGuiShm_IsArrayValid(frame, list->VtxOffset, list->VtxCount, sizeof(ImDrawVert)) || !ImGuiShm_IsArrayValid(frame, list->IdxOffset, list->IdxCount, sizeof(ImDrawIdx)))
+            return false;
+        total_vtx_count += list->VtxCount;
+        total_idx_count += list->IdxCount;
+
+        // Commands: no pointer may cross the process boundary, and indices must refer to vertices of the list
+        const ImDrawCmd* cmds = (const ImDrawCmd*)(slot + list->CmdOffset);
+        const ImDrawIdx* idx_buffer = (const ImDrawIdx*)(slot + list->IdxOffset);
+        for (int cmd_n = 0; cmd_n < list->CmdCount; cmd_n++)
+        {
+            const ImDrawCmd& cmd = cmds[cmd_n];
+            if ((cmd.UserCallback != NULL && cmd.UserCallback != ImDrawCallback_ResetRenderState) || cmd.UserCallbackData != NULL || cmd.TexRef._TexData != NULL)
+                return false;
+            if (cmd.UserCallback != NULL)
+                continue;
+            if ((ImU64)cmd.IdxOffset + cmd.ElemCount > (ImU64)list->IdxCount || cmd.VtxOffset > (unsigned int)list->VtxCount)
+                return false;
+            const unsigned int vtx_count = (unsigned int)list->VtxCount - cmd.VtxOffset;
+            for (unsigned int idx_n = cmd.IdxOffset; idx_n < cmd.IdxOffset + cmd.ElemCount; idx_n++)
+                if ((unsigned int)idx_buffer[idx_n] >= vtx_count)
+                    return false;
+        }
+    }
+    if (total_vtx_count != (ImU64)frame->TotalVtxCount || total_idx_count != (ImU64)frame->TotalIdxCount) // Backends size their buffers with those
+        return false;
+    return true;
+}
+
+// Same responsibilities as ImFontAtlasUpdateNewFrame() for atlas textures
+static void ImGuiShm_ReaderNewFrameTextures(ImGuiShmReader* reader)
+{
+    for (int n = 0; n < reader->Textures.Size; n++)
+    {
+        ImTextureData* tex = reader->Textures[n];
+        if (tex->Status == ImTextureStatus_OK)
+        {
+            tex->Updates.resize(0);
+            tex->UpdateRect.x = tex->UpdateRect.y = (unsigned short)~0;
+            tex->UpdateRect.w = tex->UpdateRect.h = 0;
+        }
+        if (tex->Status == ImTextureStatus_WantDestroy)
+            tex->UnusedFrames++;
+        if (tex->Status == ImTextureStatus_Destroyed && tex->WantDestroyNextFrame)
+        {
+            IM_DELETE(tex);
+            reader->Textures.erase(reader->Textures.Data + n);
+            n--;
+        }
+    }
+}
+
+static void ImGuiShm_ReaderApplyTexture(ImGuiShmReader* reader, char* slot, const ImGuiShmTexture* src)
+{
+    ImTextureData* tex = (ImTextureData*)reader->TexturesMap.GetVoidPtr(src->ID);
+    if (src->Op == ImGuiShmTextureOp_Destroy)
+    {
+        if (tex != NULL)
+            ImGuiShm_ReaderDestroyTexture(reader, tex);
+        return;
+    }
+    if (src->Op == ImGuiShmTextureOp_Create)
+    {
+        // Data may be sent again if the writer didn't notice we acquired it yet: only recreate on size change.
+        if (tex != NULL && (tex->Width != src->Width || tex->Height != src->Height || tex->Format != src->Format))
+        {
+            ImGuiShm_ReaderDestroyTexture(reader, tex);
+            tex = NULL;
+        }
+        if (tex == NULL)
+        {
+            tex = IM_NEW(ImTextureData)();
+            tex->UniqueID = (int)src->ID;
+            tex->Create((ImTextureFormat)src->Format, src->Width, src->Height);
+            reader->Textures.push_back(tex);
+            reader->TexturesMap.SetVoidPtr(src->ID, tex);
+        }
+        memcpy(tex->Pixels, slot + src->PixelsOffset, (size_t)tex->GetSizeInBytes());
+        ImTextureRect r = { 0, 0, (unsigned short)tex->Width, (unsigned short)tex->Height };
+        ImGuiShm_ReaderQueueTextureUpdate(tex, r);
+        return;
+    }
+    if (tex == NULL || tex->Width != src->Width || tex->Height != src->Height || tex->Format != src->Format) // Rectangles were validated against source size
+        return;
+    const ImTextureRect* rects = (const ImTextureRect*)(slot + src->RectsOffset);
+    const unsigned char* src_pixels = (const unsigned char*)(slot + src->PixelsOffset);
+    for (int rect_n = 0; rect_n < src->RectsCount; rect_n++)
+    {
+        const ImTextureRect& r = rects[rect_n];
+        const size_t row_size = (size_t)r.w * tex->BytesPerPixel;
+        for (int y = 0; y < r.h; y++, src_pixels += row_size)
+            memcpy(tex->GetPixelsAt(r.x, r.y + y), src_pixels, row_size);
+        ImGuiShm_ReaderQueueTextureUpdate(tex, r);
+    }
+}
+
+static void ImGuiShm_ReaderSetupDrawData(ImGuiShmReader* reader, char* slot)
+{
+    ImGuiShmFrame* frame = (ImGuiShmFrame*)slot;
+
+    // Textures first, as draw commands refer to them
+    ImGuiShm_ReaderNewFrameTextures(reader);
+    for (int texture_n = 0; texture_n < frame->TexturesCount; texture_n++)
+        ImGuiShm_ReaderApplyTexture(reader, slot, (ImGuiShmTexture*)(slot + frame->TexturesOffset) + texture_n);
+
+    ImDrawData* draw_data = &reader->DrawData;
+    draw_data->Valid = true;
+    draw_data->CmdLists.resize(0);
+    draw_data->CmdListsCount = frame->ListsCount;
+    draw_data->TotalVtxCount = frame->TotalVtxCount;
+    draw_data->TotalIdxCount = frame->TotalIdxCount;
+    draw_data->DisplayPos = frame->DisplayPos;
+    draw_data->DisplaySize = frame->DisplaySize;
+    draw_data->FramebufferScale = frame->FramebufferScale;
+    draw_data->OwnerViewport = NULL;
+    draw_data->Textures = &reader->Textures;
+    draw_data->DamageRects.resize(0);
+    draw_data->DamageRectsValid = false;
+
+    // Point our draw lists into the slot
+    while (reader->DrawLists.Size < frame->ListsCount)
+        reader->DrawLists.push_back(IM_NEW(ImDrawList)(NULL));
+    ImTextureData* last_tex = NULL;
+    ImU32 last_tex_id = 0;
+    for (int list_n = 0; list_n < frame->ListsCount; list_n++)
+    {
+        const ImGuiShmList* src = (const ImGuiShmList*)(slot + frame->ListsOffset) + list_n;
+        ImDrawList* draw_list = reader->DrawLists[list_n];
+        draw_list->Flags = src->Flags;
+        ImGuiShm_SetVectorView(draw_list->CmdBuffer, slot + src->CmdOffset, src->CmdCount);
+        ImGuiShm_SetVectorView(draw_list->IdxBuffer, slot + src->IdxOffset, src->IdxCount);
+        ImGuiShm_SetVectorView(draw_list->VtxBuffer, slot + src->VtxOffset, src->VtxCount);
+        draw_data->CmdLists.push_back(draw_list);
+
+        // Resolve texture references to our replicated textures
+        const ImU32* cmds_tex = (const ImU32*)(slot + src->CmdTexOffset);
+        for (int cmd_n = 0; cmd_n < src->CmdCount; cmd_n++)
+            if (ImU32 tex_id = cmds_tex[cmd_n])
+            {
+                if (tex_id != last_tex_id)
+                {
+                    last_tex = (ImTextureData*)reader->TexturesMap.GetVoidPtr(tex_id);
+                    last_tex_id = tex_id;
+                }
+                draw_list->CmdBuffer.Data[cmd_n].TexRef._TexData = last_tex;
+            }
+    }
+}
+
+ImDrawData* ImGuiShm::AcquireDrawData(ImGuiShmReader* reader)
+{
+    ImGuiShmHeader* header = reader->Header;
+    for (;;)
+    {
+        // Find most recent published frame
+        int slot_n = -1;
+        ImU32 slot_seq = reader->HeldSeq;
+        for (int n = 0; n < (int)header->SlotCount; n++)
+            if (ImAtomicLoad(&header->SlotState[n]) == ImGuiShmSlotState_Published)
+            {
+                ImU32 seq = ImAtomicLoad(&header->SlotSeq[n]);
+                if (ImGuiShm_SeqIsNewer(seq, slot_seq))
+                {
+                    slot_n = n;
+                    slot_seq = seq;
+                }
+            }
+        if (slot_n == -1)
+            return (reader->HeldSlot != -1) ? &reader->DrawData : NULL;
+
+        // Take ownership. This fails if the writer took it back in the meanwhile.
+        if (!ImAtomicCompareExchange(&header->SlotState[slot_n], ImGuiShmSlotState_Published, ImGuiShmSlotState_Held))
+            continue;
+        slot_seq = ImAtomicLoad(&header->SlotSeq[slot_n]);
+
+        // Drop invalid frame, keep the one we hold. AcquiredSeq is not updated so the writer keeps sending its texture data.
+        if (!ImGuiShm_ReaderValidateFrame(header, ImGuiShm_GetSlot(header, slot_n)))
+        {
+            reader->InvalidFrameCount++;
+            ImAtomicStore(&header->SlotState[slot_n], ImGuiShmSlotState_Free);
+            return (reader->HeldSlot != -1) ? &reader->DrawData : NULL;
+        }
+        if (reader->HeldSlot != -1)
+            ImAtomicStore(&header->SlotState[reader->HeldSlot], ImGuiShmSlotState_Free);
+        reader->HeldSlot = slot_n;
+        reader->HeldSeq = slot_seq;
+        ImAtomicStore(&header->AcquiredSeq, slot_seq);
+        ImGuiShm_ReaderSetupDrawData(reader, ImGuiShm_GetSlot(header, slot_n));
+        return &reader->DrawData;
+    }
+}
+
+void ImGuiShm::ReleaseDrawData(ImGuiShmReader* reader)
+{
+    if (reader->HeldSlot == -1)
+        return;
+    ImAtomicStore(&reader->Header->SlotState[reader->HeldSlot], ImGuiShmSlotState_Free);
+    reader->HeldSlot = -1;
+    reader->DrawData.Valid = false;
+    reader->DrawData.CmdLists.resize(0);
+    reader->DrawData.CmdListsCount = reader->DrawData.TotalVtxCount = reader->DrawData.TotalIdxCount = 0;
+}
+
+ImDrawData* ImGuiShm::RequestDestroyTextures(ImGuiShmReader* reader)
+{
+    // Textures will go back to _WantCreate state once destroyed by the backend (see ImTextureData::SetStatus()), pixels are preserved.
+    for (ImTextureData* tex : reader->Textures)
+        if (tex->Status != ImTextureStatus_Destroyed)
+        {
+            tex->Status = (tex->TexID == ImTextureID_Invalid && tex->BackendUserData == NULL) ? ImTextureStatus_WantCreate : ImTextureStatus_WantDestroy;
+            tex->UnusedFrames = 0x7FFF;
+        }
+    ImDrawData* draw_data = &reader->DrawDataDestroyTextures;
+    draw_data->Clear();
+    draw_data->Valid = true;
+    draw_data->DisplaySize = reader->DrawData.DisplaySize;
+    draw_data->FramebufferScale = reader->DrawData.FramebufferScale;
+    draw_data->Textures = &reader->Textures;
+    return draw_data;
+}
+
+unsigned int ImGuiShm::GetAcquiredFrameSeq(ImGuiShmReader* reader)
+{
+    return reader->HeldSlot != -1 ? reader->HeldSeq : 0;
+}
+
+int ImGuiShm::GetInvalidFrameCount(ImGuiShmReader* reader)
+{
+    return reader->InvalidFrameCount;
+}
+
+//-------------------------------------------------------------------------
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#ifdef _MSC_VER
+#pragma warning (pop)
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,83 @@
+// dear imgui: shared memory transport for ImDrawData (out-of-process rendering)
+// (headers)
+
+// This lets one process run Dear ImGui (the "producer") and another process submit its output to the GPU (the "consumer").
+// - The producer calls ImGuiShm::WriteDrawData() after ImGui::Render(). Vertices, indices, commands and texture updates
+//   are written into a ring of slots in shared memory, published with sequence counters.
+// - The consumer calls ImGuiShm::AcquireDrawData() to obtain an ImDrawData which directly points into shared memory
+//   (no copy of vertices/indices/commands), and passes it to any existing ImGui_ImplXXXX_RenderDrawData() function.
+// - Texture updates (ImTextureData) are replicated on the consumer side into textures owned by the reader,
+//   so the consumer renderer backend handles them as usual (ImGuiBackendFlags_RendererHasTextures).
+
+// Usage:
+// {
+//   // Producer (no renderer backend)
+//   ImGuiShmWriter* writer = ImGuiShm::CreateWriter("my_app");
+//   io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;    // Texture requests are honored by WriteDrawData()
+//   [...]
+//   ImGui::Render();
+//   ImGuiShm::WriteDrawData(writer, ImGui::GetDrawData());
+//
+//   // Consumer (a Dear ImGui context is only needed by the renderer backend, you don't need to call NewFrame())
+//   ImGuiShmReader* reader = ImGuiShm::CreateReader("my_app");
+//   [...]
+//   if (ImDrawData* draw_data = ImGuiShm::AcquireDrawData(reader))
+//       ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+//   [...]
+//   ImGui_ImplOpenGL3_RenderDrawData(ImGuiShm::RequestDestroyTextures(reader)); // Let the backend destroy the textures it created for us
+//   ImGui_ImplOpenGL3_Shutdown();
+//   ImGuiShm::DestroyReader(reader);
+// }
+
+// Notes:
+// - Both processes must be built with the same imconfig.h (ImDrawVert, ImDrawIdx, ImTextureID layouts are verified on connection).
+// - The consumer always receives the most recent complete frame: if it is slower than the producer, frames are skipped.
+//   Texture updates are never lost: they are sent again until a frame containing them has been acquired.
+// - Only the ImDrawCallback_ResetRenderState callback can cross a process boundary. Other user callbacks are dropped.
+// - User-provided ImTextureID values (e.g. ImGui::Image() calls) are passed through as-is: they need to have a meaning in the consumer process.
+// - Only one producer and one consumer are supported per shared memory region.
+// - CreateWriter()/CreateReader() use POSIX shm_open(). They are not supported on Windows yet: use CreateWriterInMemory()/CreateReaderInMemory().
+// - See misc/shm/imgui_shm_null_consumer.cpp for a consumer without graphics output, e.g. to test with examples/example_null built with WITH_SHM=1.
+
+#pragma once
+#include "imgui.h"      // IMGUI_API
+#ifndef IMGUI_DISABLE
+
+// Forward declarations
+struct ImGuiShmWriter;  // Producer side (opaque)
+struct ImGuiShmReader;  // Consumer side (opaque)
+
+namespace ImGuiShm
+{
+    // Producer
+    // - 'slot_size' is the maximum size of one frame, including texture updates. 'slot_count' is 2 or 3 (3 recommended: the producer never waits).
+    // - CreateWriterInMemory() lets you provide your own shared memory block. Use GetMemorySize() to compute its size.
+    // - WriteDrawData() returns false if the frame didn't fit in a slot (it is skipped and its texture updates are sent with next frame).
+    IMGUI_API ImGuiShmWriter*   CreateWriter(const char* name, size_t slot_size = 8 * 1024 * 1024, int slot_count = 3);
+    IMGUI_API ImGuiShmWriter*   CreateWriterInMemory(void* memory, size_t memory_size, int slot_count = 3);
+    IMGUI_API void              DestroyWriter(ImGuiShmWriter* writer);
+    IMGUI_API bool              WriteDrawData(ImGuiShmWriter* writer, ImDrawData* draw_data);
+    IMGUI_API size_t            GetMemorySize(size_t slot_size, int slot_count = 3);
+    IMGUI_API unsigned int      GetPublishedFrameSeq(ImGuiShmWriter* writer);       // Sequence number of last frame published by WriteDrawData() (0: none)
+    IMGUI_API unsigned int      GetReaderAcquiredFrameSeq(ImGuiShmWriter* writer);  // Sequence number of last frame acquired by the reader (0: none). e.g. wait for it to reach GetPublishedFrameSeq() before destroying the writer.
+
+    // Consumer
+    // - CreateReader() returns NULL if the producer hasn't created the shared memory yet (or if the layouts don't match).
+    // - AcquireDrawData() returns the most recent frame, or the same frame again if nothing new was published, or NULL if there is no frame to render.
+    //   The returned data stays valid until the next call to AcquireDrawData(), ReleaseDrawData() or DestroyReader().
+    //   Frames are validated (offsets and sizes within the slot, indices within their draw list, texture rectangles within their texture, no pointers):
+    //   invalid ones are dropped and counted by GetInvalidFrameCount().
+    // - ReleaseDrawData() is optional: it lets the producer reuse the slot sooner when you are not going to render for a while.
+    // - RequestDestroyTextures() returns an ImDrawData with no draw lists, requesting the destruction of all textures replicated by the reader.
+    //   Pass it to your renderer backend before shutting it down. The textures are created again if you keep acquiring frames.
+    IMGUI_API ImGuiShmReader*   CreateReader(const char* name);
+    IMGUI_API ImGuiShmReader*   CreateReaderInMemory(void* memory);
+    IMGUI_API void              DestroyReader(ImGuiShmReader* reader);
+    IMGUI_API ImDrawData*       AcquireDrawData(ImGuiShmReader* reader);
+    IMGUI_API void              ReleaseDrawData(ImGuiShmReader* reader);
+    IMGUI_API ImDrawData*       RequestDestroyTextures(ImGuiShmReader* reader);
+    IMGUI_API unsigned int      GetAcquiredFrameSeq(ImGuiShmReader* reader);    // Sequence number of acquired frame (starts at 1, increments on every successful WriteDrawData())
+    IMGUI_API int               GetInvalidFrameCount(ImGuiShmReader* reader);   // Number of frames dropped because they didn't pass validation
+}
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,109 @@
+// dear imgui
+// (imgui_shm_null_consumer.cpp)
+// Consumer for misc/shm/imgui_shm.h with no graphics output: acquire frames published by a producer process,
+// act as the renderer backend for replicated textures, and check the draw commands received.
+// This is useful to test imgui_shm across two processes, e.g. with examples/example_null built with WITH_SHM=1 as the producer.
+
+// Build with, e.g:
+//   # g++ -std=c++11 -I../.. imgui_shm_null_consumer.cpp imgui_shm.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_tables.cpp ../../imgui_widgets.cpp -lrt
+
+// Usage:
+//   imgui_shm_null_consumer [name]          (default name: "imgui_example_null")
+// Usage example:
+//   # ./imgui_shm_null_consumer & (cd ../../examples/example_null && ./example_null); wait $!
+// Notes:
+//   Waits up to 5 seconds for the producer, then exits after 1 second without a new frame.
+//   Exit code is 0 if at least one frame was received and no frame was dropped by validation.
+
+#include "imgui.h"
+#include "imgui_shm.h"
+#include <stdio.h>
+#include <chrono>
+#include <thread>
+
+struct NullRendererStats
+{
+    int     FramesCount;
+    int     CmdCount;
+    int     TexturesCreated;
+    int     TexturesDestroyed;
+    size_t  TexturesUploadedBytes;
+};
+
+// Same as a renderer backend RenderDrawData() function, without any graphics output
+static void RenderDrawDataNull(ImDrawData* draw_data, NullRendererStats* stats)
+{
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+        {
+            if (tex->Status == ImTextureStatus_WantCreate)
+            {
+                tex->SetTexID((ImTextureID)(intptr_t)tex->UniqueID);
+                tex->SetStatus(ImTextureStatus_OK);
+                stats->TexturesCreated++;
+                stats->TexturesUploadedBytes += (size_t)tex->GetSizeInBytes();
+            }
+            else if (tex->Status == ImTextureStatus_WantUpdates)
+            {
+                for (const ImTextureRect& r : tex->Updates)
+                    stats->TexturesUploadedBytes += (size_t)r.w * r.h * tex->BytesPerPixel;
+                tex->SetStatus(ImTextureStatus_OK);
+            }
+            else if (tex->Status == ImTextureStatus_WantDestroy)
+            {
+                tex->SetTexID(ImTextureID_Invalid);
+                tex->SetStatus(ImTextureStatus_Destroyed);
+                stats->TexturesDestroyed++;
+            }
+        }
+
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            if (cmd.UserCallback == nullptr)
+                IM_ASSERT(cmd.GetTexID() != ImTextureID_Invalid);
+            stats->CmdCount++;
+        }
+    stats->FramesCount++;
+}
+
+int main(int argc, char** argv)
+{
+    const char* name = (argc > 1) ? argv[1] : "imgui_example_null";
+
+    ImGuiShmReader* reader = nullptr;
+    for (int n = 0; n < 5000 && reader == nullptr; n++)
+        if ((reader = ImGuiShm::CreateReader(name)) == nullptr)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (reader == nullptr)
+    {
+        fprintf(stderr, "Error: no producer found for '%s'.\n", name);
+        return 1;
+    }
+
+    NullRendererStats stats = {};
+    unsigned int last_seq = 0;
+    for (int idle_ms = 0; idle_ms < 1000; )
+    {
+        ImDrawData* draw_data = ImGuiShm::AcquireDrawData(reader);
+        const unsigned int seq = ImGuiShm::GetAcquiredFrameSeq(reader);
+        if (draw_data != nullptr && seq != last_seq)
+        {
+            RenderDrawDataNull(draw_data, &stats);
+            last_seq = seq;
+            idle_ms = 0;
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            idle_ms++;
+        }
+    }
+
+    const int invalid_frames_count = ImGuiShm::GetInvalidFrameCount(reader);
+    printf("Acquired %d frames (last seq %u), %d draw commands, %d invalid frames.\n", stats.FramesCount, last_seq, stats.CmdCount, invalid_frames_count);
+    printf("Textures: %d created, %d destroyed, %d bytes uploaded.\n", stats.TexturesCreated, stats.TexturesDestroyed, (int)stats.TexturesUploadedBytes);
+    RenderDrawDataNull(ImGuiShm::RequestDestroyTextures(reader), &stats);
+    ImGuiShm::DestroyReader(reader);
+    return (stats.FramesCount > 0 && invalid_frames_count == 0) ? 0 : 1;
+}
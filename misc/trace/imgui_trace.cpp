@@ -0,0 +1,430 @@
+// dear imgui: trace writer, exporting per-frame timing and counters in Chrome trace-event format
+// (code)
+
+// CHANGELOG
+//  2026/10/19: initial version.
+
+// About the design:
+// - Context hooks are used to collect events. Events for a frame are formatted into 'FrameBuf' (main thread),
+//   which is committed into 'BufFront' when the next frame starts (NewFramePre hook).
+//   At this point, when IMGUI_ENABLE_PROFILER is defined, g.Profiler.LastFrame holds the zones of the completed frame.
+// - The writer thread swaps 'BufFront' and 'BufBack' and writes 'BufBack' to the file.
+//   All three buffers are allocated once with 'buffer_size' bytes: if a frame doesn't fit in 'BufFront', it is dropped.
+//   A frame whose events exceed 'buffer_size' can never fit: we stop formatting it as soon as 'FrameBuf' gets that large
+//   (checked before each event, so the last event appended may grow 'FrameBuf' past its reserved size).
+// - Failed writes are counted in 'WriteErrors' (data is lost, but we keep trying with next buffers).
+// - The file is a JSON object with a "traceEvents" array: https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+//   Each event is written on its own line followed by a comma. The last event is written when closing the file.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_trace.h"
+#include "imgui_internal.h"     // ImGuiContextHook, ImFileXXX, g.FontAtlases, g.Profiler
+
+#include <chrono>               // steady_clock
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Visual Studio warnings
+#ifdef _MSC_VER
+#pragma warning (push)
+#pragma warning (disable: 4127)     // condition expression is constant
+#endif
+
+// Clang/GCC warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wold-style-cast"         // warning: use of old-style cast
+#pragma clang diagnostic ignored "-Wsign-conversion"        // warning: implicit conversion changes signedness
+#pragma clang diagnostic ignored "-Wc++98-compat"           // warning: lambda expressions are incompatible with C++98
+#endif
+
+//-------------------------------------------------------------------------
+// Writer
+//-------------------------------------------------------------------------
+
+static const ImGuiContextHookType ImGuiTrace_HookTypes[] = { ImGuiContextHookType_NewFramePre, ImGuiContextHookType_NewFramePost, ImGuiContextHookType_RenderPre, ImGuiContextHookType_RenderPost, ImGuiContextHookType_Shutdown };
+
+struct ImGuiTraceWriter
+{
+    ImGuiContext*           Ctx;                            // NULL after context shutdown
+    ImGuiID                 HookIds[IM_ARRAYSIZE(ImGuiTrace_HookTypes)];
+    ImFileHandle            File;
+    size_t                  BufferSize;
+    ImU64                   TimeOrigin;                     // Timestamps are written relative to this
+    ImU64                   FrameTimeBegin;
+    int                     FrameCount;                     // Frame being traced, 0 before first NewFrame()
+    int                     DroppedFrames;
+    int                     DroppedFramesReported;
+    bool                    FrameDropped;                   // Events for current frame exceeded BufferSize: stop appending to FrameBuf
+    ImGuiTextBuffer         FrameBuf;                       // Events for current frame (main thread)
+    ImGuiStorage            AtlasTexUniqueIds;              // Last reported TexData->UniqueID for each atlas
+
+    // Shared with writer thread, protected by Mutex
+    std::mutex              Mutex;
+    std::condition_variable Cond;
+    ImVector<char>          BufFront;                       // Committed frames, waiting to be written
+    int                     WriteErrors;
+    bool                    FlushRequested;
+    bool                    StopRequested;
+
+    // Writer thread
+    std::thread             Thread;
+    ImVector<char>          BufBack;                        // Being written to file
+
+    ImGuiTraceWriter()      { Ctx = NULL; memset(HookIds, 0, sizeof(HookIds)); File = NULL; BufferSize = 0; TimeOrigin = FrameTimeBegin = 0; FrameCount = DroppedFrames = DroppedFramesReported = WriteErrors = 0; FrameDropped = FlushRequested = StopRequested = false; }
+};
+
+static ImU64 ImGuiTrace_GetTime()
+{
+#ifdef IMGUI_ENABLE_PROFILER
+    return ImGui::ProfilerGetTime(); // Same time base as profiler zones
+#else
+    return (ImU64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// Timestamps and durations are in microseconds
+static inline double ImGuiTrace_TimeToUs(ImGuiTraceWriter* writer, ImU64 t) { return (double)(ImS64)(t - writer->TimeOrigin) / 1000.0; }
+static inline double ImGuiTrace_DurationToUs(ImU64 t0, ImU64 t1)            { return (double)(t1 - t0) / 1000.0; }
+
+#ifdef IMGUI_ENABLE_PROFILER
+// Zone names and window names may contain any character
+static void ImGuiTrace_AppendJsonString(ImGuiTextBuffer* buf, const char* str)
+{
+    buf->append("\"");
+    const char* run_begin = str;
+    for (const char* p = str; *p != 0; p++)
+    {
+        const unsigned char c = (unsigned char)*p;
+        if (c >= 0x20 && c != '"' && c != '\\')
+            continue;
+        buf->append(run_begin, p);
+        if (c == '"' || c == '\\')
+            buf->appendf("\\%c", c);
+        else
+            buf->appendf("\\u%04x", c);
+        run_begin = p + 1;
+    }
+    buf->append(run_begin);
+    buf->append("\"");
+}
+#endif
+
+// Return true when events of current frame are being dropped. Called before appending to FrameBuf.
+static bool ImGuiTrace_IsFrameDropped(ImGuiTraceWriter* writer)
+{
+    if (!writer->FrameDropped && (size_t)writer->FrameBuf.size() > writer->BufferSize)
+    {
+        writer->FrameDropped = true;
+        writer->FrameBuf.resize(0);
+    }
+    return writer->FrameDropped;
+}
+
+static void ImGuiTrace_AppendInstantEvent(ImGuiTraceWriter* writer, const char* name, const char* category, ImU64 t)
+{
+    if (ImGuiTrace_IsFrameDropped(writer))
+        return;
+    writer->FrameBuf.appendf("{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":1},\n", name, category, ImGuiTrace_TimeToUs(writer, t));
+}
+
+// Move events of current frame into BufFront, or drop them if the writer thread is late.
+static void ImGuiTrace_CommitFrame(ImGuiTraceWriter* writer)
+{
+    if (writer->FrameDropped)
+    {
+        writer->DroppedFrames++;
+        writer->FrameDropped = false;
+        return;
+    }
+    const int size = writer->FrameBuf.size();
+    if (size == 0)
+        return;
+    bool flush = false;
+    {
+        std::lock_guard<std::mutex> lock(writer->Mutex);
+        const int front_size = writer->BufFront.Size;
+        if ((size_t)front_size + (size_t)size <= writer->BufferSize)
+        {
+            writer->BufFront.resize(front_size + size); // Never grows past reserved capacity
+            memcpy(writer->BufFront.Data + front_size, writer->FrameBuf.begin(), (size_t)size);
+            flush = ((size_t)writer->BufFront.Size >= writer->BufferSize / 2);
+        }
+        else
+        {
+            writer->DroppedFrames++;
+            flush = true;
+        }
+        writer->FlushRequested |= flush;
+    }
+    if (flush)
+        writer->Cond.notify_one();
+    writer->FrameBuf.resize(0);
+}
+
+// Called when next frame starts: output frame boundaries and profiler zones, then commit.
+static void ImGuiTrace_EndFrame(ImGuiTraceWriter* writer, ImU64 t)
+{
+    if (writer->FrameCount == 0)
+        return;
+    ImGuiContext& g = *writer->Ctx;
+    ImGuiTextBuffer* buf = &writer->FrameBuf;
+    ImU64 frame_begin = writer->FrameTimeBegin;
+    ImU64 frame_end = t;
+
+#ifdef IMGUI_ENABLE_PROFILER
+    // Zones. NewFrame() has swapped profiler frames before calling the NewFramePre hook.
+    const ImGuiProfilerFrame& profiler_frame = g.Profiler.LastFrame;
+    if (profiler_frame.FrameCount == writer->FrameCount)
+    {
+        frame_begin = profiler_frame.TimeBegin;
+        frame_end = profiler_frame.TimeEnd;
+        for (const ImGuiProfilerZone& zone : profiler_frame.Zones)
+        {
+            if (ImGuiTrace_IsFrameDropped(writer))
+                break;
+            buf->append("{\"name\":");
+            ImGuiTrace_AppendJsonString(buf, zone.Name);
+            buf->appendf(",\"cat\":\"imgui\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1", ImGuiTrace_TimeToUs(writer, zone.TimeBegin), ImGuiTrace_DurationToUs(zone.TimeBegin, zone.TimeEnd));
+            if (ImGuiWindow* window = zone.ID ? ImGui::FindWindowByID(zone.ID) : NULL)
+            {
+                buf->append(",\"args\":{\"window\":");
+                ImGuiTrace_AppendJsonString(buf, window->Name);
+                buf->append("}");
+            }
+            else if (zone.ID != 0)
+            {
+                buf->appendf(",\"args\":{\"id\":\"0x%08X\"}", zone.ID);
+            }
+            buf->append("},\n");
+        }
+    }
+#else
+    IM_UNUSED(g);
+#endif
+
+    // Frame boundaries
+    if (ImGuiTrace_IsFrameDropped(writer))
+    {
+        ImGuiTrace_CommitFrame(writer);
+        return;
+    }
+    buf->appendf("{\"name\":\"Frame\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1,\"args\":{\"frame\":%d}},\n",
+        ImGuiTrace_TimeToUs(writer, frame_begin), ImGuiTrace_DurationToUs(frame_begin, frame_end), writer->FrameCount);
+
+    // Report dropped frames (main thread is the only writer of DroppedFrames)
+    if (writer->DroppedFramesReported != writer->DroppedFrames)
+    {
+        writer->DroppedFramesReported = writer->DroppedFrames;
+        buf->appendf("{\"name\":\"Trace\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"tid\":1,\"args\":{\"dropped_frames\":%d}},\n", ImGuiTrace_TimeToUs(writer, frame_end), writer->DroppedFrames);
+    }
+
+    ImGuiTrace_CommitFrame(writer);
+}
+
+// Called after Render(): output texture uploads, draw data sizes and atlas texture creations.
+static void ImGuiTrace_AppendRenderCounters(ImGuiTraceWriter* writer, ImU64 t)
+{
+    ImGuiContext& g = *writer->Ctx;
+    ImGuiTextBuffer* buf = &writer->FrameBuf;
+    const double ts = ImGuiTrace_TimeToUs(writer, t);
+    if (ImGuiTrace_IsFrameDropped(writer))
+        return;
+
+    // Texture uploads requested from the renderer backend (requests are repeated if the backend doesn't honor them)
+    int upload_count = 0;
+    ImU64 upload_bytes = 0;
+    for (ImTextureData* tex : g.PlatformIO.Textures)
+    {
+        if (tex->Status == ImTextureStatus_WantCreate)
+        {
+            upload_count++;
+            upload_bytes += (ImU64)tex->GetSizeInBytes();
+        }
+        else if (tex->Status == ImTextureStatus_WantUpdates)
+        {
+            for (const ImTextureRect& r : tex->Updates)
+                upload_bytes += (ImU64)r.w * r.h * tex->BytesPerPixel;
+            upload_count += tex->Updates.Size;
+        }
+    }
+    buf->appendf("{\"name\":\"Texture uploads\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"tid\":1,\"args\":{\"bytes\":%" IM_PRIu64 ",\"count\":%d}},\n", ts, upload_bytes, upload_count);
+
+    // Draw data sizes
+    if (ImDrawData* draw_data = ImGui::GetDrawData())
+        buf->appendf("{\"name\":\"Draw data\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"tid\":1,\"args\":{\"vertices\":%d,\"indices\":%d,\"draw_lists\":%d}},\n", ts, draw_data->TotalVtxCount, draw_data->TotalIdxCount, draw_data->CmdListsCount);
+
+    // Atlas texture creations (first build, or rebuild after growing/repacking)
+    for (ImFontAtlas* atlas : g.FontAtlases)
+    {
+        ImTextureData* tex = atlas->TexData;
+        if (tex == NULL || tex->Status != ImTextureStatus_WantCreate)
+            continue;
+        int* last_unique_id = writer->AtlasTexUniqueIds.GetIntRef(ImHashData(&atlas, sizeof(atlas)), -1);
+        if (*last_unique_id == tex->UniqueID)
+            continue;
+        *last_unique_id = tex->UniqueID;
+        buf->appendf("{\"name\":\"Atlas texture created\",\"cat\":\"atlas\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":1,\"args\":{\"width\":%d,\"height\":%d,\"unique_id\":%d}},\n", ts, tex->Width, tex->Height, tex->UniqueID);
+    }
+}
+
+static void ImGuiTrace_HookCallback(ImGuiContext* ctx, ImGuiContextHook* hook)
+{
+    ImGuiTraceWriter* writer = (ImGuiTraceWriter*)hook->UserData;
+    IM_ASSERT(writer->Ctx == ctx);
+    const ImU64 t = ImGuiTrace_GetTime();
+    switch (hook->Type)
+    {
+    case ImGuiContextHookType_NewFramePre:
+        ImGuiTrace_EndFrame(writer, t);
+        writer->FrameCount = ctx->FrameCount + 1; // NewFrame() increments g.FrameCount after calling this hook
+        writer->FrameTimeBegin = t;
+        ImGuiTrace_AppendInstantEvent(writer, "NewFramePre", "hook", t);
+        break;
+    case ImGuiContextHookType_NewFramePost:
+        ImGuiTrace_AppendInstantEvent(writer, "NewFramePost", "hook", t);
+        break;
+    case ImGuiContextHookType_RenderPre:
+        ImGuiTrace_AppendInstantEvent(writer, "RenderPre", "hook", t);
+        break;
+    case ImGuiContextHookType_RenderPost:
+        ImGuiTrace_AppendInstantEvent(writer, "RenderPost", "hook", t);
+        ImGuiTrace_AppendRenderCounters(writer, t);
+        break;
+    case ImGuiContextHookType_Shutdown:
+        // Context is being destroyed: the frame in progress is incomplete, only commit its events.
+        ImGuiTrace_CommitFrame(writer);
+        writer->Ctx = NULL;
+        break;
+    default:
+        break;
+    }
+}
+
+static void ImGuiTrace_WriterThreadMain(ImGuiTraceWriter* writer)
+{
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    for (;;)
+    {
+        writer->Cond.wait(lock, [writer] { return writer->FlushRequested || writer->StopRequested; });
+        const bool stop = writer->StopRequested;
+        writer->BufFront.swap(writer->BufBack);
+        writer->FlushRequested = false;
+        lock.unlock();
+        bool write_error = false;
+        if (writer->BufBack.Size > 0)
+            write_error = ImFileWrite(writer->BufBack.Data, 1, (ImU64)writer->BufBack.Size, writer->File) != (ImU64)writer->BufBack.Size;
+        writer->BufBack.resize(0);
+        lock.lock();
+        if (write_error)
+            writer->WriteErrors++;
+        if (stop) // No more commits after StopRequested is set
+            break;
+    }
+}
+
+//-------------------------------------------------------------------------
+// Public API
+//-------------------------------------------------------------------------
+
+ImGuiTraceWriter* ImGuiTrace::CreateWriter(const char* filename, size_t buffer_size)
+{
+    ImGuiContext* ctx = ImGui::GetCurrentContext();
+    IM_ASSERT(ctx != NULL && "No current context. Did you call ImGui::CreateContext()?");
+    IM_ASSERT(buffer_size >= 1024 && buffer_size <= 0x7FFFFFFF);
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (f == NULL)
+        return NULL;
+
+    const char* header = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Main\"}},\n";
+    if (ImFileWrite(header, 1, strlen(header), f) != strlen(header))
+    {
+        ImFileClose(f);
+        return NULL;
+    }
+
+    ImGuiTraceWriter* writer = IM_NEW(ImGuiTraceWriter)();
+    writer->Ctx = ctx;
+    writer->File = f;
+    writer->BufferSize = buffer_size;
+    writer->BufFront.reserve((int)buffer_size);
+    writer->BufBack.reserve((int)buffer_size);
+    writer->FrameBuf.reserve((int)buffer_size);
+    writer->TimeOrigin = ImGuiTrace_GetTime();
+
+    for (int n = 0; n < IM_ARRAYSIZE(ImGuiTrace_HookTypes); n++)
+    {
+        ImGuiContextHook hook;
+        hook.Type = ImGuiTrace_HookTypes[n];
+        hook.Owner = ImHashStr("ImGuiTrace");
+        hook.Callback = ImGuiTrace_HookCallback;
+        hook.UserData = writer;
+        writer->HookIds[n] = ImGui::AddContextHook(ctx, &hook);
+    }
+    writer->Thread = std::thread(ImGuiTrace_WriterThreadMain, writer);
+    return writer;
+}
+
+bool ImGuiTrace::DestroyWriter(ImGuiTraceWriter* writer)
+{
+    if (writer == NULL)
+        return false;
+
+    // Unregister hooks and commit events of the frame in progress (which is incomplete, so it has no frame event)
+    if (writer->Ctx != NULL)
+    {
+        for (ImGuiID hook_id : writer->HookIds)
+            ImGui::RemoveContextHook(writer->Ctx, hook_id);
+        ImGuiTrace_CommitFrame(writer);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(writer->Mutex);
+        writer->StopRequested = true;
+    }
+    writer->Cond.notify_one();
+    writer->Thread.join();
+
+    const char* footer = "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Dear ImGui\"}}\n]}\n";
+    if (ImFileWrite(footer, 1, strlen(footer), writer->File) != strlen(footer))
+        writer->WriteErrors++;
+    if (!ImFileClose(writer->File))
+        writer->WriteErrors++;
+    const bool ret = (writer->WriteErrors == 0);
+    IM_DELETE(writer);
+    return ret;
+}
+
+void ImGuiTrace::Flush(ImGuiTraceWriter* writer)
+{
+    {
+        std::lock_guard<std::mutex> lock(writer->Mutex);
+        writer->FlushRequested = true;
+    }
+    writer->Cond.notify_one();
+}
+
+int ImGuiTrace::GetDroppedFrameCount(ImGuiTraceWriter* writer)
+{
+    return writer->DroppedFrames;
+}
+
+int ImGuiTrace::GetWriteErrorCount(ImGuiTraceWriter* writer)
+{
+    std::lock_guard<std::mutex> lock(writer->Mutex);
+    return writer->WriteErrors;
+}
+
+//-------------------------------------------------------------------------
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#ifdef _MSC_VER
+#pragma warning (pop)
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
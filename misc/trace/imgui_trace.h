@@ -0,0 +1,53 @@
+// dear imgui: trace writer, exporting per-frame timing and counters in Chrome trace-event format
+// (headers)
+
+// This writes a JSON file which can be loaded in Perfetto (https://ui.perfetto.dev) or chrome://tracing,
+// for offline analysis of headless/CI or production runs.
+// - Frame boundaries, as duration events.
+// - Context hook points (NewFramePre/Post, RenderPre/Post), as instant events.
+// - Texture uploads requested from the renderer backend (bytes, count) and ImDrawData sizes, as counter events.
+// - Font atlas texture (re)creations, as instant events.
+// - When IMGUI_ENABLE_PROFILER is defined (see imconfig.h): all profiler zones (NewFrame steps, Begin/End, tables,
+//   text rendering, atlas builds, context hook callbacks...), as duration events.
+// Events are accumulated in a bounded in-memory buffer which is written to the file by a background thread.
+// If the file can't be written fast enough, whole frames are dropped (never partially written) and counted.
+
+// Usage:
+// {
+//   ImGui::CreateContext();
+//   ImGuiTraceWriter* trace = ImGuiTrace::CreateWriter("imgui_trace.json");   // Register hooks in current context
+//   [...]
+//   ImGuiTrace::DestroyWriter(trace);                                         // Write remaining events and close file
+//   ImGui::DestroyContext();
+// }
+
+// Notes:
+// - A frame is measured from one NewFrame() call to the next one, so it includes time spent by the application.
+//   Events for a frame are emitted when the next frame starts.
+// - This requires <thread>, <mutex> and <condition_variable>, and file functions (not IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS).
+// - If IMGUI_ENABLE_PROFILER is used, it needs to be defined when compiling both imgui.cpp and imgui_trace.cpp (e.g. in imconfig.h).
+
+#pragma once
+#include "imgui.h"      // IMGUI_API
+#ifndef IMGUI_DISABLE
+
+// Forward declarations
+struct ImGuiTraceWriter;    // Opaque
+
+namespace ImGuiTrace
+{
+    // - CreateWriter() returns NULL if the file can't be opened or written to. It registers context hooks into the current context.
+    // - 'buffer_size' is the maximum amount of pending data: three times this amount is allocated (events of current frame, one buffer filled, one buffer being written).
+    // - DestroyWriter() writes remaining events and closes the file. Return false if any write failed (the file is then incomplete).
+    //   If called after ImGui::DestroyContext(), events are recorded until the context destruction.
+    // - Flush() requests writing pending events without waiting for the buffer to be half full. It doesn't block.
+    // - GetDroppedFrameCount() returns number of frames not written because the buffer was full, or because a single frame had more than 'buffer_size' bytes of events.
+    // - GetWriteErrorCount() returns number of failed writes (e.g. disk full). Events of those writes are lost.
+    IMGUI_API ImGuiTraceWriter* CreateWriter(const char* filename, size_t buffer_size = 4 * 1024 * 1024);
+    IMGUI_API bool              DestroyWriter(ImGuiTraceWriter* writer);
+    IMGUI_API void              Flush(ImGuiTraceWriter* writer);
+    IMGUI_API int               GetDroppedFrameCount(ImGuiTraceWriter* writer);
+    IMGUI_API int               GetWriteErrorCount(ImGuiTraceWriter* writer);
+}
+
+#endif // #ifndef IMGUI_DISABLE